@@ -9,19 +9,27 @@ import jpt.BenchmarksReporter;
 // Containers
 import Benchmarks_DynamicArray;
 import Benchmarks_HashMap;
+import Benchmarks_KDTree3;
 
 // Functional
 import Benchmarks_Function;
 
+// Memory
+import Benchmarks_MemoryPool;
+
 // Strings
 import Benchmarks_String;
 
 // Math
+import Benchmarks_Hash;
 import Benchmarks_Math;
 
 // Minimal
 import Benchmarks_Utilities;
 
+// Threading
+import Benchmarks_ThreadSafeQueue;
+
 export void RunBenchmarks_Core(jpt::BenchmarksReporter& reporter)
 {
     /** Benchmark Functions */
@@ -29,16 +37,24 @@ export void RunBenchmarks_Core(jpt::BenchmarksReporter& reporter)
     // Containers
     //RunBenchmarks_DynamicArray(reporter);
     //RunBenchmarks_HashMap(reporter);
+    //RunBenchmarks_KDTree3(reporter);
 
     // Functional
     //RunBenchmarks_Function(reporter);
 
+    // Memory
+    //RunBenchmarks_MemoryPool(reporter);
+
     // Strings
     RunBenchmarks_String(reporter);
 
     // Math
+    //RunBenchmarks_Hash(reporter);
     //RunBenchmarks_Math(reporter);
 
     // Minimal
     //RunBenchmarks_Utilities(reporter);
+
+    // Threading
+    //RunBenchmarks_ThreadSafeQueue(reporter);
 }
\ No newline at end of file
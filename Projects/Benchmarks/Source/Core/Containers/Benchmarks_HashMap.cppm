@@ -1,18 +1,117 @@
 // Copyright Jupiter Technologies, Inc. All Rights Reserved.
 
-module; 
+module;
 
+#include "Core/Validation/Assert.h"
 #include "Debugging/Logger.h"
 #include "Profiling/TimingProfiler.h"
 
+#include <initializer_list>
+#include <unordered_map>
+
 export module Benchmarks_HashMap;
 
 import jpt.BenchmarksReporter;
 import jpt.HashMap;
+import jpt.HashMap_Flat;
 import jpt.TypeDefs;
 import jpt.String;
+import jpt.ToString;
 import jpt.Utilities;
 
-export void RunBenchmarks_HashMap([[maybe_unused]] jpt::BenchmarksReporter& reporter)
+/** Spread keys over the whole 64-bit range, like real ids and hashes */
+static uint64 GetKey(size_t i)
+{
+    return (i + 1) * 0x9E3779B97F4A7C15ull;
+}
+
+template<typename TMap>
+void Insert(TMap& map, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        map[GetKey(i)] = i;
+    }
+}
+
+template<typename TMap>
+bool Has(const TMap& map, uint64 key)
+{
+    if constexpr (requires { map.Has(key); })
+    {
+        return map.Has(key);
+    }
+    else
+    {
+        return map.contains(key);
+    }
+}
+
+template<typename TMap>
+void Erase(TMap& map, uint64 key)
+{
+    if constexpr (requires { map.Erase(key); })
+    {
+        map.Erase(key);
+    }
+    else
+    {
+        map.erase(key);
+    }
+}
+
+template<typename TMap>
+void Profile(jpt::BenchmarksReporter& reporter, const char* mapName, size_t count)
+{
+    const jpt::String context = jpt::String(mapName) + " " + jpt::ToString(count) + " entries";
+    const jpt::String topic = "HashMap";
+
+    reporter.Profile((topic + " Insert").ConstBuffer(), context.ConstBuffer(), 1, [count]()
+        {
+            TMap map;
+            Insert(map, count);
+        });
+
+    TMap map;
+    Insert(map, count);
+
+    reporter.Profile((topic + " Lookup").ConstBuffer(), context.ConstBuffer(), 1, [&map, count]()
+        {
+            // Half hits, half misses
+            size_t found = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                found += Has(map, GetKey(i)) ? 1 : 0;
+                found += Has(map, GetKey(i + count)) ? 1 : 0;
+            }
+            JPT_ASSERT(found == count);
+        });
+
+    reporter.Profile((topic + " Iterate").ConstBuffer(), context.ConstBuffer(), 1, [&map, count]()
+        {
+            uint64 sum = 0;
+            for (const auto& [key, value] : map)
+            {
+                sum += value;
+            }
+            JPT_ASSERT(sum == count * (count - 1) / 2);
+        });
+
+    reporter.Profile((topic + " Erase").ConstBuffer(), context.ConstBuffer(), 1, [&map, count]()
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Erase(map, GetKey(i));
+            }
+        });
+}
+
+export void RunBenchmarks_HashMap(jpt::BenchmarksReporter& reporter)
 {
+    for (size_t count : { 1'000, 10'000, 100'000, 1'000'000, 10'000'000 })
+    {
+        Profile<jpt::HashMap<uint64, uint64>>(reporter, "Chaining", count);
+        Profile<jpt::HashMap_Flat<uint64, uint64>>(reporter, "Flat", count);
+        Profile<std::unordered_map<uint64, uint64>>(reporter, "std::unordered_map", count);
+    }
 }
\ No newline at end of file
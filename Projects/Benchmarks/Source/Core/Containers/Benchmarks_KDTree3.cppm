@@ -0,0 +1,105 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+
+#include <cmath>
+#include <initializer_list>
+
+export module Benchmarks_KDTree3;
+
+import jpt.BenchmarksReporter;
+import jpt.DynamicArray;
+import jpt.KDTree3;
+import jpt.Rand;
+import jpt.String;
+import jpt.ToString;
+import jpt.TypeDefs;
+import jpt.Vector3;
+
+static constexpr size_t kQueriesCount = 10'000;
+static constexpr size_t kK = 16;
+
+static jpt::DynamicArray<Vec3f> GetPoints(size_t count, uint64 seed)
+{
+    jpt::RNG rng(seed);
+
+    jpt::DynamicArray<Vec3f> points;
+    points.Reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.EmplaceBack(rng.RangedFloat(-1000.0f, 1000.0f), rng.RangedFloat(-1000.0f, 1000.0f), rng.RangedFloat(-1000.0f, 1000.0f));
+    }
+    return points;
+}
+
+static void Profile(jpt::BenchmarksReporter& reporter, size_t count)
+{
+    const jpt::String context = jpt::ToString(count) + " points";
+
+    const jpt::DynamicArray<Vec3f> points = GetPoints(count, 1);
+    const jpt::DynamicArray<Vec3f> queries = GetPoints(kQueriesCount, 2);
+
+    // Sphere holding about 30 points whatever the density. 4/3 * pi * r^3 = 30 * volume / count
+    const float32 radius = static_cast<float32>(std::cbrt(30.0 * 2000.0 * 2000.0 * 2000.0 * 3.0 / (4.0 * 3.14159265 * count)));
+
+    reporter.Profile("KDTree3 Build", context.ConstBuffer(), 1, [&points]()
+        {
+            KDTree3f tree(points);
+            JPT_ASSERT(tree.Count() == points.Count());
+        });
+
+    KDTree3f tree(points);
+
+    const jpt::String radiusContext = context + ", " + jpt::ToString(kQueriesCount) + " queries";
+    reporter.Profile("KDTree3 FindInRadius", radiusContext.ConstBuffer(), 1, [&tree, &queries, radius]()
+        {
+            jpt::DynamicArray<Index> ids;
+            size_t found = 0;
+            for (const Vec3f& query : queries)
+            {
+                found += tree.FindInRadius(query, radius, ids);
+            }
+            JPT_ASSERT(found > 0);
+        });
+
+    reporter.Profile("KDTree3 FindKNearest", (radiusContext + ", k = " + jpt::ToString(kK)).ConstBuffer(), 1, [&tree, &queries]()
+        {
+            Index ids[kK];
+            float32 distances2[kK];
+            size_t found = 0;
+            for (const Vec3f& query : queries)
+            {
+                found += tree.FindKNearest(query, kK, ids, distances2);
+            }
+            JPT_ASSERT(found == queries.Count() * kK);
+        });
+
+    // Baseline: every query scans every point. Only a hundredth of the queries, it's that slow
+    const jpt::String bruteForceContext = context + ", " + jpt::ToString(kQueriesCount / 100) + " queries";
+    reporter.Profile("KDTree3 Brute Force Radius", bruteForceContext.ConstBuffer(), 1, [&points, &queries, radius]()
+        {
+            jpt::DynamicArray<Index> ids;
+            for (size_t query = 0; query < kQueriesCount / 100; ++query)
+            {
+                ids.Clear();
+                for (Index i = 0; i < points.Count(); ++i)
+                {
+                    if (points[i].Distance2(queries[query]) <= radius * radius)
+                    {
+                        ids.EmplaceBack(i);
+                    }
+                }
+            }
+        });
+}
+
+export void RunBenchmarks_KDTree3(jpt::BenchmarksReporter& reporter)
+{
+    for (size_t count : { 10'000, 100'000, 1'000'000, 4'000'000 })
+    {
+        Profile(reporter, count);
+    }
+}
\ No newline at end of file
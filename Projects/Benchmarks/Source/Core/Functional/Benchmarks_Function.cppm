@@ -77,6 +77,80 @@ void stdFunction_Assign([[maybe_unused]] jpt::BenchmarksReporter& reporter)
     }
 }
 
+/** Keeps the optimizer from dropping the call loops */
+static volatile int32 locPositives = 0;
+
+/** Call overhead only: each profile runs the whole loop once, so the reporter's own call isn't measured per iteration */
+template<typename TFunction>
+void ProfileCalls(jpt::BenchmarksReporter& reporter, const char* context, const TFunction& func)
+{
+    reporter.Profile("Function", context, 1, [&func]()
+        {
+            int32 positives = 0;
+            for (int32 i = 0; i < kCount; ++i)
+            {
+                positives += func(i - kCount / 2);
+            }
+            JPT_ASSERT(positives == kCount / 2 - 1);
+            locPositives = positives;
+        });
+}
+
+void Call(jpt::BenchmarksReporter& reporter)
+{
+    bool(*pFunction)(int32) = &SampleFunction;
+    ProfileCalls(reporter, "Function pointer call 1'000'000", pFunction);
+
+    const jpt::Function<bool(int32)> jptFunction = &SampleFunction;
+    ProfileCalls(reporter, "jpt::Function call 1'000'000", jptFunction);
+
+    const std::function<bool(int32)> stdFunction = &SampleFunction;
+    ProfileCalls(reporter, "std::function call 1'000'000", stdFunction);
+
+    const jpt::FunctionRef<bool(int32)> functionRef = &SampleFunction;
+    ProfileCalls(reporter, "jpt::FunctionRef call 1'000'000", functionRef);
+
+    int32 threshold = 0;
+    const jpt::Function<bool(int32)> jptLambda = [&threshold](int32 num) { return num > threshold; };
+    ProfileCalls(reporter, "jpt::Function lambda call 1'000'000", jptLambda);
+
+    const std::function<bool(int32)> stdLambda = [&threshold](int32 num) { return num > threshold; };
+    ProfileCalls(reporter, "std::function lambda call 1'000'000", stdLambda);
+}
+
+void Construct(jpt::BenchmarksReporter& reporter)
+{
+    // 32 bytes of captures, stored inline by jpt::Function
+    int32 a = 1, b = 2, c = 3, d = 4;
+    reporter.Profile("Function", "jpt::Function construct and copy, small capture 1'000'000", kCount, [&]()
+        {
+            jpt::Function<int32()> func = [pA = &a, pB = &b, pC = &c, pD = &d]() { return *pA + *pB + *pC + *pD; };
+            const jpt::Function<int32()> copy = func;
+            JPT_ASSERT(copy() == 10);
+        });
+    reporter.Profile("Function", "std::function construct and copy, small capture 1'000'000", kCount, [&]()
+        {
+            std::function<int32()> func = [pA = &a, pB = &b, pC = &c, pD = &d]() { return *pA + *pB + *pC + *pD; };
+            const std::function<int32()> copy = func;
+            JPT_ASSERT(copy() == 10);
+        });
+
+    // Too big for either inline storage, both allocate
+    int32 values[32] = { 10 };
+    reporter.Profile("Function", "jpt::Function construct and copy, large capture 1'000'000", kCount, [&values]()
+        {
+            jpt::Function<int32()> func = [values]() { return values[0]; };
+            const jpt::Function<int32()> copy = func;
+            JPT_ASSERT(copy() == 10);
+        });
+    reporter.Profile("Function", "std::function construct and copy, large capture 1'000'000", kCount, [&values]()
+        {
+            std::function<int32()> func = [values]() { return values[0]; };
+            const std::function<int32()> copy = func;
+            JPT_ASSERT(copy() == 10);
+        });
+}
+
 export void RunBenchmarks_Function(jpt::BenchmarksReporter& reporter)
 {
     jptFunction_Call(reporter);
@@ -84,4 +158,7 @@ export void RunBenchmarks_Function(jpt::BenchmarksReporter& reporter)
 
     jptFunction_Assign(reporter);
     stdFunction_Assign(reporter);
+
+    Call(reporter);
+    Construct(reporter);
 }
\ No newline at end of file
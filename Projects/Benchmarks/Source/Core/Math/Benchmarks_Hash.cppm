@@ -0,0 +1,144 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+
+#include <bit>
+#include <initializer_list>
+#include <string_view>
+
+export module Benchmarks_Hash;
+
+import jpt.BenchmarksReporter;
+import jpt.DynamicArray;
+import jpt.Hash;
+import jpt.String;
+import jpt.ToString;
+import jpt.TypeDefs;
+
+/** Byte-at-a-time FNV-1a, what StringHash64 used to be. Baseline for both throughput and quality */
+static uint64 Fnv1a(const char* pData, size_t size)
+{
+    uint64 hash = 0xcbf29ce484222325;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ static_cast<uint8>(pData[i])) * 0x100000001b3;
+    }
+    return hash;
+}
+
+static uint64 StdHash(const char* pData, size_t size)
+{
+    return std::hash<std::string_view>()(std::string_view(pData, size));
+}
+
+static uint64 WyHash(const char* pData, size_t size)
+{
+    return jpt::HashString(pData, size);
+}
+
+using HashFunc = uint64(*)(const char*, size_t);
+
+static void Throughput(jpt::BenchmarksReporter& reporter, const char* name, HashFunc hashFunc)
+{
+    static constexpr size_t kTotalBytes = 64 * 1024 * 1024;
+
+    jpt::DynamicArray<char> data;
+    data.Resize(4096);
+    for (size_t i = 0; i < data.Count(); ++i)
+    {
+        data[i] = static_cast<char>(i * 31 + 7);
+    }
+
+    for (size_t size : { 8, 16, 32, 64, 256, 4096 })
+    {
+        const jpt::String context = jpt::String(name) + " " + jpt::ToString(size) + " bytes keys, 64 MB total";
+        reporter.Profile("Hash Throughput", context.ConstBuffer(), 1, [&data, size, hashFunc]()
+            {
+                uint64 sum = 0;
+                for (size_t i = 0; i < kTotalBytes / size; ++i)
+                {
+                    // Vary the first byte so the calls can't be folded
+                    data[0] = static_cast<char>(i);
+                    sum += hashFunc(data.ConstBuffer(), size);
+                }
+                JPT_ASSERT(sum != 0);
+            });
+    }
+}
+
+/** Largest fraction of a power-of-two table's buckets a key set ends up in, relative to the average. ~1.5 for 64 keys per bucket is random */
+static float64 WorstBucket(HashFunc hashFunc, bool isNumbered)
+{
+    static constexpr size_t kBuckets = 1024;
+    static constexpr size_t kKeys = kBuckets * 64;
+
+    jpt::DynamicArray<uint32> buckets;
+    buckets.Resize(kBuckets, 0);
+
+    uint32 worst = 0;
+    for (size_t i = 0; i < kKeys; ++i)
+    {
+        uint64 hash = 0;
+        if (isNumbered)
+        {
+            // Names that only differ at the end
+            const jpt::String key = jpt::String::Format<32>("Entity_%zu", i);
+            hash = hashFunc(key.ConstBuffer(), key.Count());
+        }
+        else
+        {
+            // Ids that only differ in the high bytes, which power-of-two masks drop
+            const uint64 id = static_cast<uint64>(i) << 40;
+            hash = hashFunc(reinterpret_cast<const char*>(&id), sizeof(id));
+        }
+
+        const uint32 count = ++buckets[hash & (kBuckets - 1)];
+        worst = count > worst ? count : worst;
+    }
+
+    return static_cast<float64>(worst) / (kKeys / kBuckets);
+}
+
+/** Average output bits flipped by flipping one input bit, the worst of all 64. 32 is ideal */
+static float64 WorstAvalanche(HashFunc hashFunc)
+{
+    static constexpr size_t kSamples = 1024;
+
+    float64 worst = 32.0;
+    for (uint64 bit = 0; bit < 64; ++bit)
+    {
+        uint64 flipped = 0;
+        for (uint64 value = 0; value < kSamples; ++value)
+        {
+            const uint64 changed = value ^ (1ull << bit);
+            flipped += std::popcount(hashFunc(reinterpret_cast<const char*>(&value), sizeof(value)) ^ hashFunc(reinterpret_cast<const char*>(&changed), sizeof(changed)));
+        }
+
+        const float64 average = static_cast<float64>(flipped) / kSamples;
+        const float64 distance = average > 32.0 ? average - 32.0 : 32.0 - average;
+        const float64 worstDistance = worst > 32.0 ? worst - 32.0 : 32.0 - worst;
+        worst = distance > worstDistance ? average : worst;
+    }
+
+    return worst;
+}
+
+static void Quality(const char* name, HashFunc hashFunc)
+{
+    JPT_INFO("Hash Quality %s: worst bucket %.2fx average for names, %.2fx for high bit ids. Worst avalanche %.2f bits of 32",
+             name, WorstBucket(hashFunc, true), WorstBucket(hashFunc, false), WorstAvalanche(hashFunc));
+}
+
+export void RunBenchmarks_Hash(jpt::BenchmarksReporter& reporter)
+{
+    Throughput(reporter, "jpt::HashString", WyHash);
+    Throughput(reporter, "FNV-1a", Fnv1a);
+    Throughput(reporter, "std::hash", StdHash);
+
+    Quality("jpt::HashString", WyHash);
+    Quality("FNV-1a", Fnv1a);
+    Quality("std::hash", StdHash);
+}
\ No newline at end of file
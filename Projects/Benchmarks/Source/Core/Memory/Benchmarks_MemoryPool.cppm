@@ -0,0 +1,88 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+#include "Profiling/TimingProfiler.h"
+
+#include <initializer_list>
+#include <thread>
+
+export module Benchmarks_MemoryPool;
+
+import jpt.BenchmarksReporter;
+import jpt.DynamicArray;
+import jpt.MemoryPool;
+import jpt.MemoryPool_ThreadCached;
+import jpt.String;
+import jpt.ToString;
+import jpt.TypeDefs;
+
+// Every thread allocates a burst of blocks, then frees them. Repeated kRounds times
+static constexpr size_t kBlocksPerBurst = 256;
+static constexpr size_t kRounds = 10'000;
+
+static const jpt::MemoryPool::Config kConfig
+{
+    .blockSize = 64,
+    .blocksPerChunk = 4096,
+    .initialChunks = 1,
+    .maxChunks = 64,
+    .alignment = 16
+};
+
+template<typename TPool>
+void AllocateAndFree(TPool& pool)
+{
+    void* blocks[kBlocksPerBurst];
+
+    for (size_t round = 0; round < kRounds; ++round)
+    {
+        for (size_t i = 0; i < kBlocksPerBurst; ++i)
+        {
+            blocks[i] = pool.New();
+            JPT_ASSERT(blocks[i] != nullptr);
+        }
+        for (size_t i = 0; i < kBlocksPerBurst; ++i)
+        {
+            pool.Delete(blocks[i]);
+        }
+    }
+}
+
+template<typename TPool>
+void Profile(jpt::BenchmarksReporter& reporter, const char* poolName, size_t threadsCount)
+{
+    const jpt::String context = jpt::String(poolName) + " " + jpt::ToString(threadsCount) + " threads";
+
+    reporter.Profile("MemoryPool", context.ConstBuffer(), 1, [threadsCount]()
+        {
+            TPool pool(kConfig);
+
+            jpt::DynamicArray<std::thread> threads;
+            threads.Reserve(threadsCount);
+
+            for (size_t i = 0; i < threadsCount; ++i)
+            {
+                threads.EmplaceBack([&pool]()
+                    {
+                        AllocateAndFree(pool);
+                    });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        });
+}
+
+export void RunBenchmarks_MemoryPool(jpt::BenchmarksReporter& reporter)
+{
+    for (size_t threadsCount : { 1, 4, 16 })
+    {
+        Profile<jpt::MemoryPool>(reporter, "Mutex", threadsCount);
+        Profile<jpt::MemoryPool_ThreadCached>(reporter, "ThreadCached", threadsCount);
+    }
+}
\ No newline at end of file
@@ -6,12 +6,14 @@ module;
 #include "Debugging/Logger.h"
 #include "Core/Validation/Assert.h"
 
+#include <stdio.h>
 #include <string>
 
 export module Benchmarks_String;
 
 import jpt.BenchmarksReporter;
 import jpt.DynamicArray;
+import jpt.NumberConversion;
 import jpt.String;
 import jpt.ToString;
 import jpt.TypeDefs;
@@ -90,9 +92,67 @@ void TrimRight(jpt::BenchmarksReporter& reporter)
         });
 }
 
+void FindLong(jpt::BenchmarksReporter& reporter)
+{
+    // A 4 KB line, like a minified json or a csv row, with the match at the very end
+    jpt::String str;
+    for (int32 i = 0; i < 512; ++i)
+    {
+        str += "abcdefg,";
+    }
+    str += "Jupiter";
+
+    reporter.Profile("String", "Find in 4 KB 100'000 elements", 100'000, [&str]()
+        {
+            JPT_ASSERT(str.Find('J') == 4096);
+            JPT_ASSERT(str.Find("Jupiter") == 4096);
+            JPT_ASSERT(str.Count(',') == 512);
+        });
+}
+
+void Numbers(jpt::BenchmarksReporter& reporter)
+{
+    reporter.Profile("String", "snprintf 1'000'000 integers and floats", 1, []()
+        {
+            char buffer[64];
+            size_t total = 0;
+            for (int32 i = 0; i < 1'000'000; ++i)
+            {
+                total += snprintf(buffer, sizeof(buffer), "%d", i * 7919);
+                total += snprintf(buffer, sizeof(buffer), "%.9g", i * 0.001f);
+            }
+            JPT_ASSERT(total > 0);
+        });
+
+    reporter.Profile("String", "WriteInteger and WriteFloat 1'000'000 integers and floats", 1, []()
+        {
+            char buffer[jpt::kMaxIntegerChars];
+            size_t total = 0;
+            for (int32 i = 0; i < 1'000'000; ++i)
+            {
+                total += jpt::WriteInteger(buffer, i * 7919);
+                total += jpt::WriteFloat(buffer, i * 0.001f);
+            }
+            JPT_ASSERT(total > 0);
+        });
+
+    reporter.Profile("String", "ParseInteger and ParseFloat 1'000'000 numbers", 1, []()
+        {
+            int32 integer = 0;
+            float32 value = 0.0f;
+            for (int32 i = 0; i < 1'000'000; ++i)
+            {
+                JPT_ASSERT(jpt::ParseInteger("1234567", 7, integer).IsValid());
+                JPT_ASSERT(jpt::ParseFloat("-3.14159e-2", 11, value).IsValid());
+            }
+        });
+}
+
 export void RunBenchmarks_String(jpt::BenchmarksReporter& reporter)
 {
     //Find(reporter);
+    //FindLong(reporter);
+    //Numbers(reporter);
     //Replace(reporter);
     //SubStr(reporter);
     //Split(reporter);
@@ -0,0 +1,133 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+#include "Profiling/TimingProfiler.h"
+
+#include <atomic>
+#include <thread>
+
+export module Benchmarks_ThreadSafeQueue;
+
+import jpt.BenchmarksReporter;
+import jpt.DynamicArray;
+import jpt.LockFreeQueue_MPMC;
+import jpt.LockFreeQueue_SPSC;
+import jpt.Optional;
+import jpt.String;
+import jpt.ThreadSafeQueue;
+import jpt.ToString;
+import jpt.TypeDefs;
+
+static constexpr size_t kValuesCount = 1'000'000;
+static constexpr size_t kBatchSize   = 64;
+
+/** Producers push kValuesCount values in total, consumers pop until all of them are through */
+template<typename TQueue, bool kIsBatched>
+void Transfer(size_t producersCount, size_t consumersCount)
+{
+    TQueue queue;
+    std::atomic<size_t> popped = 0;
+    std::atomic<uint64> sum = 0;
+
+    jpt::DynamicArray<std::thread> threads;
+    threads.Reserve(producersCount + consumersCount);
+
+    const size_t valuesPerProducer = kValuesCount / producersCount;
+    for (size_t p = 0; p < producersCount; ++p)
+    {
+        threads.EmplaceBack([&queue, valuesPerProducer]()
+            {
+                if constexpr (kIsBatched)
+                {
+                    uint64 batch[kBatchSize];
+                    for (size_t i = 0; i < valuesPerProducer; i += kBatchSize)
+                    {
+                        const size_t count = valuesPerProducer - i < kBatchSize ? valuesPerProducer - i : kBatchSize;
+                        for (size_t j = 0; j < count; ++j)
+                        {
+                            batch[j] = i + j;
+                        }
+
+                        size_t pushed = 0;
+                        while (pushed < count)
+                        {
+                            pushed += queue.TryPushBatch(batch + pushed, count - pushed);
+                        }
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < valuesPerProducer; ++i)
+                    {
+                        queue.Push(static_cast<uint64>(i));
+                    }
+                }
+            });
+    }
+
+    const size_t total = valuesPerProducer * producersCount;
+    for (size_t c = 0; c < consumersCount; ++c)
+    {
+        threads.EmplaceBack([&queue, &popped, &sum, total]()
+            {
+                uint64 localSum = 0;
+                while (popped.load(std::memory_order_relaxed) < total)
+                {
+                    if constexpr (kIsBatched)
+                    {
+                        uint64 batch[kBatchSize];
+                        const size_t count = queue.TryPopBatch(batch, kBatchSize);
+                        for (size_t j = 0; j < count; ++j)
+                        {
+                            localSum += batch[j];
+                        }
+                        popped.fetch_add(count, std::memory_order_relaxed);
+                    }
+                    else if (jpt::Optional<uint64> value = queue.TryPop())
+                    {
+                        localSum += value.Value();
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                sum.fetch_add(localSum);
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    JPT_ASSERT(sum == producersCount * (valuesPerProducer * (valuesPerProducer - 1) / 2));
+}
+
+template<typename TQueue, bool kIsBatched = false>
+void Profile(jpt::BenchmarksReporter& reporter, const char* queueName, size_t producersCount, size_t consumersCount)
+{
+    const jpt::String context = jpt::String(queueName) + " " + jpt::ToString(producersCount) + "P" + jpt::ToString(consumersCount) + "C";
+
+    reporter.Profile("ThreadSafeQueue", context.ConstBuffer(), 1, [producersCount, consumersCount]()
+        {
+            Transfer<TQueue, kIsBatched>(producersCount, consumersCount);
+        });
+}
+
+export void RunBenchmarks_ThreadSafeQueue(jpt::BenchmarksReporter& reporter)
+{
+    // One-to-one pipeline
+    Profile<jpt::ThreadSafeQueue<uint64>>(reporter, "Mutex", 1, 1);
+    Profile<jpt::LockFreeQueue_SPSC<uint64>>(reporter, "SPSC", 1, 1);
+    Profile<jpt::LockFreeQueue_SPSC<uint64>, true>(reporter, "SPSC Batched", 1, 1);
+    Profile<jpt::LockFreeQueue_MPMC<uint64>>(reporter, "MPMC", 1, 1);
+
+    // Contended
+    for (size_t threadsCount : { 2, 4 })
+    {
+        Profile<jpt::ThreadSafeQueue<uint64>>(reporter, "Mutex", threadsCount, threadsCount);
+        Profile<jpt::LockFreeQueue_MPMC<uint64>>(reporter, "MPMC", threadsCount, threadsCount);
+        Profile<jpt::LockFreeQueue_MPMC<uint64>, true>(reporter, "MPMC Batched", threadsCount, threadsCount);
+    }
+}
\ No newline at end of file
@@ -606,10 +606,11 @@ bool UnitTests_HashMap_Emplace()
 
     JPT_ENSURE(hashMap.Count() == 4);
 
-    JPT_ENSURE(hashMap["Alice"].ToString() == "Alice-|5.500-|25-|[]");
-    JPT_ENSURE(hashMap["Bob"].ToString() == "Bob-|6.000-|30-|[Alice]");
-    JPT_ENSURE(hashMap["Charlie"].ToString() == "Charlie-|5.800-|28-|[Alice, Bob]");
-    JPT_ENSURE(hashMap["David"].ToString() == "David-|5.900-|27-|[Alice, Bob, Charlie]");
+    // Shortest text reading back to the float64 height. 5.8f isn't 5.8 once widened
+    JPT_ENSURE(hashMap["Alice"].ToString() == "Alice-|5.5-|25-|[]");
+    JPT_ENSURE(hashMap["Bob"].ToString() == "Bob-|6-|30-|[Alice]");
+    JPT_ENSURE(hashMap["Charlie"].ToString() == "Charlie-|5.800000190734863-|28-|[Alice, Bob]");
+    JPT_ENSURE(hashMap["David"].ToString() == "David-|5.900000095367432-|27-|[Alice, Bob, Charlie]");
 
     return true;
 }
@@ -0,0 +1,176 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_HashMap_Flat;
+
+import jpt.DynamicArray;
+import jpt.HashMap_Flat;
+import jpt.String;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+bool UnitTests_HashMap_Flat_Trivial()
+{
+    jpt::HashMap_Flat<char, int32> map;
+
+    // Adding
+    map.Add('a', 0);
+    map.Add('b', 1);
+    map.Add('c', 2);
+    map['a'] = 3;
+    map['d'] = 4;
+    map['e'] = 5;
+
+    JPT_ENSURE(map['a'] == 3);
+    JPT_ENSURE(map['b'] == 1);
+    JPT_ENSURE(map['c'] == 2);
+    JPT_ENSURE(map['d'] == 4);
+    JPT_ENSURE(map['e'] == 5);
+    JPT_ENSURE(map.Count() == 5);
+
+    // Erasing
+    map.Erase('e');
+
+    // Searching
+    JPT_ENSURE(map.Has('a'));
+    JPT_ENSURE(!map.Has('e'));
+    JPT_ENSURE(map.Find('a')->second == 3);
+    JPT_ENSURE(map.Find('e') == map.end());
+
+    // Modifiying
+    map.Clear();
+
+    // Capacity
+    JPT_ENSURE(map.IsEmpty());
+    JPT_ENSURE(!map.Has('a'));
+
+    return true;
+}
+
+bool UnitTests_HashMap_Flat_NonTrivial_CopyMove()
+{
+    jpt::HashMap_Flat<jpt::String, jpt::String> map{ {"Champ A", "Aatrox"},{"Champ B","Jax"},{"Champ C", "Darius"} };
+    JPT_ENSURE(map["Champ A"] == "Aatrox");
+    JPT_ENSURE(map["Champ B"] == "Jax");
+    JPT_ENSURE(map["Champ C"] == "Darius");
+    JPT_ENSURE(map.Count() == 3);
+
+    jpt::HashMap_Flat<jpt::String, jpt::String> copy(map);
+    JPT_ENSURE(copy == map);
+
+    jpt::HashMap_Flat<jpt::String, jpt::String> moved(jpt::Move(copy));
+    JPT_ENSURE(moved == map);
+    JPT_ENSURE(copy.IsEmpty());
+
+    jpt::HashMap_Flat<jpt::String, jpt::String> assigned;
+    assigned = moved;
+    JPT_ENSURE(assigned["Champ B"] == "Jax");
+
+    assigned = jpt::Move(moved);
+    JPT_ENSURE(assigned.Count() == 3);
+    JPT_ENSURE(moved.IsEmpty());
+
+    return true;
+}
+
+bool UnitTests_HashMap_Flat_Grow()
+{
+    jpt::HashMap_Flat<int32, int32> map;
+
+    for (int32 i = 0; i < 10'000; ++i)
+    {
+        map.Add(i, i * 2);
+    }
+    JPT_ENSURE(map.Count() == 10'000);
+
+    for (int32 i = 0; i < 10'000; ++i)
+    {
+        JPT_ENSURE(map.Has(i));
+        JPT_ENSURE(map[i] == i * 2);
+    }
+    JPT_ENSURE(!map.Has(10'000));
+
+    // Every element is visited exactly once
+    int64 sum = 0;
+    Index count = 0;
+    for (const auto& [key, value] : map)
+    {
+        sum += value;
+        ++count;
+    }
+    JPT_ENSURE(count == 10'000);
+    JPT_ENSURE(sum == 2ll * (9'999ll * 10'000ll / 2));
+
+    return true;
+}
+
+bool UnitTests_HashMap_Flat_Churn()
+{
+    // Lots of erase/insert cycles leave tombstones behind. Lookups must stay correct and the table must not grow unbounded
+    jpt::HashMap_Flat<int32, int32> map;
+
+    for (int32 round = 0; round < 100; ++round)
+    {
+        for (int32 i = 0; i < 100; ++i)
+        {
+            map.Add(round * 100 + i, i);
+        }
+        for (int32 i = 0; i < 100; ++i)
+        {
+            JPT_ENSURE(map.Find(round * 100 + i)->second == i);
+            map.Erase(round * 100 + i);
+        }
+        JPT_ENSURE(map.IsEmpty());
+    }
+
+    JPT_ENSURE(map.Capacity() <= 256);
+
+    return true;
+}
+
+bool UnitTests_HashMap_Flat_Iterate_Erase()
+{
+    jpt::HashMap_Flat<jpt::String, jpt::DynamicArray<jpt::String>> map
+    {
+        { "Languages",     { "C++",     "Python", "Lua"            }},
+        { "Graphics APIs", { "DX12",    "Vulkan"                   }},
+        { "Platforms",     { "Windows", "Mac",    "Android", "IOS" }},
+        { "Tools" ,        { "Premake", "Doxygen"                  }}
+    };
+
+    JPT_ENSURE(map.Count() == 4);
+
+    for (auto itr = map.begin(); itr != map.end();)
+    {
+        if (itr->first == "Languages" || itr->first == "Platforms")
+        {
+            itr = map.Erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    JPT_ENSURE(map.Count() == 2);
+    JPT_ENSURE(map.Find("Languages") == map.end());
+    JPT_ENSURE(map.Find("Graphics APIs")->second == (jpt::DynamicArray<jpt::String>{ "DX12", "Vulkan" }));
+    JPT_ENSURE(map.Find("Platforms") == map.end());
+    JPT_ENSURE(map.Find("Tools")->second == (jpt::DynamicArray<jpt::String>{ "Premake", "Doxygen" }));
+
+    return true;
+}
+
+export bool RunUnitTests_HashMap_Flat()
+{
+    JPT_ENSURE(UnitTests_HashMap_Flat_Trivial());
+    JPT_ENSURE(UnitTests_HashMap_Flat_NonTrivial_CopyMove());
+    JPT_ENSURE(UnitTests_HashMap_Flat_Grow());
+    JPT_ENSURE(UnitTests_HashMap_Flat_Churn());
+    JPT_ENSURE(UnitTests_HashMap_Flat_Iterate_Erase());
+
+    return true;
+}
\ No newline at end of file
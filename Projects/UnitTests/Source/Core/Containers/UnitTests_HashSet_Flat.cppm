@@ -0,0 +1,80 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_HashSet_Flat;
+
+import jpt.HashSet_Flat;
+import jpt.String;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+bool UnitTests_HashSet_Flat()
+{
+    jpt::HashSet_Flat<int32> hashSet;
+
+    hashSet.Add(1);
+    hashSet.Add(2);
+    hashSet.Add(3);
+    hashSet.Add(3);
+
+    JPT_ENSURE(hashSet.Has(1));
+    JPT_ENSURE(hashSet.Has(2));
+    JPT_ENSURE(hashSet.Has(3));
+    JPT_ENSURE(!hashSet.Has(4));
+    JPT_ENSURE(hashSet.Count() == 3);
+
+    hashSet.Erase(2);
+
+    JPT_ENSURE(hashSet.Has(1));
+    JPT_ENSURE(!hashSet.Has(2));
+    JPT_ENSURE(hashSet.Has(3));
+    JPT_ENSURE(hashSet.Count() == 2);
+
+    hashSet.Clear();
+
+    JPT_ENSURE(!hashSet.Has(1));
+    JPT_ENSURE(!hashSet.Has(3));
+    JPT_ENSURE(hashSet.IsEmpty());
+
+    return true;
+}
+
+bool UnitTests_HashSet_Flat_String()
+{
+    jpt::HashSet_Flat<jpt::String> hashSet{ "Hello", "World", "Jupiter" };
+
+    JPT_ENSURE(hashSet.Has("Hello"));
+    JPT_ENSURE(hashSet.Has("World"));
+    JPT_ENSURE(hashSet.Has("Jupiter"));
+    JPT_ENSURE(!hashSet.Has("Engine"));
+    JPT_ENSURE(hashSet.Count() == 3);
+
+    jpt::HashSet_Flat<jpt::String> copy = hashSet;
+    hashSet.Erase("World");
+
+    JPT_ENSURE(!hashSet.Has("World"));
+    JPT_ENSURE(copy.Has("World"));
+    JPT_ENSURE(hashSet.Count() == 2);
+    JPT_ENSURE(copy.Count() == 3);
+
+    Index count = 0;
+    for (const jpt::String& str : copy)
+    {
+        JPT_ENSURE(str == "Hello" || str == "World" || str == "Jupiter");
+        ++count;
+    }
+    JPT_ENSURE(count == 3);
+
+    return true;
+}
+
+export bool RunUnitTests_HashSet_Flat()
+{
+    JPT_ENSURE(UnitTests_HashSet_Flat());
+    JPT_ENSURE(UnitTests_HashSet_Flat_String());
+
+    return true;
+}
\ No newline at end of file
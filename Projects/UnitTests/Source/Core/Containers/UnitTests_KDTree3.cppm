@@ -8,6 +8,8 @@ export module UnitTests_KDTree3;
 
 import jpt.KDTree3;
 import jpt.DynamicArray;
+import jpt.Rand;
+import jpt.Sort;
 import jpt.Vector3;
 import jpt.TypeDefs;
 import jpt.Utilities;
@@ -86,9 +88,182 @@ bool UnitTests_KDTree3()
     return true;
 }
 
+/** Compares radius and k-nearest queries around random centers against a brute force scan. Ids index points, erased ids are skipped */
+bool CheckQueries(const KDTree3f& tree, const jpt::DynamicArray<Vec3f>& points, const jpt::DynamicArray<bool>& erased, jpt::RNG& rng, Index queriesCount)
+{
+    static constexpr Index kK = 8;
+
+    jpt::DynamicArray<Index> ids;
+    jpt::DynamicArray<Index> expectedIds;
+    jpt::DynamicArray<float32> distances2;
+    Index nearestIds[kK];
+    float32 nearestDistances2[kK];
+
+    for (Index query = 0; query < queriesCount; ++query)
+    {
+        const Vec3f center = { rng.RangedFloat(-100.0f, 100.0f), rng.RangedFloat(-100.0f, 100.0f), rng.RangedFloat(-100.0f, 100.0f) };
+        const float32 radius = rng.RangedFloat(1.0f, 30.0f);
+
+        expectedIds.Clear();
+        distances2.Clear();
+        for (Index i = 0; i < points.Count(); ++i)
+        {
+            if (erased[i])
+            {
+                continue;
+            }
+
+            const float32 distance2 = points[i].Distance2(center);
+            if (distance2 <= radius * radius)
+            {
+                expectedIds.EmplaceBack(i);
+            }
+            distances2.EmplaceBack(distance2);
+        }
+
+        JPT_ENSURE(tree.FindInRadius(center, radius, ids) == expectedIds.Count());
+        if (!ids.IsEmpty())
+        {
+            jpt::Sort(ids);
+        }
+        JPT_ENSURE(ids == expectedIds);
+
+        JPT_ENSURE(tree.FindKNearest(center, kK, nearestIds, nearestDistances2) == kK);
+        jpt::Sort(distances2);
+        for (Index i = 0; i < kK; ++i)
+        {
+            JPT_ENSURE(nearestDistances2[i] == distances2[i]);
+            JPT_ENSURE(points[nearestIds[i]].Distance2(center) == nearestDistances2[i]);
+        }
+    }
+
+    return true;
+}
+
+jpt::DynamicArray<Vec3f> GetRandomPoints(jpt::RNG& rng, Index count)
+{
+    jpt::DynamicArray<Vec3f> points;
+    points.Reserve(count);
+    for (Index i = 0; i < count; ++i)
+    {
+        points.EmplaceBack(rng.RangedFloat(-100.0f, 100.0f), rng.RangedFloat(-100.0f, 100.0f), rng.RangedFloat(-100.0f, 100.0f));
+    }
+
+    return points;
+}
+
+bool UnitTests_KDTree3_Queries()
+{
+    static constexpr Index kCount = 5000;
+
+    jpt::RNG rng(42);
+
+    jpt::DynamicArray<Vec3f> points = GetRandomPoints(rng, kCount);
+    KDTree3f tree(points);
+
+    // Ids of added points follow the built ones
+    const Vec3f added = { 0.5f, 0.5f, 0.5f };
+    JPT_ENSURE(tree.Add(added) == kCount);
+    points.EmplaceBack(added);
+
+    jpt::DynamicArray<bool> erased;
+    erased.Resize(points.Count(), false);
+    JPT_ENSURE(CheckQueries(tree, points, erased, rng, 100));
+
+    // Fewer points than k. Returns all of them, nearest first
+    static constexpr Index kK = 20;
+    Index nearestIds[kK];
+    float32 nearestDistances2[kK];
+
+    KDTree3f small(GetTestData());
+    JPT_ENSURE(small.Count() < kK);
+    JPT_ENSURE(small.FindKNearest({ 0.0f, 0.0f, 0.0f }, kK, nearestIds, nearestDistances2) == small.Count());
+    JPT_ENSURE(nearestIds[0] == 0);
+    JPT_ENSURE(nearestIds[1] == 1);
+    for (Index i = 1; i < small.Count(); ++i)
+    {
+        JPT_ENSURE(nearestDistances2[i - 1] <= nearestDistances2[i]);
+    }
+
+    jpt::DynamicArray<Index> ids;
+    small.Clear();
+    JPT_ENSURE(small.IsEmpty());
+    JPT_ENSURE(small.FindKNearest({ 0.0f, 0.0f, 0.0f }, kK, nearestIds, nearestDistances2) == 0);
+    JPT_ENSURE(small.FindInRadius({ 0.0f, 0.0f, 0.0f }, 1000.0f, ids) == 0);
+
+    return true;
+}
+
+/** Past kParallelBuildThreshold the top of the tree is split across JobSystem workers */
+bool UnitTests_KDTree3_ParallelBuild()
+{
+    static constexpr Index kCount = KDTree3f::kParallelBuildThreshold + 1000;
+
+    jpt::RNG rng(7);
+
+    const jpt::DynamicArray<Vec3f> points = GetRandomPoints(rng, kCount);
+    const KDTree3f tree(points);
+    JPT_ENSURE(tree.Count() == kCount);
+
+    jpt::DynamicArray<bool> erased;
+    erased.Resize(points.Count(), false);
+    JPT_ENSURE(CheckQueries(tree, points, erased, rng, 20));
+
+    return true;
+}
+
+/** Enough adds after erasing folds the pending points back in with Rebuild() */
+bool UnitTests_KDTree3_Rebuild()
+{
+    static constexpr Index kCount = 2000;
+    static constexpr Index kAddedCount = 1000;
+
+    jpt::RNG rng(1234);
+
+    jpt::DynamicArray<Vec3f> points = GetRandomPoints(rng, kCount);
+    KDTree3f tree(points);
+
+    jpt::DynamicArray<bool> erased;
+    erased.Resize(points.Count(), false);
+
+    // Every 4th built point
+    for (Index i = 0; i < kCount; i += 4)
+    {
+        JPT_ENSURE(tree.Erase(points[i]));
+        erased[i] = true;
+    }
+    JPT_ENSURE(!tree.Has(points[0]));
+    JPT_ENSURE(!tree.Erase(points[0]));
+    JPT_ENSURE(tree.Count() == kCount - kCount / 4);
+
+    // Rebuilds once pending points outnumber an eighth of the tree, several times over
+    const jpt::DynamicArray<Vec3f> added = GetRandomPoints(rng, kAddedCount);
+    for (const Vec3f& point : added)
+    {
+        JPT_ENSURE(tree.Add(point) == points.Count());
+        points.EmplaceBack(point);
+        erased.EmplaceBack(false);
+    }
+    JPT_ENSURE(tree.Count() == kCount - kCount / 4 + kAddedCount);
+    JPT_ENSURE(CheckQueries(tree, points, erased, rng, 50));
+
+    // Erasing points that were folded in by a rebuild
+    for (Index i = kCount; i < points.Count(); i += 3)
+    {
+        JPT_ENSURE(tree.Erase(points[i]));
+        erased[i] = true;
+    }
+    JPT_ENSURE(CheckQueries(tree, points, erased, rng, 50));
+
+    return true;
+}
+
 export bool RunUnitTests_KDTree3()
 {
     JPT_ENSURE(UnitTests_KDTree3());
+    JPT_ENSURE(UnitTests_KDTree3_Queries());
+    JPT_ENSURE(UnitTests_KDTree3_ParallelBuild());
+    JPT_ENSURE(UnitTests_KDTree3_Rebuild());
 
     return true;
 }
@@ -147,8 +147,8 @@ bool Enum()
     }
 
     // Re-add
-    map.Add(Color::Green, Color::Name(Color::Green));
-    map.Add(Color::Cyan, Color::Name(Color::Cyan));
+    map.Add(Color::Green, jpt::ToString(Color(Color::Green)));
+    map.Add(Color::Cyan, jpt::ToString(Color(Color::Cyan)));
 
     JPT_ENSURE(map.Count() == 6);
     JPT_ENSURE(map.IsFull());
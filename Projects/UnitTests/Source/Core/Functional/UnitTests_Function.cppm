@@ -4,12 +4,14 @@ module;
 
 #include "Core/Minimal/CoreHeaders.h"
 
+#include <type_traits>
 #include <typeinfo>
 
 export module UnitTests_Function;
 
 import jpt.Function;
 import jpt.TypeDefs;
+import jpt.UniquePtr;
 import jpt.Utilities;
 
 int32 Add(int32 a, int32 b)
@@ -249,6 +251,131 @@ bool UnitTests_Function_Void()
     return true;
 }
 
+/** Counts live copies, to catch leaks and double destructions of stored callables */
+struct Counted
+{
+    static inline int32 s_liveCount = 0;
+    int32 m_value = 0;
+
+    Counted(int32 value) : m_value(value) { ++s_liveCount; }
+    Counted(const Counted& other) : m_value(other.m_value) { ++s_liveCount; }
+    Counted(Counted&& other) noexcept : m_value(other.m_value) { ++s_liveCount; }
+    ~Counted() { --s_liveCount; }
+};
+
+bool UnitTests_Function_InlineStorage()
+{
+    static_assert(sizeof(jpt::Function<void()>) == 64);
+
+    {
+        Counted counted(7);
+        auto lambda = [counted]() { return counted.m_value; };
+        static_assert(jpt::Function<int32()>::IsStoredInline<decltype(lambda)>());
+
+        jpt::Function<int32()> func1 = lambda;
+        JPT_ENSURE(Counted::s_liveCount == 3);
+
+        jpt::Function<int32()> func2 = func1;
+        JPT_ENSURE(Counted::s_liveCount == 4);
+
+        jpt::Function<int32()> func3 = Move(func1);
+        JPT_ENSURE(Counted::s_liveCount == 4);
+        JPT_ENSURE(!func1.IsConnected());
+        JPT_ENSURE(func2() == 7);
+        JPT_ENSURE(func3() == 7);
+
+        func2 = []() { return 1; };
+        JPT_ENSURE(Counted::s_liveCount == 3);
+        JPT_ENSURE(func2() == 1);
+    }
+    JPT_ENSURE(Counted::s_liveCount == 0);
+
+    // Mutable lambdas keep their state between calls
+    jpt::Function<int32()> counter = [count = 0]() mutable { return ++count; };
+    counter();
+    JPT_ENSURE(counter() == 2);
+
+    return true;
+}
+
+bool UnitTests_Function_LargeCapture()
+{
+    {
+        Counted counted(3);
+        char buffer[128] = {};
+        buffer[64] = 4;
+
+        auto lambda = [counted, buffer]() { return counted.m_value + buffer[64]; };
+        static_assert(!jpt::Function<int32()>::IsStoredInline<decltype(lambda)>());
+        static_assert(jpt::Function<int32(), 256>::IsStoredInline<decltype(lambda)>());
+
+        jpt::Function<int32()> func1 = lambda;
+        jpt::Function<int32()> func2 = func1;
+        jpt::Function<int32()> func3 = Move(func1);
+        JPT_ENSURE(Counted::s_liveCount == 4);
+        JPT_ENSURE(func2() == 7);
+        JPT_ENSURE(func3() == 7);
+
+        func3.Disconnect();
+        JPT_ENSURE(Counted::s_liveCount == 3);
+
+        jpt::Function<int32(), 256> func4 = lambda;
+        JPT_ENSURE(func4() == 7);
+    }
+    JPT_ENSURE(Counted::s_liveCount == 0);
+
+    return true;
+}
+
+bool UnitTests_Function_MoveOnly()
+{
+    jpt::MoveOnlyFunction<int32()> func1 = [pValue = jpt::MakeUnique<int32>(42)]() { return *pValue; };
+    JPT_ENSURE(func1() == 42);
+
+    jpt::MoveOnlyFunction<int32()> func2 = Move(func1);
+    JPT_ENSURE(!func1.IsConnected());
+    JPT_ENSURE(func2() == 42);
+
+    func1 = Move(func2);
+    JPT_ENSURE(func1() == 42);
+
+    static_assert(!std::is_copy_constructible_v<jpt::MoveOnlyFunction<void()>>);
+    static_assert(std::is_copy_constructible_v<jpt::Function<void()>>);
+
+    return true;
+}
+
+int32 CallWithTen(jpt::FunctionRef<int32(int32)> func)
+{
+    return func(10);
+}
+bool UnitTests_Function_FunctionRef()
+{
+    static_assert(sizeof(jpt::FunctionRef<void()>) == sizeof(void*) * 2);
+
+    // Temporary lambda, lives until the end of the call
+    JPT_ENSURE(CallWithTen([](int32 a) { return a * 2; }) == 20);
+
+    // Mutates what it references
+    int32 sum = 0;
+    auto accumulate = [&sum](int32 a) { sum += a; return sum; };
+    CallWithTen(accumulate);
+    CallWithTen(accumulate);
+    JPT_ENSURE(sum == 20);
+
+    // Global function
+    jpt::FunctionRef<int32(int32, int32)> add = &Add;
+    JPT_ENSURE(add(1, 2) == 3);
+
+    // jpt::Function
+    Test test(13);
+    jpt::Function<int32(int32)> func(&test, &Test::Add);
+    JPT_ENSURE(CallWithTen(func) == 23);
+    JPT_ENSURE(test.m_value == 23);
+
+    return true;
+}
+
 export bool RunUnitTests_Function()
 {
     JPT_ENSURE(UnitTests_Function_Global());
@@ -262,5 +389,10 @@ export bool RunUnitTests_Function()
 
     JPT_ENSURE(UnitTests_Function_Void());
 
+    JPT_ENSURE(UnitTests_Function_InlineStorage());
+    JPT_ENSURE(UnitTests_Function_LargeCapture());
+    JPT_ENSURE(UnitTests_Function_MoveOnly());
+    JPT_ENSURE(UnitTests_Function_FunctionRef());
+
     return true;
 }
@@ -7,6 +7,7 @@ module;
 export module UnitTests_Hash;
 
 import jpt.Hash;
+import jpt.String;
 import jpt.TypeDefs;
 import jpt.Utilities;
 
@@ -85,11 +86,82 @@ bool UnitTests_Hash_NonTrivialStruct()
     return true;
 }
 
+bool UnitTests_Hash_String()
+{
+    // Compile time hashes match runtime strings of every length path: empty, < 4, <= 16, <= 48, > 48
+    static constexpr const char* kTexts[] =
+    {
+        "",
+        "ab",
+        "Jupiter",
+        "Jupiter Engine!!",
+        "Jupiter Engine, word at a time",
+        "Jupiter Engine hashes 8 bytes at a time in three independent lanes",
+    };
+
+    static constexpr uint64 kExpected[] =
+    {
+        jpt::StringHash64(""),
+        jpt::StringHash64("ab"),
+        jpt::StringHash64("Jupiter"),
+        jpt::StringHash64("Jupiter Engine!!"),
+        jpt::StringHash64("Jupiter Engine, word at a time"),
+        jpt::StringHash64("Jupiter Engine hashes 8 bytes at a time in three independent lanes"),
+    };
+    static_assert(JPT_ARRAY_COUNT(kExpected) == JPT_ARRAY_COUNT(kTexts));
+
+    static_assert(jpt::StringHash64("Jupiter") == jpt::HashString("Jupiter", 7));
+    static_assert(jpt::StringHash64("Jupiter") != jpt::StringHash64("jupiter"));
+    static_assert(jpt::StringHash64(L"Jupiter") == jpt::HashString(L"Jupiter", 7));
+
+    for (size_t i = 0; i < JPT_ARRAY_COUNT(kTexts); ++i)
+    {
+        const jpt::String str = kTexts[i];
+        JPT_ENSURE(jpt::Hash(str) == kExpected[i]);
+        JPT_ENSURE(jpt::Hash(str) == jpt::HashBytes(kTexts[i], str.Count()));
+    }
+
+    // Seed changes the result
+    JPT_ENSURE(jpt::HashString("Jupiter", 7, 1) != jpt::HashString("Jupiter", 7));
+
+    // Same prefix, different lengths
+    JPT_ENSURE(jpt::HashString("Jupiter", 6) != jpt::HashString("Jupiter", 7));
+
+    return true;
+}
+
+bool UnitTests_Hash_Avalanche()
+{
+    // Flipping any input bit of a small integer flips about half of the output bits
+    for (uint64 bit = 0; bit < 64; ++bit)
+    {
+        uint32 flipped = 0;
+        for (uint64 value = 0; value < 64; ++value)
+        {
+            const uint64 difference = jpt::Hash(value) ^ jpt::Hash(value ^ (1ull << bit));
+            for (uint64 d = difference; d != 0; d &= d - 1)
+            {
+                ++flipped;
+            }
+        }
+
+        const uint32 average = flipped / 64;
+        JPT_ENSURE(average > 24 && average < 40);
+    }
+
+    JPT_ENSURE(jpt::Hash(0.0f) == jpt::Hash(-0.0f));
+    JPT_ENSURE(jpt::Hash(1.0) != jpt::Hash(2.0));
+
+    return true;
+}
+
 export bool RunUnitTests_Hash()
 {
     JPT_ENSURE(UnitTests_Hash_Primitive());
     JPT_ENSURE(UnitTests_Hash_TrivialStruct());
     JPT_ENSURE(UnitTests_Hash_NonTrivialStruct());
+    JPT_ENSURE(UnitTests_Hash_String());
+    JPT_ENSURE(UnitTests_Hash_Avalanche());
 
     return true;
 }
@@ -0,0 +1,90 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_FrameArena;
+
+import jpt.DynamicArray;
+import jpt.FrameAllocator;
+import jpt.FrameArena;
+import jpt.LinearArena;
+import jpt.String;
+import jpt.TypeDefs;
+
+using DoubleBufferedString = jpt::String_Base<char, jpt::FrameAllocator_DoubleBuffered<char>>;
+
+bool UnitTests_LinearArena()
+{
+    jpt::LinearArena arena(256);
+
+    JPT_ENSURE(arena.Allocate(0) == nullptr);
+
+    void* pFirst = arena.Allocate(3, 1);
+    void* pSecond = arena.Allocate(8, 8);
+    JPT_ENSURE(reinterpret_cast<uintptr>(pSecond) % 8 == 0);
+    JPT_ENSURE(static_cast<uint8*>(pSecond) > static_cast<uint8*>(pFirst));
+
+    // Overflow chains a new block, memory stays valid until Reset
+    uint8* pBig = static_cast<uint8*>(arena.Allocate(1000));
+    pBig[0] = 1;
+    pBig[999] = 2;
+    JPT_ENSURE(arena.GetCapacity() > 256);
+
+    // Reset merges the chain into one block that fits the peak
+    const size_t peak = arena.GetPeakBytes();
+    arena.Reset();
+    JPT_ENSURE(arena.GetUsedBytes() == 0);
+    JPT_ENSURE(arena.GetCapacity() >= peak);
+
+    // Same allocations fit without growing
+    const size_t capacity = arena.GetCapacity();
+    arena.Allocate(3, 1);
+    arena.Allocate(8, 8);
+    arena.Allocate(1000);
+    JPT_ENSURE(arena.GetCapacity() == capacity);
+
+    return true;
+}
+
+bool UnitTests_FrameAllocator()
+{
+    jpt::FrameArena& frameArena = jpt::FrameArena::GetInstance();
+    frameArena.BeginFrame();
+
+    {
+        jpt::DynamicArray<int32, jpt::FrameAllocator<int32>> numbers;
+        for (int32 i = 0; i < 100; ++i)
+        {
+            numbers.Add(i);
+        }
+        JPT_ENSURE(numbers.Count() == 100);
+        JPT_ENSURE(numbers[99] == 99);
+
+        jpt::String_Base<char, jpt::FrameAllocator<char>> str = "Scratch string built during the frame";
+        str += " and appended to";
+        JPT_ENSURE(str == "Scratch string built during the frame and appended to");
+
+        JPT_ENSURE(frameArena.GetFrameArena().GetUsedBytes() > 0);
+    }
+
+    // Double buffered data survives one BeginFrame
+    DoubleBufferedString* pMessage = jpt::FrameAllocator_DoubleBuffered<DoubleBufferedString>::New("Produced last frame, consumed this frame");
+    frameArena.BeginFrame();
+    JPT_ENSURE(frameArena.GetFrameArena().GetUsedBytes() == 0);
+    JPT_ENSURE(*pMessage == "Produced last frame, consumed this frame");
+    jpt::FrameAllocator_DoubleBuffered<DoubleBufferedString>::Delete(pMessage);
+
+    frameArena.BeginFrame();
+
+    return true;
+}
+
+export bool RunUnitTests_FrameArena()
+{
+    JPT_ENSURE(UnitTests_LinearArena());
+    JPT_ENSURE(UnitTests_FrameAllocator());
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <cstring>
+#include <thread>
+
+export module UnitTests_MemoryPool;
+
+import jpt.Atomic;
+import jpt.MemoryPool;
+import jpt.MemoryPool_ThreadCached;
+import jpt.DynamicArray;
+import jpt.HashSet;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+static const jpt::MemoryPool::Config kConfig
+{
+    .blockSize = 32,
+    .blocksPerChunk = 128,
+    .initialChunks = 1,
+    .maxChunks = 4,
+    .alignment = 8
+};
+
+template<typename TPool>
+bool UnitTests_MemoryPool_SingleThread()
+{
+    TPool pool(kConfig);
+
+    // Exhaust the pool, every block should be unique and aligned
+    jpt::DynamicArray<void*> blocks;
+    jpt::HashSet<uintptr> addresses;
+    const size_t capacity = kConfig.blocksPerChunk * kConfig.maxChunks;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        void* pBlock = pool.New();
+        JPT_ENSURE(pBlock != nullptr);
+        JPT_ENSURE(reinterpret_cast<uintptr>(pBlock) % kConfig.alignment == 0);
+
+        std::memset(pBlock, static_cast<int32>(i & 0xFF), kConfig.blockSize);
+
+        addresses.Add(reinterpret_cast<uintptr>(pBlock));
+        blocks.Add(pBlock);
+    }
+    JPT_ENSURE(addresses.Count() == capacity);
+    JPT_ENSURE(pool.New() == nullptr);
+
+    // Writes should not have overlapped
+    for (size_t i = 0; i < blocks.Count(); ++i)
+    {
+        const uint8* pBytes = static_cast<const uint8*>(blocks[i]);
+        JPT_ENSURE(pBytes[0] == static_cast<uint8>(i & 0xFF));
+        JPT_ENSURE(pBytes[kConfig.blockSize - 1] == static_cast<uint8>(i & 0xFF));
+    }
+
+    // Freed blocks are reusable
+    for (void* pBlock : blocks)
+    {
+        pool.Delete(pBlock);
+    }
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        blocks[i] = pool.New();
+        JPT_ENSURE(blocks[i] != nullptr);
+    }
+    for (void* pBlock : blocks)
+    {
+        pool.Delete(pBlock);
+    }
+
+    pool.Delete(nullptr);
+
+    return true;
+}
+
+bool UnitTests_MemoryPool_ThreadCached_MultiThread()
+{
+    static constexpr size_t kThreadsCount = 8;
+    static constexpr size_t kRounds = 1'000;
+    static constexpr size_t kBurst = 32;
+
+    jpt::MemoryPool_ThreadCached pool(kConfig);
+    jpt::Atomic<size_t> failures = 0;
+
+    jpt::DynamicArray<std::thread> threads;
+    threads.Reserve(kThreadsCount);
+    for (size_t t = 0; t < kThreadsCount; ++t)
+    {
+        threads.EmplaceBack([&pool, &failures, t]()
+            {
+                uint64* blocks[kBurst];
+                for (size_t round = 0; round < kRounds; ++round)
+                {
+                    for (size_t i = 0; i < kBurst; ++i)
+                    {
+                        blocks[i] = static_cast<uint64*>(pool.New());
+                        *blocks[i] = (t << 32) | i;
+                    }
+                    for (size_t i = 0; i < kBurst; ++i)
+                    {
+                        if (*blocks[i] != ((t << 32) | i))
+                        {
+                            ++failures;
+                        }
+                        pool.Delete(blocks[i]);
+                    }
+                }
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    JPT_ENSURE(failures == 0);
+
+    // Every block went back to the shared list when the worker threads exited
+    pool.FlushThreadCache();
+    jpt::DynamicArray<void*> blocks;
+    for (size_t i = 0; i < kConfig.blocksPerChunk * kConfig.maxChunks; ++i)
+    {
+        void* pBlock = pool.New();
+        JPT_ENSURE(pBlock != nullptr);
+        blocks.Add(pBlock);
+    }
+    for (void* pBlock : blocks)
+    {
+        pool.Delete(pBlock);
+    }
+
+    return true;
+}
+
+export bool RunUnitTests_MemoryPool()
+{
+    JPT_ENSURE(UnitTests_MemoryPool_SingleThread<jpt::MemoryPool>());
+    JPT_ENSURE(UnitTests_MemoryPool_SingleThread<jpt::MemoryPool_ThreadCached>());
+    JPT_ENSURE(UnitTests_MemoryPool_ThreadCached_MultiThread());
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_PoolAllocator;
+
+import jpt.DynamicArray;
+import jpt.PoolAllocator;
+import jpt.SizeClassAllocator;
+import jpt.String;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+using PoolString = jpt::String_Base<char, jpt::PoolAllocator<char>>;
+
+bool UnitTests_SizeClassAllocator()
+{
+    jpt::SizeClassAllocator& allocator = jpt::SizeClassAllocator::GetInstance();
+
+    JPT_ENSURE(jpt::SizeClassAllocator::GetSizeClass(1) == 0);
+    JPT_ENSURE(jpt::SizeClassAllocator::GetSizeClass(16) == 0);
+    JPT_ENSURE(jpt::SizeClassAllocator::GetSizeClass(17) == 1);
+    JPT_ENSURE(jpt::SizeClassAllocator::GetSizeClass(2048) == jpt::SizeClassAllocator::kSizeClassesCount - 1);
+    JPT_ENSURE(jpt::SizeClassAllocator::GetSizeClass(2049) == jpt::SizeClassAllocator::kLargeClass);
+
+    // Small allocation hits its bin
+    const uint32 sizeClass = jpt::SizeClassAllocator::GetSizeClass(100);
+    const jpt::SizeClassAllocator::Stats stats = allocator.GetStats(sizeClass);
+
+    void* pSmall = allocator.Allocate(100);
+    JPT_ENSURE(pSmall != nullptr);
+    JPT_ENSURE(reinterpret_cast<uintptr>(pSmall) % 16 == 0);
+    JPT_ENSURE(allocator.GetAllocationSize(pSmall) == 100);
+    JPT_ENSURE(allocator.GetStats(sizeClass).hits == stats.hits + 1);
+    JPT_ENSURE(allocator.GetStats(sizeClass).bytesInUse == stats.bytesInUse + 100);
+
+    allocator.Deallocate(pSmall);
+    JPT_ENSURE(allocator.GetStats(sizeClass).bytesInUse == stats.bytesInUse);
+
+    // Large and over-aligned allocations go to the OS
+    const uint64 largeMisses = allocator.GetLargeStats().misses;
+
+    void* pLarge = allocator.Allocate(10'000);
+    void* pAligned = allocator.Allocate(32, 64);
+    JPT_ENSURE(pLarge != nullptr);
+    JPT_ENSURE(reinterpret_cast<uintptr>(pAligned) % 64 == 0);
+    JPT_ENSURE(allocator.GetLargeStats().misses == largeMisses + 2);
+
+    allocator.Deallocate(pLarge);
+    allocator.Deallocate(pAligned);
+    allocator.Deallocate(nullptr);
+
+    return true;
+}
+
+bool UnitTests_PoolAllocator_DynamicArray()
+{
+    jpt::DynamicArray<int32, jpt::PoolAllocator<int32>> numbers;
+    for (int32 i = 0; i < 1000; ++i)
+    {
+        numbers.Add(i);
+    }
+
+    for (int32 i = 0; i < 1000; ++i)
+    {
+        JPT_ENSURE(numbers[i] == i);
+    }
+
+    jpt::DynamicArray<int32, jpt::PoolAllocator<int32>> copy = numbers;
+    numbers.Clear();
+    JPT_ENSURE(numbers.IsEmpty());
+    JPT_ENSURE(copy.Count() == 1000);
+    JPT_ENSURE(copy.Back() == 999);
+
+    jpt::DynamicArray<PoolString, jpt::PoolAllocator<PoolString>> strings;
+    strings.Add("Jupiter");
+    strings.Add("A string long enough to skip the small buffer");
+    JPT_ENSURE(strings[0] == "Jupiter");
+    JPT_ENSURE(strings[1] == "A string long enough to skip the small buffer");
+
+    return true;
+}
+
+bool UnitTests_PoolAllocator_String()
+{
+    PoolString str = "Hello";
+    str += ", World! This one spills out of the small buffer";
+    JPT_ENSURE(str == "Hello, World! This one spills out of the small buffer");
+
+    PoolString copy = str;
+    JPT_ENSURE(copy == str);
+    JPT_ENSURE(copy.ConstBuffer() != str.ConstBuffer());
+
+    PoolString moved = jpt::Move(copy);
+    JPT_ENSURE(moved == str);
+    JPT_ENSURE(copy.IsEmpty());
+
+    JPT_ENSURE(str.SubStr(0, 5) == "Hello");
+
+    return true;
+}
+
+export bool RunUnitTests_PoolAllocator()
+{
+    JPT_ENSURE(UnitTests_SizeClassAllocator());
+    JPT_ENSURE(UnitTests_PoolAllocator_DynamicArray());
+    JPT_ENSURE(UnitTests_PoolAllocator_String());
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_NumberConversion;
+
+import jpt.Constants;
+import jpt.NumberConversion;
+import jpt.String;
+import jpt.ToString;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+template<typename TInt>
+static bool RoundTripInteger(TInt value, EIntBase base = EIntBase::Decimal)
+{
+    char buffer[jpt::kMaxIntegerChars];
+    const Index count = jpt::WriteInteger(buffer, value, base);
+
+    TInt parsed = 0;
+    const jpt::ParseResult result = jpt::ParseInteger(buffer, count, parsed, base);
+    return result.IsValid() && result.count == count && parsed == value;
+}
+
+template<typename TFloat>
+static bool RoundTripFloat(TFloat value)
+{
+    char buffer[jpt::kMaxFloatChars];
+    const Index count = jpt::WriteFloat(buffer, value);
+
+    TFloat parsed = 0;
+    const jpt::ParseResult result = jpt::ParseFloat(buffer, count, parsed);
+    return result.IsValid() && result.count == count && parsed == value;
+}
+
+static bool UnitTests_NumberConversion_WriteInteger()
+{
+    static_assert([]()
+        {
+            char buffer[jpt::kMaxIntegerChars];
+            return jpt::WriteInteger(buffer, -42) == 3 && buffer[0] == '-' && buffer[1] == '4' && buffer[2] == '2';
+        }());
+
+    char buffer[jpt::kMaxIntegerChars];
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, 0)) == "0");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, 1234567890)) == "1234567890");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, jpt::kMin<int64>)) == "-9223372036854775808");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, jpt::kMax<uint64>)) == "18446744073709551615");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, 255, EIntBase::Hex)) == "0xFF");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteInteger(buffer, 5, EIntBase::Binary)) == "101");
+
+    wchar_t wideBuffer[jpt::kMaxIntegerChars];
+    JPT_ENSURE(jpt::WString(wideBuffer, jpt::WriteInteger(wideBuffer, -7)) == L"-7");
+
+    for (int64 value = -100'000; value <= 100'000; value += 7)
+    {
+        JPT_ENSURE(RoundTripInteger(value));
+        JPT_ENSURE(RoundTripInteger(value, EIntBase::Hex));
+    }
+    JPT_ENSURE(RoundTripInteger(jpt::kMin<int8>));
+    JPT_ENSURE(RoundTripInteger(jpt::kMax<uint16>, EIntBase::Octal));
+    JPT_ENSURE(RoundTripInteger(jpt::kMin<int64>, EIntBase::Binary));
+
+    JPT_ENSURE(jpt::ToString(-42) == "-42");
+
+    return true;
+}
+
+static bool UnitTests_NumberConversion_ParseInteger()
+{
+    int32 value = 0;
+
+    jpt::ParseResult result = jpt::ParseInteger("123abc", 6, value);
+    JPT_ENSURE(result.IsValid() && result.count == 3 && value == 123);
+
+    result = jpt::ParseInteger("0x1f", 4, value, EIntBase::Hex);
+    JPT_ENSURE(result.IsValid() && result.count == 4 && value == 31);
+
+    result = jpt::ParseInteger("abc", 3, value);
+    JPT_ENSURE(result.error == jpt::ParseError::Invalid && result.count == 0);
+
+    result = jpt::ParseInteger("-", 1, value);
+    JPT_ENSURE(result.error == jpt::ParseError::Invalid);
+
+    int8 small = 0;
+    JPT_ENSURE(jpt::ParseInteger("-128", 4, small).IsValid() && small == -128);
+    JPT_ENSURE(jpt::ParseInteger("128", 3, small).error == jpt::ParseError::OutOfRange);
+
+    uint64 big = 0;
+    result = jpt::ParseInteger("18446744073709551616 ", 21, big);
+    JPT_ENSURE(result.error == jpt::ParseError::OutOfRange && result.count == 20);
+    JPT_ENSURE(jpt::ParseInteger("-1", 2, big).error == jpt::ParseError::Invalid);
+
+    return true;
+}
+
+static bool UnitTests_NumberConversion_Float()
+{
+    char buffer[jpt::kMaxFloatChars];
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteFloat(buffer, 0.1f)) == "0.1");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteFloat(buffer, -2.5)) == "-2.5");
+    JPT_ENSURE(jpt::String(buffer, jpt::WriteFloat(buffer, 1e300)) == "1e+300");
+    JPT_ENSURE(jpt::ToString(1.55f) == "1.55");
+
+    JPT_ENSURE(RoundTripFloat(3.14159265358979));
+    JPT_ENSURE(RoundTripFloat(0.1f + 0.2f));
+    JPT_ENSURE(RoundTripFloat(jpt::kMax<float64>));
+    JPT_ENSURE(RoundTripFloat(jpt::kMin<float32>));
+    JPT_ENSURE(RoundTripFloat(-0.0));
+
+    float32 value = 0.0f;
+    jpt::ParseResult result = jpt::ParseFloat("3.14159f", 8, value);
+    JPT_ENSURE(result.IsValid() && result.count == 7 && value == 3.14159f);
+
+    result = jpt::ParseFloat(L"-2.5e-3", 7, value);
+    JPT_ENSURE(result.IsValid() && value == -2.5e-3f);
+
+    float64 precise = 0.0;
+    JPT_ENSURE(jpt::ParseFloat("1e999", 5, precise).error == jpt::ParseError::OutOfRange);
+    JPT_ENSURE(jpt::ParseFloat("abc", 3, precise).error == jpt::ParseError::Invalid);
+
+    // Correctly rounded, not accumulated digit by digit
+    JPT_ENSURE(jpt::ParseFloat("0.30000000000000004", 19, precise).IsValid() && precise == 0.1 + 0.2);
+
+    return true;
+}
+
+export bool RunUnitTests_NumberConversion()
+{
+    JPT_ENSURE(UnitTests_NumberConversion_WriteInteger());
+    JPT_ENSURE(UnitTests_NumberConversion_ParseInteger());
+    JPT_ENSURE(UnitTests_NumberConversion_Float());
+
+    return true;
+}
\ No newline at end of file
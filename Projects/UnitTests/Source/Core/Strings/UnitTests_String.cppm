@@ -14,6 +14,7 @@ import jpt.Math;
 import jpt.Rand;
 import jpt.String;
 import jpt.StringHelpers;
+import jpt.StringSearch;
 import jpt.StringView;
 import jpt.ToString;
 import jpt.TypeDefs;
@@ -777,6 +778,56 @@ bool UnitTests_WString_Count()
     return true;
 }
 
+bool UnitTests_String_LongSearch()
+{
+    // Same results at compile time
+    static_assert(jpt::FindString("Hello Jupiter", 13, "Jupiter", 7) == 6);
+    static_assert(jpt::FindChar("Hello Jupiter", 13, 'J') == 6);
+    static_assert(jpt::CountChar("Hello Jupiter", 13, 'l') == 2);
+    static_assert(jpt::FindMismatch("Hello", "Help!", 5) == 3);
+
+    // Long enough for several vectors plus a tail, matches straddling vector boundaries
+    jpt::String str;
+    for (int32 i = 0; i < 37; ++i)
+    {
+        str += "abcdefg";
+    }
+    str += "Jupiter";
+
+    JPT_ENSURE(str.Find('J') == 259);
+    JPT_ENSURE(str.Find('J', 260) == kInvalidIndex);
+    JPT_ENSURE(str.Find("Jupiter") == 259);
+    JPT_ENSURE(str.Find("gabc", 30) == 34);
+    JPT_ENSURE(str.Find("gabcdefgJ") == 251);
+    JPT_ENSURE(str.Find("Jupiter!") == kInvalidIndex);
+    JPT_ENSURE(str.Count('a') == 37);
+    JPT_ENSURE(str.Count("fga") == 36);
+
+    jpt::String copy = str;
+    JPT_ENSURE(copy == str);
+    copy[200] = 'X';
+    JPT_ENSURE(!(copy == str));
+    JPT_ENSURE(jpt::StrCmp(copy.ConstBuffer(), str.ConstBuffer(), str.Count()) == 200);
+
+    copy.Replace("abc", "_");
+    JPT_ENSURE(copy.Count() == str.Count() - 37 * 2);
+    JPT_ENSURE(copy.Count('_') == 37);
+
+    jpt::WString wstr;
+    for (int32 i = 0; i < 37; ++i)
+    {
+        wstr += L"abcdefg";
+    }
+    wstr += L"Jupiter";
+
+    JPT_ENSURE(wstr.Find(L'J') == 259);
+    JPT_ENSURE(wstr.Find(L"gabcdefgJ") == 251);
+    JPT_ENSURE(wstr.Count(L'a') == 37);
+    JPT_ENSURE(wstr.Count(L"fga") == 36);
+
+    return true;
+}
+
 export bool RunUnitTests_String()
 {
     //JPT_SCOPED_TIMING_PROFILER("String");
@@ -857,6 +908,8 @@ export bool RunUnitTests_String()
 
         JPT_ENSURE(UnitTests_String_Count());
         JPT_ENSURE(UnitTests_WString_Count());
+
+        JPT_ENSURE(UnitTests_String_LongSearch());
     }
 
     return true;
@@ -8,7 +8,10 @@ module;
 
 export module UnitTests_StringView;
 
+import jpt.DynamicArray;
 import jpt.String;
+import jpt.StringHelpers;
+import jpt.StringTokenizer;
 import jpt.StringView;
 import jpt.Utilities;
 
@@ -56,9 +59,108 @@ bool UnitTests_StringView()
     return true;
 }
 
+bool UnitTests_StringView_SubStrView()
+{
+    const jpt::String str = "Jupiter Engine";
+
+    const jpt::StringView subStr = jpt::SubStrView(str, 8, 6);
+    JPT_ENSURE(subStr == "Engine");
+    JPT_ENSURE(subStr.ConstBuffer() == str.ConstBuffer() + 8);
+
+    JPT_ENSURE(jpt::SubStrView(str, 8) == "Engine");
+    JPT_ENSURE(jpt::SubStrView(str, 0, 7) == "Jupiter");
+
+    return true;
+}
+
+bool UnitTests_StringView_Split()
+{
+    const jpt::StringView text = "Name,,Address,Phone";
+
+    jpt::DynamicArray<jpt::StringView> tokens;
+    for (const jpt::StringView token : jpt::SplitView(text, ','))
+    {
+        tokens.EmplaceBack(token);
+    }
+    JPT_ENSURE(tokens.Count() == 4);
+    JPT_ENSURE(tokens[0] == "Name");
+    JPT_ENSURE(tokens[1].IsEmpty());
+    JPT_ENSURE(tokens[2] == "Address");
+    JPT_ENSURE(tokens[3] == "Phone");
+
+    // Tokens point into the original text
+    JPT_ENSURE(tokens[2].ConstBuffer() == text.ConstBuffer() + 6);
+
+    JPT_ENSURE(jpt::SplitView(text, ',', true).Count() == 3);
+    JPT_ENSURE(jpt::SplitView(text, ';').Count() == 1);
+    JPT_ENSURE(jpt::SplitView("", ',').Count() == 1);
+    JPT_ENSURE(jpt::SplitView("", ',', true).Count() == 0);
+    JPT_ENSURE(jpt::SplitView("a,b,", ',').Count() == 3);
+
+    // String delimiter
+    tokens.Clear();
+    for (const jpt::StringView token : jpt::SplitView("One::Two::::Three", "::", true))
+    {
+        tokens.EmplaceBack(token);
+    }
+    JPT_ENSURE(tokens.Count() == 3);
+    JPT_ENSURE(tokens[0] == "One");
+    JPT_ENSURE(tokens[1] == "Two");
+    JPT_ENSURE(tokens[2] == "Three");
+
+    // Wide
+    const jpt::WString wide = L"Jupiter Engine";
+    JPT_ENSURE(jpt::SplitView(wide, L' ').Count() == 2);
+    JPT_ENSURE(*jpt::SplitView(wide, L' ').begin() == L"Jupiter");
+
+    return true;
+}
+
+bool UnitTests_StringView_SplitLines()
+{
+    jpt::DynamicArray<jpt::StringView> lines;
+    for (const jpt::StringView line : jpt::SplitLines("First\r\nSecond\n\nFourth\r\n"))
+    {
+        lines.EmplaceBack(line);
+    }
+    JPT_ENSURE(lines.Count() == 4);
+    JPT_ENSURE(lines[0] == "First");
+    JPT_ENSURE(lines[1] == "Second");
+    JPT_ENSURE(lines[2].IsEmpty());
+    JPT_ENSURE(lines[3] == "Fourth");
+
+    JPT_ENSURE(jpt::SplitLines("First\r\nSecond\n\nFourth", true).Count() == 3);
+    JPT_ENSURE(jpt::SplitLines("").Count() == 0);
+    JPT_ENSURE(jpt::SplitLines("\n").Count() == 1);
+    JPT_ENSURE(*jpt::SplitLines("Last\r").begin() == "Last");
+
+    return true;
+}
+
+bool UnitTests_StringView_SplitIf()
+{
+    jpt::DynamicArray<jpt::StringView> words;
+    for (const jpt::StringView word : jpt::SplitViewIf(" Jupiter \t Engine\n", jpt::IsSpace<char>, true))
+    {
+        words.EmplaceBack(word);
+    }
+    JPT_ENSURE(words.Count() == 2);
+    JPT_ENSURE(words[0] == "Jupiter");
+    JPT_ENSURE(words[1] == "Engine");
+
+    const auto isSeparator = [](char c) { return c == ',' || c == ';'; };
+    JPT_ENSURE(jpt::SplitViewIf("1,2;3", isSeparator).Count() == 3);
+
+    return true;
+}
+
 export bool RunUnitTests_StringView()
 {
     JPT_ENSURE(UnitTests_StringView());
+    JPT_ENSURE(UnitTests_StringView_SubStrView());
+    JPT_ENSURE(UnitTests_StringView_Split());
+    JPT_ENSURE(UnitTests_StringView_SplitLines());
+    JPT_ENSURE(UnitTests_StringView_SplitIf());
 
     return true;
 }
\ No newline at end of file
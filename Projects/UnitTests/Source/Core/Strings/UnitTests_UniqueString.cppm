@@ -0,0 +1,112 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <thread>
+
+export module UnitTests_UniqueString;
+
+import jpt.DynamicArray;
+import jpt.Hash;
+import jpt.String;
+import jpt.TypeDefs;
+import jpt.UniqueString;
+import jpt.Utilities;
+
+static bool UnitTests_UniqueString_Intern()
+{
+    const jpt::UniqueString hello("Hello");
+    const jpt::UniqueString hello2(jpt::String("Hello"));
+    const jpt::UniqueString world("Hello World", 11);
+    const jpt::UniqueString helloPrefix("Hello World", 5);
+
+    JPT_ENSURE(hello == hello2);
+    JPT_ENSURE(hello == helloPrefix);
+    JPT_ENSURE(!(hello == world));
+
+    JPT_ENSURE(*hello == "Hello");
+    JPT_ENSURE(*world == "Hello World");
+    JPT_ENSURE(&*hello == &*hello2);
+    JPT_ENSURE(hello.GetHash() == jpt::Hash(jpt::String("Hello")));
+
+    return true;
+}
+
+static bool UnitTests_UniqueString_Grow()
+{
+    // Enough to grow the index a few times. Handles made before stay valid
+    const jpt::UniqueString first("Grow_First");
+    const size_t countBefore = jpt::UniqueString::Count();
+
+    for (int32 i = 0; i < 5000; ++i)
+    {
+        const jpt::UniqueString name(jpt::String::Format<32>("Grow_%d", i));
+        JPT_ENSURE(*name == jpt::String::Format<32>("Grow_%d", i));
+    }
+
+    JPT_ENSURE(jpt::UniqueString::Count() == countBefore + 5000);
+    JPT_ENSURE(*first == "Grow_First");
+    JPT_ENSURE(jpt::UniqueString("Grow_First") == first);
+    JPT_ENSURE(*jpt::UniqueString("Grow_4999") == "Grow_4999");
+    JPT_ENSURE(jpt::UniqueString::Count() == countBefore + 5000);
+
+    return true;
+}
+
+static bool UnitTests_UniqueString_Threads()
+{
+    // Every thread interns the same names, overlapping with the others
+    static constexpr int32 kThreadsCount = 8;
+    static constexpr int32 kNamesCount = 2000;
+
+    jpt::DynamicArray<const jpt::String*> results[kThreadsCount];
+    std::thread threads[kThreadsCount];
+
+    for (int32 t = 0; t < kThreadsCount; ++t)
+    {
+        threads[t] = std::thread([t, &results]()
+            {
+                jpt::DynamicArray<const jpt::String*>& interned = results[t];
+                interned.Resize(kNamesCount, nullptr);
+
+                for (int32 i = 0; i < kNamesCount; ++i)
+                {
+                    // Each thread walks the names from a different start
+                    const int32 index = (i + t * 250) % kNamesCount;
+                    const jpt::UniqueString name(jpt::String::Format<32>("Thread_%d", index));
+                    interned[index] = &*name;
+                }
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // One entry per name, whichever thread added it
+    bool isCorrect = true;
+    for (int32 i = 0; i < kNamesCount; ++i)
+    {
+        const jpt::UniqueString expected(jpt::String::Format<32>("Thread_%d", i));
+        for (int32 t = 0; t < kThreadsCount; ++t)
+        {
+            isCorrect &= results[t][i] == &*expected;
+        }
+    }
+
+    JPT_ENSURE(isCorrect);
+
+    return true;
+}
+
+export bool RunUnitTests_UniqueString()
+{
+    JPT_ENSURE(UnitTests_UniqueString_Intern());
+    JPT_ENSURE(UnitTests_UniqueString_Grow());
+    JPT_ENSURE(UnitTests_UniqueString_Threads());
+
+    return true;
+}
\ No newline at end of file
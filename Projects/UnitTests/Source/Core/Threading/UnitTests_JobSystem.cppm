@@ -0,0 +1,153 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <atomic>
+
+export module UnitTests_JobSystem;
+
+import jpt.JobSystem;
+import jpt.DynamicArray;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+static bool UnitTests_JobSystem_Counter()
+{
+    jpt::JobSystem& jobSystem = jpt::JobSystem::GetInstance();
+
+    std::atomic<int32> sum = 0;
+    jpt::JobCounter counter;
+
+    for (int32 i = 1; i <= 1000; ++i)
+    {
+        jobSystem.Run([&sum, i]() { sum.fetch_add(i); }, &counter);
+    }
+    jobSystem.WaitFor(counter);
+
+    JPT_ENSURE(counter.IsDone());
+    JPT_ENSURE(sum == 1000 * 1001 / 2);
+
+    return true;
+}
+
+static bool UnitTests_JobSystem_Dependency()
+{
+    jpt::JobSystem& jobSystem = jpt::JobSystem::GetInstance();
+
+    jpt::DynamicArray<int32> data(4096, 1);
+    int64 total = 0;
+
+    jpt::JobCounter doubled;
+    jpt::JobCounter summed;
+
+    for (size_t begin = 0; begin < data.Count(); begin += 256)
+    {
+        jobSystem.Run([&data, begin]()
+            {
+                for (size_t i = begin; i < begin + 256; ++i)
+                {
+                    data[i] *= 2;
+                }
+            }, &doubled);
+    }
+
+    // Queued before the doubling is done, must not start until it is
+    jobSystem.Run([&data, &total]()
+        {
+            for (int32 value : data)
+            {
+                total += value;
+            }
+        }, &summed, &doubled);
+
+    jobSystem.WaitFor(summed);
+
+    JPT_ENSURE(doubled.IsDone());
+    JPT_ENSURE(total == 4096 * 2);
+
+    return true;
+}
+
+static bool UnitTests_JobSystem_Nested()
+{
+    jpt::JobSystem& jobSystem = jpt::JobSystem::GetInstance();
+
+    // Jobs spawning and waiting for jobs. WaitFor() runs other work, so this can't deadlock even with no workers
+    std::atomic<int32> leaves = 0;
+    jpt::JobCounter outer;
+
+    for (int32 i = 0; i < 16; ++i)
+    {
+        jobSystem.Run([&jobSystem, &leaves]()
+            {
+                jpt::JobCounter inner;
+                for (int32 j = 0; j < 16; ++j)
+                {
+                    jobSystem.Run([&leaves]() { leaves.fetch_add(1); }, &inner);
+                }
+                jobSystem.WaitFor(inner);
+            }, &outer);
+    }
+    jobSystem.WaitFor(outer);
+
+    JPT_ENSURE(leaves == 16 * 16);
+
+    return true;
+}
+
+static bool UnitTests_JobSystem_ParallelFor()
+{
+    jpt::DynamicArray<int32> data(10'000, 0);
+
+    jpt::JobSystem::GetInstance().ParallelFor(data.Count(), 64, [&data](size_t i)
+        {
+            data[i] = static_cast<int32>(i);
+        });
+
+    for (size_t i = 0; i < data.Count(); ++i)
+    {
+        JPT_ENSURE(data[i] == static_cast<int32>(i));
+    }
+
+    return true;
+}
+
+static bool UnitTests_JobSystem_CounterLifetime()
+{
+    jpt::JobSystem& jobSystem = jpt::JobSystem::GetInstance();
+
+    // Stack counters destroyed right after WaitFor(), while the last Decrement() may still be releasing waiters
+    std::atomic<int32> leaves = 0;
+    jobSystem.ParallelFor(2000, 1, [&jobSystem, &leaves](size_t)
+        {
+            jpt::JobCounter counter;
+            jpt::JobCounter dependent;
+            jobSystem.Run([&leaves]() { leaves.fetch_add(1); }, &counter);
+            jobSystem.Run([&leaves]() { leaves.fetch_add(1); }, &counter);
+            jobSystem.Run([&leaves]() { leaves.fetch_add(1); }, &dependent, &counter);
+            jobSystem.WaitFor(dependent);
+            jobSystem.WaitFor(counter);
+        });
+    JPT_ENSURE(leaves == 2000 * 3);
+
+    for (int32 i = 0; i < 2000; ++i)
+    {
+        jobSystem.ParallelFor(4, 1, [&leaves](size_t) { leaves.fetch_sub(1); });
+    }
+    JPT_ENSURE(leaves == 2000 * 3 - 2000 * 4);
+
+    return true;
+}
+
+export bool RunUnitTests_JobSystem()
+{
+    JPT_ENSURE(UnitTests_JobSystem_Counter());
+    JPT_ENSURE(UnitTests_JobSystem_Dependency());
+    JPT_ENSURE(UnitTests_JobSystem_Nested());
+    JPT_ENSURE(UnitTests_JobSystem_ParallelFor());
+    JPT_ENSURE(UnitTests_JobSystem_CounterLifetime());
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <atomic>
+#include <thread>
+
+export module UnitTests_LockFreeQueue;
+
+import jpt.DynamicArray;
+import jpt.LockFreeQueue_MPMC;
+import jpt.LockFreeQueue_SPSC;
+import jpt.Optional;
+import jpt.String;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+template<typename TQueue>
+static bool UnitTests_LockFreeQueue_SingleThread()
+{
+    TQueue queue(4);
+    JPT_ENSURE(queue.IsEmpty());
+    JPT_ENSURE(queue.Capacity() == 4);
+
+    // Fill up, wrapping around the ring twice
+    for (int32 lap = 0; lap < 2; ++lap)
+    {
+        JPT_ENSURE(queue.TryPush(jpt::String("A")));
+        JPT_ENSURE(queue.TryPush(jpt::String("B")));
+        JPT_ENSURE(queue.TryPush(jpt::String("C")));
+        JPT_ENSURE(queue.TryPush(jpt::String("D")));
+        JPT_ENSURE(!queue.TryPush(jpt::String("E")));
+        JPT_ENSURE(queue.Count() == 4);
+
+        JPT_ENSURE(queue.TryPop().Value() == "A");
+        JPT_ENSURE(queue.TryPop().Value() == "B");
+        JPT_ENSURE(queue.TryPop().Value() == "C");
+        JPT_ENSURE(queue.TryPop().Value() == "D");
+        JPT_ENSURE(!queue.TryPop());
+        JPT_ENSURE(queue.IsEmpty());
+    }
+
+    // Batches are cut at capacity
+    const jpt::String values[6] = { "0", "1", "2", "3", "4", "5" };
+    JPT_ENSURE(queue.TryPushBatch(values, 6) == 4);
+    JPT_ENSURE(queue.TryPushBatch(values + 4, 2) == 0);
+
+    jpt::String popped[6];
+    JPT_ENSURE(queue.TryPopBatch(popped, 3) == 3);
+    JPT_ENSURE(popped[0] == "0" && popped[1] == "1" && popped[2] == "2");
+    JPT_ENSURE(queue.TryPopBatch(popped, 6) == 1);
+    JPT_ENSURE(popped[0] == "3");
+
+    // Leftovers are destroyed with the queue
+    queue.TryPush(jpt::String("Leftover"));
+
+    return true;
+}
+
+static bool UnitTests_LockFreeQueue_SPSC_Threads()
+{
+    constexpr uint64 kCount = 100'000;
+
+    jpt::LockFreeQueue_SPSC<uint64> queue(256);
+    uint64 sum = 0;
+    uint64 expected = 0;
+    bool isOrdered = true;
+
+    std::thread consumer([&queue, &sum, &expected, &isOrdered]()
+        {
+            while (jpt::Optional<uint64> value = queue.WaitPop())
+            {
+                isOrdered &= value.Value() == expected;
+                ++expected;
+                sum += value.Value();
+            }
+        });
+
+    for (uint64 i = 0; i < kCount; ++i)
+    {
+        queue.Push(i);
+    }
+    queue.Terminate();
+    consumer.join();
+
+    JPT_ENSURE(isOrdered);
+    JPT_ENSURE(expected == kCount);
+    JPT_ENSURE(sum == kCount * (kCount - 1) / 2);
+
+    return true;
+}
+
+static bool UnitTests_LockFreeQueue_MPMC_Threads()
+{
+    constexpr size_t kThreadsCount = 4;
+    constexpr uint64 kCountPerProducer = 25'000;
+
+    jpt::LockFreeQueue_MPMC<uint64> queue(256);
+    std::atomic<uint64> sum = 0;
+    std::atomic<uint64> poppedCount = 0;
+
+    jpt::DynamicArray<std::thread> consumers;
+    for (size_t i = 0; i < kThreadsCount; ++i)
+    {
+        consumers.EmplaceBack([&queue, &sum, &poppedCount]()
+            {
+                while (jpt::Optional<uint64> value = queue.WaitPop())
+                {
+                    sum.fetch_add(value.Value());
+                    poppedCount.fetch_add(1);
+                }
+            });
+    }
+
+    jpt::DynamicArray<std::thread> producers;
+    for (size_t i = 0; i < kThreadsCount; ++i)
+    {
+        producers.EmplaceBack([&queue]()
+            {
+                for (uint64 j = 0; j < kCountPerProducer; ++j)
+                {
+                    queue.Push(j);
+                }
+            });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    queue.Terminate();
+    for (std::thread& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    JPT_ENSURE(poppedCount == kThreadsCount * kCountPerProducer);
+    JPT_ENSURE(sum == kThreadsCount * (kCountPerProducer * (kCountPerProducer - 1) / 2));
+
+    return true;
+}
+
+export bool RunUnitTests_LockFreeQueue()
+{
+    JPT_ENSURE(UnitTests_LockFreeQueue_SingleThread<jpt::LockFreeQueue_SPSC<jpt::String>>());
+    JPT_ENSURE(UnitTests_LockFreeQueue_SingleThread<jpt::LockFreeQueue_MPMC<jpt::String>>());
+    JPT_ENSURE(UnitTests_LockFreeQueue_SPSC_Threads());
+    JPT_ENSURE(UnitTests_LockFreeQueue_MPMC_Threads());
+
+    return true;
+}
\ No newline at end of file
@@ -241,11 +241,11 @@ JPT_ENUM_UINT32(EColor_Local,
     Blue   = 0x0000FF00,
     Alpha  = 0x000000FF,
     
-    //White  = Red | Green | Blue | Alpha,
-    //Black  = 0x00000000,
-    //Purple = Red | Blue,
+    White  = Red | Green | Blue | Alpha,
+    Black  = 0x00000000,
+    Purple = Red | Blue,
     Yellow = 0xFFFF0000,
-    //Cyan   = Green | Blue,
+    Cyan   = Green | Blue,
 );
 bool UnitTests_Enum_Hex()
 {
@@ -254,6 +254,68 @@ bool UnitTests_Enum_Hex()
     
     JPT_ENSURE(color == EColor_Local::Yellow);
 
+    // Expressions of earlier values
+    JPT_ENSURE(EColor_Local::White == 0xFFFFFFFF);
+    JPT_ENSURE(EColor_Local(EColor_Local::Purple) == "Purple");
+    JPT_ENSURE(EColor_Local::FromName("Cyan") == EColor_Local::Cyan);
+
+    return true;
+}
+
+JPT_ENUM_UINT8(EAlias_Local,
+    First,
+    Second,
+    Copy = Second,
+    Third);
+static bool CompileTime()
+{
+    // Parsed and indexed by the compiler
+    static_assert(EFruit_Local::Count() == 4);
+    static_assert(EFruit_Local::Min() == EFruit_Local::Apple);
+    static_assert(EFruit_Local::Max() == EFruit_Local::Grape);
+    static_assert(EFruit_Local::FromName("Orange") == EFruit_Local::Orange);
+    static_assert(EFruit_Local::Name(EFruit_Local::Banana) == "Banana");
+    static_assert(EFlag_Local::FromName("P") == EFlag_Local::P);
+    static_assert(EColor_Local::FromName("White") == EColor_Local::White);
+
+    JPT_ENSURE(!EFruit_Local::IsValid(7));
+    JPT_ENSURE(!EFlag_Local::IsValid(EFlag_Local::A | EFlag_Local::B));
+    JPT_ENSURE(EColor_Local::IsValid(EColor_Local::Black));
+
+    // Names are null-terminated
+    for (const auto& [value, name] : EColor_Local())
+    {
+        JPT_ENSURE(name.ConstBuffer()[name.Count()] == '\0');
+        JPT_ENSURE(EColor_Local::FromName(name) == value);
+    }
+
+    // Aliases are enumerators, a value gives its first name
+    JPT_ENSURE(EAlias_Local::Count() == 4);
+    JPT_ENSURE(EAlias_Local::Name(1) == "Second");
+    JPT_ENSURE(EAlias_Local::FromName("Copy") == 1);
+    JPT_ENSURE(EAlias_Local::FromName("Third") == 2);
+
+    return true;
+}
+
+JPT_ENUM(ESigned_Local, int32,
+    Half    = -4 / 2,
+    Rest    = -7 % 3,
+    Shifted = -8 >> 1,
+    Eighth  = -64 / Half / 4,
+    Next);
+static bool SignedValues()
+{
+    // Negative operands divide, take the remainder and shift like the compiler does
+    static_assert(ESigned_Local::FromName("Half") == ESigned_Local::Half && ESigned_Local::Half == -2);
+    static_assert(ESigned_Local::FromName("Rest") == ESigned_Local::Rest && ESigned_Local::Rest == -1);
+    static_assert(ESigned_Local::FromName("Shifted") == ESigned_Local::Shifted && ESigned_Local::Shifted == -4);
+    static_assert(ESigned_Local::FromName("Eighth") == ESigned_Local::Eighth && ESigned_Local::Eighth == 8);
+    static_assert(ESigned_Local::FromName("Next") == 9);
+    static_assert(ESigned_Local::Min() == -4 && ESigned_Local::Max() == 9);
+
+    JPT_ENSURE(ESigned_Local::Name(-1) == "Rest");
+
     return true;
 }
 
@@ -285,6 +347,8 @@ export bool RunUnitTests_Enum()
     JPT_ENSURE(UnitTests_Enum_Flag());
     JPT_ENSURE(UnitTests_Enum_Hex());
     JPT_ENSURE(StringToEnum());
+    JPT_ENSURE(CompileTime());
+    JPT_ENSURE(SignedValues());
 
     return true;
 }
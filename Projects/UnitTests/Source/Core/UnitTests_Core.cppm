@@ -27,6 +27,8 @@ import UnitTests_SortedSet;
 import UnitTests_StaticHashMap;
 import UnitTests_HashSet;
 import UnitTests_HashMap;
+import UnitTests_HashMap_Flat;
+import UnitTests_HashSet_Flat;
 import UnitTests_LinkedList;
 import UnitTests_DynamicArray;
 import UnitTests_StaticArray;
@@ -61,6 +63,9 @@ import UnitTests_Quaternion;
 
 // Memory Managing
 import UnitTests_Allocator;
+import UnitTests_MemoryPool;
+import UnitTests_PoolAllocator;
+import UnitTests_FrameArena;
 import UnitTests_SharedPtr;
 import UnitTests_UniquePtr;
 import UnitTests_WeakPtr;
@@ -72,9 +77,11 @@ import UnitTests_Utilities;
 import UnitTests_TypeTraits;
 
 // Strings
+import UnitTests_NumberConversion;
 import UnitTests_StringUtils;
 import UnitTests_String;
 import UnitTests_StringView;
+import UnitTests_UniqueString;
 
 // Types
 import UnitTests_Enum_Global;
@@ -89,6 +96,8 @@ import UnitTests_Pair;
 
 // Threading
 import UnitTests_Threading;
+import UnitTests_JobSystem;
+import UnitTests_LockFreeQueue;
 
 export bool RunUnitTests_Core()
 {
@@ -113,6 +122,8 @@ export bool RunUnitTests_Core()
     JPT_ENSURE(RunUnitTests_LinkedList());
     JPT_ENSURE(RunUnitTests_HashMap());
     JPT_ENSURE(RunUnitTests_HashSet());
+    JPT_ENSURE(RunUnitTests_HashMap_Flat());
+    JPT_ENSURE(RunUnitTests_HashSet_Flat());
     JPT_ENSURE(RunUnitTests_Heap());
     JPT_ENSURE(RunUnitTests_Graph());
 
@@ -149,6 +160,9 @@ export bool RunUnitTests_Core()
 
     // Memory Managing
     JPT_ENSURE(RunUnitTests_Allocator());
+    JPT_ENSURE(RunUnitTests_MemoryPool());
+    JPT_ENSURE(RunUnitTests_PoolAllocator());
+    JPT_ENSURE(RunUnitTests_FrameArena());
     JPT_ENSURE(RunUnitTests_SharedPtr());
     JPT_ENSURE(RunUnitTests_UniquePtr());
     JPT_ENSURE(RunUnitTests_WeakPtr());
@@ -157,6 +171,8 @@ export bool RunUnitTests_Core()
     JPT_ENSURE(RunUnitTests_String());
     JPT_ENSURE(RunUnitTests_StringUtils());
     JPT_ENSURE(RunUnitTests_StringView());
+    JPT_ENSURE(RunUnitTests_UniqueString());
+    JPT_ENSURE(RunUnitTests_NumberConversion());
 
     // Types
     JPT_ENSURE(RunUnitTests_Any());
@@ -172,6 +188,8 @@ export bool RunUnitTests_Core()
     if (!jpt::LaunchArgs::GetInstance().Has("noThreading"))
     {
         JPT_ENSURE(RunUnitTests_Threading());
+        JPT_ENSURE(RunUnitTests_JobSystem());
+        JPT_ENSURE(RunUnitTests_LockFreeQueue());
     }
 
     return true;
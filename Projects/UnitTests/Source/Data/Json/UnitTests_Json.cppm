@@ -12,6 +12,9 @@ import jpt.Math;
 
 import jpt.Json;
 import jpt.JsonData;
+import jpt.Optional;
+import jpt.String;
+import jpt.StringHelpers;
 
 import jpt.FilePath;
 import jpt.FilePathUtils;
@@ -120,6 +123,64 @@ bool UnitTests_Json_ReadUpdated()
     return true;
 }
 
+bool UnitTests_Json_Parse()
+{
+    // Arbitrary whitespace, nesting on a single line, escapes and 64 bits numbers
+    const char* pText = "{\"name\" :\"Jupiter \\\"Engine\\\"\\n\\u00e9\", \"big\": 9007199254740993, \"precise\": 3.14159265358979,"
+                        "\t\"nested\": {\"objects\": [{\"id\": 1}, {\"id\": 2, \"tags\": []}], \"empty\": {}}, \"exponent\": -2.5e-3,\r\n\"none\": null}";
+
+    jpt::Optional<jpt::JsonMap> parsed = jpt::ParseJson(pText, jpt::FindCharsCount(pText));
+    JPT_ENSURE(parsed);
+
+    const jpt::JsonMap& root = parsed.Value();
+    JPT_ENSURE(root["name"] == jpt::String("Jupiter \"Engine\"\n\xC3\xA9"));
+    JPT_ENSURE(root["big"] == static_cast<int64>(9007199254740993));
+    JPT_ENSURE(root["precise"] == 3.14159265358979);
+    JPT_ENSURE(jpt::AreValuesClose(root["exponent"].As<float32>(), -0.0025f));
+    JPT_ENSURE(root["none"] == jpt::String("null"));
+
+    const jpt::JsonMap& nested = root["nested"];
+    const jpt::JsonArray& objects = nested["objects"];
+    JPT_ENSURE(objects.Count() == 2);
+    JPT_ENSURE(objects[0].As<jpt::JsonMap>()["id"] == 1);
+    JPT_ENSURE(objects[1].As<jpt::JsonMap>()["tags"].As<jpt::JsonArray>().IsEmpty());
+    JPT_ENSURE(nested["empty"].As<jpt::JsonMap>().IsEmpty());
+
+    // Escapes and 64 bits numbers survive a round trip
+    jpt::WriteJsonFile(outputJsonPath, root);
+    jpt::JsonMap reread = jpt::ReadJsonFile(outputJsonPath).Value();
+    JPT_ENSURE(reread["name"] == root["name"].As<jpt::String>());
+    JPT_ENSURE(reread["big"] == root["big"].As<int64>());
+    JPT_ENSURE(reread["precise"] == root["precise"].As<float64>());
+    JPT_ENSURE(reread["nested"].As<jpt::JsonMap>()["objects"].As<jpt::JsonArray>().Count() == 2);
+
+    // Past 6 significant digits float32 no longer gives the literal back, those stay float64
+    const char* pPrecision = "{\"six\": 1.23456, \"seven\": 1234.567, \"eight\": 16777217.0, \"nine\": 3.14159265}";
+    jpt::Optional<jpt::JsonMap> precision = jpt::ParseJson(pPrecision, jpt::FindCharsCount(pPrecision));
+    JPT_ENSURE(precision);
+    JPT_ENSURE(precision.Value()["six"].Is<float32>());
+    JPT_ENSURE(precision.Value()["six"] == 1.23456f);
+    JPT_ENSURE(precision.Value()["seven"].Is<float64>());
+    JPT_ENSURE(precision.Value()["seven"] == 1234.567);
+    JPT_ENSURE(precision.Value()["eight"].Is<float64>());
+    JPT_ENSURE(precision.Value()["eight"] == 16777217.0);
+    JPT_ENSURE(precision.Value()["nine"].Is<float64>());
+    JPT_ENSURE(precision.Value()["nine"] == 3.14159265);
+
+    // Malformed
+    const char* pBroken = "{ \"key\": [1, 2 }";
+    JPT_ENSURE(!jpt::ParseJson(pBroken, jpt::FindCharsCount(pBroken)));
+
+    const char* pTruncatedEscape = "{ \"key\": \"\\u12\" }";
+    JPT_ENSURE(!jpt::ParseJson(pTruncatedEscape, jpt::FindCharsCount(pTruncatedEscape)));
+
+    // Command line values
+    JPT_ENSURE(jpt::ParseValueData("[1, 2.5, true]").As<jpt::JsonArray>().Count() == 3);
+    JPT_ENSURE(jpt::ParseValueData("unquoted") == jpt::String("unquoted"));
+
+    return true;
+}
+
 static bool Engine_Write()
 {
     jpt::JsonMap engineJson;
@@ -155,6 +216,7 @@ export bool RunUnitTests_Json()
     JPT_ENSURE(UnitTests_Json_Read());
     JPT_ENSURE(UnitTests_Json_Update());
     JPT_ENSURE(UnitTests_Json_ReadUpdated());
+    JPT_ENSURE(UnitTests_Json_Parse());
 
     JPT_ENSURE(Engine_Write());
     JPT_ENSURE(Engine_Read());
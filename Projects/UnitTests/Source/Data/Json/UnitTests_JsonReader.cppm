@@ -0,0 +1,122 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+export module UnitTests_JsonReader;
+
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+import jpt.JsonReader;
+
+import jpt.DynamicArray;
+import jpt.String;
+import jpt.StringHelpers;
+
+/** Flattens events into a string, e.g. {k:i[s]} */
+class RecordingHandler final : public jpt::JsonHandler
+{
+public:
+    jpt::String m_events;
+    int64 m_integersSum = 0;
+
+    bool OnBeginObject() override { m_events.Append('{'); return true; }
+    bool OnEndObject()   override { m_events.Append('}'); return true; }
+    bool OnBeginArray()  override { m_events.Append('['); return true; }
+    bool OnEndArray()    override { m_events.Append(']'); return true; }
+
+    bool OnKey(jpt::String& key)   override { m_events.Append(key); m_events.Append(':'); return true; }
+    bool OnString(jpt::String&)    override { m_events.Append('s'); return true; }
+    bool OnInteger(int64 value)    override { m_events.Append('i'); m_integersSum += value; return true; }
+    bool OnFloat(float64)          override { m_events.Append('f'); return true; }
+    bool OnBool(bool)              override { m_events.Append('b'); return true; }
+    bool OnNull()                  override { m_events.Append('n'); return true; }
+};
+
+/** Collects the "path" strings of assets, stops at the first "end" key */
+class AssetPathsHandler final : public jpt::JsonHandler
+{
+public:
+    jpt::DynamicArray<jpt::String> m_paths;
+    bool m_isPathKey = false;
+
+    bool OnKey(jpt::String& key) override
+    {
+        m_isPathKey = key == "path";
+        return key != "end";
+    }
+
+    bool OnString(jpt::String& value) override
+    {
+        if (m_isPathKey)
+        {
+            m_paths.EmplaceBack(Move(value));
+        }
+        return true;
+    }
+};
+
+static bool UnitTests_JsonReader_Events()
+{
+    const char* pText = "{ \"a\": 1, \"b\": [true, null, 2.5, \"x\", [], {}], \"c\": { \"d\": -7 } }";
+
+    RecordingHandler handler;
+    JPT_ENSURE(jpt::ReadJson(pText, jpt::FindCharsCount(pText), handler) == jpt::JsonReadResult::Completed);
+    JPT_ENSURE(handler.m_events == "{a:ib:[bnfs[]{}]c:{d:i}}");
+    JPT_ENSURE(handler.m_integersSum == -6);
+
+    return true;
+}
+
+static bool UnitTests_JsonReader_EarlyStop()
+{
+    const char* pText = "{ \"assets\": [ { \"path\": \"a.png\", \"size\": 1 }, { \"path\": \"b.png\" } ], \"end\": 0, \"more\": { \"path\": \"c.png\" } }";
+
+    AssetPathsHandler handler;
+    JPT_ENSURE(jpt::ReadJson(pText, jpt::FindCharsCount(pText), handler) == jpt::JsonReadResult::Stopped);
+    JPT_ENSURE(handler.m_paths.Count() == 2);
+    JPT_ENSURE(handler.m_paths[0] == "a.png");
+    JPT_ENSURE(handler.m_paths[1] == "b.png");
+
+    // Nothing past the stopping key is read, not even a malformed rest
+    const char* pTruncated = "{ \"path\": \"d.png\", \"end\" ] 1";
+
+    AssetPathsHandler truncatedHandler;
+    JPT_ENSURE(jpt::ReadJson(pTruncated, jpt::FindCharsCount(pTruncated), truncatedHandler) == jpt::JsonReadResult::Stopped);
+    JPT_ENSURE(truncatedHandler.m_paths.Count() == 1);
+
+    return true;
+}
+
+static bool UnitTests_JsonReader_Malformed()
+{
+    const char* texts[] =
+    {
+        "{ \"a\": 1, }",
+        "{ \"a\" 1 }",
+        "[1, 2",
+        "[1 2]",
+        "{ \"a\": [1, 2} }",
+        "{} {}",
+        "",
+    };
+
+    for (const char* pText : texts)
+    {
+        RecordingHandler handler;
+        JPT_ENSURE(jpt::ReadJson(pText, jpt::FindCharsCount(pText), handler) == jpt::JsonReadResult::Error);
+    }
+
+    return true;
+}
+
+export bool RunUnitTests_JsonReader()
+{
+    JPT_ENSURE(UnitTests_JsonReader_Events());
+    JPT_ENSURE(UnitTests_JsonReader_EarlyStop());
+    JPT_ENSURE(UnitTests_JsonReader_Malformed());
+
+    return true;
+}
\ No newline at end of file
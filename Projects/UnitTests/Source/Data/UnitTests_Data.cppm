@@ -17,6 +17,7 @@ import UnitTests_CSV;
 
 // Json
 import UnitTests_Json;
+import UnitTests_JsonReader;
 
 
 export bool RunUnitTests_Data()
@@ -29,6 +30,7 @@ export bool RunUnitTests_Data()
 
     // Json
     JPT_ENSURE(RunUnitTests_Json());
+    JPT_ENSURE(RunUnitTests_JsonReader());
     
 
     return true;
@@ -3,12 +3,25 @@
 module;
 
 #include "Core/Minimal/CoreHeaders.h"
+#include "Debugging/BinaryLogger.h"
+
+#include <cstring>
+#include <thread>
 
 export module UnitTests_Logger;
 
+import jpt.DynamicArray;
 import jpt.ToString;
 import jpt.String;
 import jpt.Utilities;
+import jpt.Constants;
+
+import jpt.FileEnums;
+import jpt.FileIO;
+import jpt.FilePath;
+import jpt.FilePathUtils;
+import jpt.LogWriter;
+import jpt.Optional;
 
 class Foo
 {
@@ -48,9 +61,114 @@ bool UnitTests_Logger_Data()
     return true;
 }
 
+bool UnitTests_LogWriter()
+{
+    const jpt::File::Path path = jpt::File::Combine(jpt::File::Source::Output, "Assets/TestLogWriter_UnitTest.txt");
+    jpt::File::Delete(path);
+
+    static constexpr const char* kLine = "0123456789 Log writer line\n";
+    static constexpr size_t kLineSize = 27;
+    static constexpr size_t kLinesPerThread = 5000;    // Wraps the 64KB ring several times
+
+    jpt::LogWriter writer;
+    JPT_ENSURE(writer.Open(path));
+
+    // Results are collected and checked after the join. An early return would destroy a joinable std::thread
+    bool otherPushed = true;
+    std::thread other([&writer, &otherPushed]()
+        {
+            for (size_t i = 0; i < kLinesPerThread; ++i)
+            {
+                otherPushed &= writer.Push(kLine, kLineSize);
+            }
+        });
+
+    bool pushed = true;
+    for (size_t i = 0; i < kLinesPerThread; ++i)
+    {
+        pushed &= writer.Push(kLine, kLineSize);
+    }
+
+    other.join();
+    JPT_ENSURE(pushed);
+    JPT_ENSURE(otherPushed);
+
+    writer.Flush();
+    writer.Close();
+    JPT_ENSURE(!writer.Push(kLine, kLineSize));
+
+    const jpt::Optional<jpt::String> content = jpt::File::ReadTextFile(path);
+    JPT_ENSURE(content);
+    JPT_ENSURE(content.Value().Count() == kLineSize * kLinesPerThread * 2);
+
+    jpt::File::Delete(path);
+
+    return true;
+}
+
+bool UnitTests_BinaryLogger()
+{
+    using BinaryLogger = jpt::BinaryLogger;
+
+    static constexpr int64 kNanosecondsPerSecond = 1'000'000'000;
+    const int64 start = 1'700'000'000 * kNanosecondsPerSecond;
+
+    char data[BinaryLogger::kMaxRecordSize * 8];
+    size_t size = 0;
+
+    size += BinaryLogger::EncodeSession(data + size, start);
+    size += BinaryLogger::EncodeSite(data + size, 0, jpt::Logger::Type::Info, 10, __FILE__, "Loaded %s in %.2f ms, %u bytes");
+    size += BinaryLogger::EncodeSite(data + size, 1, jpt::Logger::Type::Error, 20, __FILE__, "Missing %s for %d%%, id %lld");
+
+    // Pushed out of order, as two threads' rings would be drained
+    size += BinaryLogger::EncodeEvent(data + size, 1, start + 2, "Mesh.obj", -5, int64(1) << 40);
+    size += BinaryLogger::EncodeEvent(data + size, 0, start + 1, "Texture.png", 1.5, 4096u);
+
+    // Missing and mismatching args
+    size += BinaryLogger::EncodeEvent(data + size, 0, start + 3, 7);
+
+    const jpt::String text = BinaryLogger::Decode(data, size);
+
+    const Index loaded  = text.Find("[Info] Loaded Texture.png in 1.50 ms, 4096 bytes\n");
+    const Index missing = text.Find("[Error] Missing Mesh.obj for -5%, id 1099511627776\n");
+    JPT_ENSURE(loaded != kInvalidIndex);
+    JPT_ENSURE(missing != kInvalidIndex);
+    JPT_ENSURE(loaded < missing);
+    JPT_ENSURE(text.Has("[Info] Loaded <?> in <?> ms, <?> bytes\n"));
+    JPT_ENSURE(text.Has("(20):"));
+
+    // Truncated tail is dropped, what came before still decodes
+    JPT_ENSURE(BinaryLogger::Decode(data, size - 1).Has("Loaded Texture.png"));
+
+    // Corrupt string count past kMaxStringSize, backed by enough bytes to pass the payload size check. Rejected, not copied
+    static constexpr uint16 kCorruptCount = static_cast<uint16>(BinaryLogger::kMaxStringSize * 4);
+    static constexpr uint16 kCorruptArgsSize = static_cast<uint16>(sizeof(BinaryLogger::ArgType) + sizeof(uint16) + kCorruptCount * sizeof(wchar_t));
+
+    jpt::DynamicArray<char> corrupt(BinaryLogger::kMaxRecordSize * 2 + kCorruptArgsSize, 'x');
+    size = BinaryLogger::EncodeSession(corrupt.Buffer(), start);
+    size += BinaryLogger::EncodeSite(corrupt.Buffer() + size, 0, jpt::Logger::Type::Info, 30, __FILE__, "Wide %ls");
+
+    const uint32 siteId = 0;
+    corrupt[size] = static_cast<char>(BinaryLogger::RecordType::Event);
+    std::memcpy(corrupt.Buffer() + size + 1, &siteId, sizeof(siteId));
+    std::memcpy(corrupt.Buffer() + size + 5, &start, sizeof(start));
+    std::memcpy(corrupt.Buffer() + size + 13, &kCorruptArgsSize, sizeof(kCorruptArgsSize));
+    size += BinaryLogger::kEventHeaderSize;
+
+    corrupt[size] = static_cast<char>(BinaryLogger::ArgType::WString);
+    std::memcpy(corrupt.Buffer() + size + 1, &kCorruptCount, sizeof(kCorruptCount));
+    size += kCorruptArgsSize;
+
+    JPT_ENSURE(BinaryLogger::Decode(corrupt.Buffer(), size).Has("[Info] Wide <?>\n"));
+
+    return true;
+}
+
 export bool RunUnitTests_Logger()
 {
     //JPT_ENSURE(UnitTests_Logger_Data());
+    JPT_ENSURE(UnitTests_LogWriter());
+    JPT_ENSURE(UnitTests_BinaryLogger());
 
     return true;
 }
\ No newline at end of file
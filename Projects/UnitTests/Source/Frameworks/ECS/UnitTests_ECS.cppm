@@ -1,6 +1,6 @@
 // Copyright Jupiter Technologies, Inc. All Rights Reserved.
 
-module; 
+module;
 
 #include "Core/Minimal/Utilities.h"
 #include "Core/Validation/Assert.h"
@@ -10,15 +10,147 @@ export module UnitTests_ECS;
 
 import jpt.SceneGraph;
 import jpt.Entity;
+import jpt.EntityId;
+import jpt.EntityComponentManager;
 
+import jpt.DynamicArray;
+import jpt.String;
 import jpt.Vector3;
 import jpt.Matrix44;
 import jpt.Rand;
 import jpt.TimeTypeDefs;
+import jpt.TypeDefs;
 import jpt.Math;
 
+struct Position
+{
+    Vec3f value;
+};
+
+struct Velocity
+{
+    Vec3f value;
+};
+
+struct Name
+{
+    jpt::String value;
+};
+
+static bool UnitTests_ECS_CreateDestroy()
+{
+    jpt::EntityComponentManager manager;
+
+    const jpt::EntityId a = manager.CreateEntity(Position{ Vec3f(1.0f, 0.0f, 0.0f) });
+    const jpt::EntityId b = manager.CreateEntity(Velocity{ Vec3f(0.0f, 1.0f, 0.0f) }, Position{ Vec3f(2.0f, 0.0f, 0.0f) });
+    const jpt::EntityId c = manager.CreateEntity(Position{ Vec3f(3.0f, 0.0f, 0.0f) }, Velocity{ Vec3f(0.0f, 2.0f, 0.0f) });
+    JPT_ENSURE(manager.GetEntitiesCount() == 3);
+
+    // Component order doesn't matter, b and c share an archetype
+    JPT_ENSURE(manager.GetArchetypes().Count() == 3);
+    JPT_ENSURE(manager.GetComponent<Position>(b)->value.x == 2.0f);
+    JPT_ENSURE(manager.GetComponent<Velocity>(c)->value.y == 2.0f);
+    JPT_ENSURE(!manager.HasComponent<Velocity>(a));
+
+    // Destroying b moves c into its row. c must still resolve
+    manager.DestroyEntity(b);
+    JPT_ENSURE(!manager.IsAlive(b));
+    JPT_ENSURE(manager.GetComponent<Position>(b) == nullptr);
+    JPT_ENSURE(manager.GetComponent<Position>(c)->value.x == 3.0f);
+
+    // b's index is recycled with a new generation, the old id stays dead
+    const jpt::EntityId d = manager.CreateEntity(Position{ Vec3f(4.0f, 0.0f, 0.0f) });
+    JPT_ENSURE(d.index == b.index);
+    JPT_ENSURE(d.generation != b.generation);
+    JPT_ENSURE(!manager.IsAlive(b));
+    JPT_ENSURE(manager.IsAlive(d));
+
+    manager.DestroyEntityDeferred(a);
+    JPT_ENSURE(manager.IsAlive(a));
+    manager.Update(0.0f);
+    JPT_ENSURE(!manager.IsAlive(a));
+    JPT_ENSURE(manager.GetEntitiesCount() == 2);
+
+    return true;
+}
+
+static bool UnitTests_ECS_AddRemoveComponent()
+{
+    jpt::EntityComponentManager manager;
+
+    const jpt::EntityId entity = manager.CreateEntity(Name{ "Jupiter" });
+    manager.AddComponent<Position>(entity, Vec3f(1.0f, 2.0f, 3.0f));
+    JPT_ENSURE(manager.HasComponent<Position>(entity));
+    JPT_ENSURE(manager.GetComponent<Name>(entity)->value == "Jupiter");
+    JPT_ENSURE(manager.GetComponent<Position>(entity)->value.z == 3.0f);
+
+    manager.RemoveComponent<Name>(entity);
+    JPT_ENSURE(!manager.HasComponent<Name>(entity));
+    JPT_ENSURE(manager.GetComponent<Position>(entity)->value.y == 2.0f);
+
+    // Non-trivial components survive moves between archetypes
+    manager.AddComponent<Name>(entity, jpt::String("Engine"));
+    manager.AddComponent<Velocity>(entity);
+    JPT_ENSURE(manager.GetComponent<Name>(entity)->value == "Engine");
+
+    return true;
+}
+
+static bool UnitTests_ECS_Query()
+{
+    jpt::EntityComponentManager manager;
+
+    // Enough to span several chunks
+    constexpr int32 kCount = 10'000;
+    for (int32 i = 0; i < kCount; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            manager.CreateEntity(Position{ Vec3f(0.0f) }, Velocity{ Vec3f(1.0f, 0.0f, 0.0f) });
+        }
+        else
+        {
+            manager.CreateEntity(Position{ Vec3f(0.0f) }, Velocity{ Vec3f(1.0f, 0.0f, 0.0f) }, Name{ "Named" });
+        }
+    }
+    manager.CreateEntity(Position{ Vec3f(0.0f) });
+
+    manager.ForEach<Position, const Velocity>([](Position& position, const Velocity& velocity)
+        {
+            position.value += velocity.value;
+        });
+
+    int32 moved = 0;
+    int32 still = 0;
+    manager.ForEach<const Position>([&moved, &still](jpt::EntityId, const Position& position)
+        {
+            if (position.value.x == 1.0f)
+            {
+                ++moved;
+            }
+            else
+            {
+                ++still;
+            }
+        });
+    JPT_ENSURE(moved == kCount);
+    JPT_ENSURE(still == 1);
+
+    size_t named = 0;
+    manager.ForEachChunk<Name>([&named](size_t count, const jpt::EntityId*, Name*)
+        {
+            named += count;
+        });
+    JPT_ENSURE(named == kCount / 2);
+
+    return true;
+}
+
 export bool RunUnitTests_ECS()
 {
+    JPT_ENSURE(UnitTests_ECS_CreateDestroy());
+    JPT_ENSURE(UnitTests_ECS_AddRemoveComponent());
+    JPT_ENSURE(UnitTests_ECS_Query());
 
     return true;
 }
\ No newline at end of file
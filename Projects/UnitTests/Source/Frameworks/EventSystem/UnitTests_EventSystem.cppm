@@ -4,8 +4,12 @@ module;
 
 #include "Core/Minimal/CoreHeaders.h"
 
+#include <atomic>
+#include <thread>
+
 export module UnitTests_EventSystem;
 
+import jpt.DynamicArray;
 import jpt.TypeDefs;
 import jpt.Event;
 import jpt.EventManager;
@@ -162,6 +166,236 @@ static bool UnregisterAll()
     return true;
 }
 
+//------------------------------------------------------------------------
+// Stale handles
+//------------------------------------------------------------------------
+static bool StaleHandle()
+{
+    uint32 num = 0;
+    jpt::EventHandle handle = jpt::EventManager::GetInstance().Register<Event_Test>([&num](const Event_Test& eventTest)
+        {
+            num = eventTest.GetNum();
+        });
+    jpt::EventManager::GetInstance().Unregister(handle);
+
+    // Reuses the slot of the first handle
+    jpt::EventHandle handle2 = jpt::EventManager::GetInstance().Register<Event_Test>([&num](const Event_Test& eventTest)
+        {
+            num = eventTest.GetNum() + 1;
+        });
+
+    JPT_ENSURE(!jpt::EventManager::GetInstance().IsListening(handle));
+    JPT_ENSURE(jpt::EventManager::GetInstance().IsListening(handle2));
+
+    jpt::EventManager::GetInstance().Unregister(handle);
+    jpt::EventManager::GetInstance().Send(Event_Test(1));
+    JPT_ENSURE(num == 2);
+
+    jpt::EventManager::GetInstance().Unregister(handle2);
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// Registering and unregistering while sending
+//------------------------------------------------------------------------
+class Event_Dispatch : public jpt::Event
+{
+};
+
+static bool ChangesDuringSend()
+{
+    jpt::EventManager& eventManager = jpt::EventManager::GetInstance();
+
+    uint32 calls = 0;
+    jpt::EventHandle handle;
+    handle = eventManager.Register<Event_Dispatch>([&](const Event_Dispatch&)
+        {
+            ++calls;
+            eventManager.Unregister(handle);
+            eventManager.Register<Event_Dispatch>([&calls](const Event_Dispatch&)
+                {
+                    calls += 100;
+                });
+        });
+
+    // The function registered during the send isn't called before the next one
+    eventManager.Send(Event_Dispatch());
+    JPT_ENSURE(calls == 1);
+    JPT_ENSURE(!eventManager.IsListening(handle));
+
+    eventManager.Send(Event_Dispatch());
+    JPT_ENSURE(calls == 101);
+
+    eventManager.UnregisterAll<Event_Dispatch>();
+    eventManager.Send(Event_Dispatch());
+    JPT_ENSURE(calls == 101);
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// Queue
+//------------------------------------------------------------------------
+class Event_Queued : public jpt::Event
+{
+private:
+    uint32 m_num;
+
+public:
+    Event_Queued(uint32 num) : m_num(num) {}
+
+    uint32 GetNum() const { return m_num; }
+};
+
+static bool Queue()
+{
+    jpt::EventManager& eventManager = jpt::EventManager::GetInstance();
+
+    jpt::DynamicArray<uint32> received;
+    eventManager.Register<Event_Queued>([&](const Event_Queued& eventQueued)
+        {
+            received.EmplaceBack(eventQueued.GetNum());
+
+            // Queued by a handler, waits for the next Update
+            if (eventQueued.GetNum() == 1)
+            {
+                eventManager.Queue(Event_Queued(6));
+            }
+        });
+
+    eventManager.Queue(Event_Queued(1));
+    eventManager.Queue(Event_Queued(2), 1.0f);
+    eventManager.Queue(Event_Queued(3));
+    eventManager.Queue(Event_Queued(4), 0.5f);
+    eventManager.Queue(Event_Queued(5), 0.5f);
+    JPT_ENSURE(received.IsEmpty());
+
+    eventManager.Update(0.25f);
+    JPT_ENSURE(received == jpt::DynamicArray<uint32>{ 1, 3 });
+
+    // Same due time, queue order
+    eventManager.Update(0.25f);
+    JPT_ENSURE(received == jpt::DynamicArray<uint32>{ 1, 3, 6, 4, 5 });
+
+    eventManager.Update(0.5f);
+    JPT_ENSURE(received == jpt::DynamicArray<uint32>{ 1, 3, 6, 4, 5, 2 });
+
+    eventManager.UnregisterAll<Event_Queued>();
+
+    return true;
+}
+
+static bool QueueFromThreads()
+{
+    jpt::EventManager& eventManager = jpt::EventManager::GetInstance();
+
+    jpt::DynamicArray<uint32> received;
+    eventManager.Register<Event_Queued>([&](const Event_Queued& eventQueued)
+        {
+            received.EmplaceBack(eventQueued.GetNum());
+        });
+
+    // Sent in Queue call order, whatever thread queued them
+    eventManager.Queue(Event_Queued(0));
+
+    std::thread worker([&eventManager]()
+        {
+            eventManager.Queue(Event_Queued(1));
+            eventManager.Queue(Event_Queued(5), 0.5f);
+            eventManager.Queue(Event_Queued(2));
+        });
+    worker.join();
+
+    eventManager.Queue(Event_Queued(3));
+
+    std::thread other([&eventManager]()
+        {
+            eventManager.Queue(Event_Queued(4));
+        });
+    other.join();
+
+    JPT_ENSURE(received.IsEmpty());
+
+    eventManager.Update(0.25f);
+    JPT_ENSURE(received == jpt::DynamicArray<uint32>{ 0, 1, 2, 3, 4 });
+
+    // The timer of another thread's event starts with the Update that receives it
+    eventManager.Update(0.25f);
+    JPT_ENSURE(received.Count() == 5);
+
+    eventManager.Update(0.25f);
+    JPT_ENSURE(received == jpt::DynamicArray<uint32>{ 0, 1, 2, 3, 4, 5 });
+
+    eventManager.UnregisterAll<Event_Queued>();
+
+    return true;
+}
+
+static bool ParallelDispatch()
+{
+    jpt::EventManager& eventManager = jpt::EventManager::GetInstance();
+
+    std::atomic<uint32> sum = 0;
+    eventManager.Register<Event_Queued>([&sum](const Event_Queued& eventQueued)
+        {
+            sum += eventQueued.GetNum();
+        });
+    eventManager.SetParallelDispatch<Event_Queued>();
+
+    for (uint32 i = 1; i <= 1000; ++i)
+    {
+        eventManager.Queue(Event_Queued(i));
+    }
+
+    eventManager.Update(0.0f);
+    JPT_ENSURE(sum == 500500);
+
+    eventManager.SetParallelDispatch<Event_Queued>(false);
+    eventManager.UnregisterAll<Event_Queued>();
+
+    return true;
+}
+
+static bool QueueFromParallelHandlers()
+{
+    jpt::EventManager& eventManager = jpt::EventManager::GetInstance();
+
+    // More than a thread queue holds, queued while Update waits on the handlers. Must overflow instead of waiting for a drain
+    static constexpr uint32 kCount = static_cast<uint32>(jpt::EventManager::kThreadQueueCapacity) * 2;
+
+    std::atomic<uint32> received = 0;
+    eventManager.Register<Event_Queued>([&eventManager, &received](const Event_Queued& eventQueued)
+        {
+            if (eventQueued.GetNum() == 0)
+            {
+                for (uint32 i = 0; i < kCount; ++i)
+                {
+                    eventManager.Queue(Event_Queued(1));
+                }
+            }
+            else
+            {
+                ++received;
+            }
+        });
+    eventManager.SetParallelDispatch<Event_Queued>();
+
+    eventManager.Queue(Event_Queued(0));
+    eventManager.Queue(Event_Queued(0));
+
+    eventManager.Update(0.0f);
+    JPT_ENSURE(received == 0);
+
+    eventManager.Update(0.0f);
+    JPT_ENSURE(received == kCount * 2);
+
+    eventManager.SetParallelDispatch<Event_Queued>(false);
+    eventManager.UnregisterAll<Event_Queued>();
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // Mouse button press
 //------------------------------------------------------------------------
@@ -203,6 +437,13 @@ export bool RunUnitTests_EventSystem()
 
     JPT_ENSURE(UnregisterAll());
 
+    JPT_ENSURE(StaleHandle());
+    JPT_ENSURE(ChangesDuringSend());
+    JPT_ENSURE(Queue());
+    JPT_ENSURE(QueueFromThreads());
+    JPT_ENSURE(ParallelDispatch());
+    JPT_ENSURE(QueueFromParallelHandlers());
+
     JPT_ENSURE(RegisterEvents());
 
     return true;
@@ -0,0 +1,155 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <atomic>
+
+export module UnitTests_SceneScheduler;
+
+import jpt.EntityComponentManager;
+import jpt.EntityId;
+import jpt.SceneScheduler;
+import jpt.SceneSystem;
+
+import jpt.TimeTypeDefs;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+struct Health
+{
+    int32 value = 0;
+};
+
+struct Damage
+{
+    int32 value = 0;
+};
+
+struct Armor
+{
+    int32 value = 0;
+};
+
+/** Records the order systems finished in */
+static std::atomic<int32> locFinishedCount = 0;
+
+class ApplyArmorSystem final : public jpt::SceneSystem
+{
+public:
+    int32 m_finishedOrder = -1;
+
+    ApplyArmorSystem() : SceneSystem("Apply Armor")
+    {
+        Read<Armor>();
+        Write<Damage>();
+    }
+
+    void Update(jpt::EntityComponentManager& manager, TimePrecision) override
+    {
+        manager.ParallelForEach<Damage, const Armor>([](Damage& damage, const Armor& armor)
+            {
+                damage.value = damage.value > armor.value ? damage.value - armor.value : 0;
+            });
+        m_finishedOrder = locFinishedCount.fetch_add(1);
+    }
+};
+
+class ApplyDamageSystem final : public jpt::SceneSystem
+{
+public:
+    int32 m_finishedOrder = -1;
+
+    ApplyDamageSystem() : SceneSystem("Apply Damage")
+    {
+        Read<Damage>();
+        Write<Health>();
+    }
+
+    void Update(jpt::EntityComponentManager& manager, TimePrecision) override
+    {
+        manager.ParallelForEach<Health, const Damage>([](Health& health, const Damage& damage)
+            {
+                health.value -= damage.value;
+            });
+        m_finishedOrder = locFinishedCount.fetch_add(1);
+    }
+};
+
+class CountArmorSystem final : public jpt::SceneSystem
+{
+public:
+    std::atomic<int32> m_count = 0;
+
+    CountArmorSystem() : SceneSystem("Count Armor")
+    {
+        Read<Armor>();
+    }
+
+    void Update(jpt::EntityComponentManager& manager, TimePrecision) override
+    {
+        manager.ForEach<const Armor>([this](const Armor&) { ++m_count; });
+    }
+};
+
+static bool UnitTests_SceneScheduler_Conflicts()
+{
+    ApplyArmorSystem armor;
+    ApplyDamageSystem damage;
+    CountArmorSystem count;
+
+    // Write/read on Damage
+    JPT_ENSURE(armor.ConflictsWith(damage));
+    JPT_ENSURE(damage.ConflictsWith(armor));
+
+    // Both only read Armor
+    JPT_ENSURE(!armor.ConflictsWith(count));
+    JPT_ENSURE(!damage.ConflictsWith(count));
+
+    return true;
+}
+
+static bool UnitTests_SceneScheduler_Update()
+{
+    jpt::EntityComponentManager manager;
+
+    constexpr int32 kCount = 20'000;
+    for (int32 i = 0; i < kCount; ++i)
+    {
+        manager.CreateEntity(Health{ 100 }, Damage{ 30 }, Armor{ 10 });
+    }
+
+    ApplyArmorSystem* pArmor = JPT_NEW(ApplyArmorSystem);
+    ApplyDamageSystem* pDamage = JPT_NEW(ApplyDamageSystem);
+    CountArmorSystem* pCount = JPT_NEW(CountArmorSystem);
+
+    jpt::SceneScheduler scheduler;
+    scheduler.Register(pArmor);
+    scheduler.Register(pDamage);
+    scheduler.Register(pCount);
+
+    locFinishedCount = 0;
+    scheduler.Update(manager, 0.016f);
+
+    // Damage depends on armor, it must observe the reduced damage
+    JPT_ENSURE(pArmor->m_finishedOrder < pDamage->m_finishedOrder);
+    JPT_ENSURE(pCount->m_count == kCount);
+
+    bool isCorrect = true;
+    manager.ForEach<const Health>([&isCorrect](const Health& health)
+        {
+            isCorrect &= health.value == 80;
+        });
+    JPT_ENSURE(isCorrect);
+
+    return true;
+}
+
+export bool RunUnitTests_SceneScheduler()
+{
+    JPT_ENSURE(UnitTests_SceneScheduler_Conflicts());
+    JPT_ENSURE(UnitTests_SceneScheduler_Update());
+
+    return true;
+}
\ No newline at end of file
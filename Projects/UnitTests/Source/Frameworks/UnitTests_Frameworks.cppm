@@ -11,11 +11,13 @@ import jpt.Utilities;
 
 import UnitTests_ECS;
 import UnitTests_EventSystem;
+import UnitTests_SceneScheduler;
 
 export bool RunUnitTests_Frameworks()
 {
     JPT_ENSURE(RunUnitTests_ECS());
     JPT_ENSURE(RunUnitTests_EventSystem());
+    JPT_ENSURE(RunUnitTests_SceneScheduler());
 
     return true;
 }
\ No newline at end of file
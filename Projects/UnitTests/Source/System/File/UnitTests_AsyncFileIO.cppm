@@ -0,0 +1,134 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/CoreHeaders.h"
+
+#include <atomic>
+
+export module UnitTests_AsyncFileIO;
+
+import jpt.AsyncFileIO;
+import jpt.DynamicArray;
+import jpt.FileEnums;
+import jpt.FileIO;
+import jpt.FilePath;
+import jpt.FilePathUtils;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+using namespace jpt::File;
+
+static jpt::DynamicArray<char> locMakeData(size_t count, char first)
+{
+    jpt::DynamicArray<char> data;
+    data.Resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        data[i] = static_cast<char>(first + i % 26);
+    }
+    return data;
+}
+
+static bool UnitTests_AsyncFileIO_WriteRead()
+{
+    AsyncFileIO& service = AsyncFileIO::GetInstance();
+    const Path path = jpt::File::Combine(Source::Output, "Assets/AsyncFileIO_UnitTest.bin");
+
+    // Whole file
+    AsyncFileRequest write;
+    JPT_ENSURE(service.Write(write, path, locMakeData(100'000, 'a')));
+    service.WaitFor(write);
+    JPT_ENSURE(write.Succeeded());
+
+    // In place
+    AsyncFileRequest patch;
+    JPT_ENSURE(service.Write(patch, path, locMakeData(4, 'A'), {}, 10));
+    service.WaitFor(patch);
+    JPT_ENSURE(patch.Succeeded());
+
+    // Range, clamped at the end
+    AsyncFileRequest range;
+    JPT_ENSURE(service.Read(range, path, {}, 99'990, 100));
+    service.WaitFor(range);
+    JPT_ENSURE(range.Succeeded());
+    JPT_ENSURE(range.GetData().Count() == 10);
+
+    // Whole file with a callback on the I/O thread
+    std::atomic<bool> isCalledBack = false;
+    AsyncFileRequest read;
+    JPT_ENSURE(service.Read(read, path, [&isCalledBack](AsyncFileRequest& done)
+        {
+            isCalledBack = done.GetData().Count() == 100'000;
+        }));
+    service.WaitFor(read);
+    JPT_ENSURE(read.Succeeded());
+    JPT_ENSURE(isCalledBack);
+
+    const jpt::DynamicArray<char>& data = read.GetData();
+    JPT_ENSURE(data[9] == 'j');
+    JPT_ENSURE(data[10] == 'A' && data[13] == 'D');
+    JPT_ENSURE(data[14] == 'o');
+
+    // Missing file fails without hanging
+    AsyncFileRequest missing;
+    JPT_ENSURE(service.Read(missing, jpt::File::Combine(Source::Output, "Assets/AsyncFileIO_Missing.bin")));
+    service.WaitFor(missing);
+    JPT_ENSURE(!missing.Succeeded());
+
+    // Unwritable, its parent is a file
+    AsyncFileRequest unwritable;
+    JPT_ENSURE(service.Write(unwritable, jpt::File::Combine(Source::Output, "Assets/AsyncFileIO_UnitTest.bin/Child.bin"), locMakeData(16, 'a')));
+    service.WaitFor(unwritable);
+    JPT_ENSURE(!unwritable.Succeeded());
+
+    Delete(path);
+    return true;
+}
+
+static bool UnitTests_AsyncFileIO_InFlight()
+{
+    AsyncFileIO& service = AsyncFileIO::GetInstance();
+    const Path path = jpt::File::Combine(Source::Output, "Assets/AsyncFileIO_InFlight_UnitTest.bin");
+    WriteTextFile(path, "In flight");
+
+    static constexpr size_t kRequestsCount = AsyncFileIO::kDefaultMaxInFlight * 2;
+    AsyncFileRequest requests[kRequestsCount];
+
+    // Submissions past the bound are refused, the I/O threads may or may not have caught up
+    size_t submittedCount = 0;
+    for (AsyncFileRequest& request : requests)
+    {
+        submittedCount += service.Read(request, path);
+        JPT_ENSURE(service.GetInFlightCount() <= AsyncFileIO::kDefaultMaxInFlight);
+    }
+    JPT_ENSURE(submittedCount > 0);
+
+    for (AsyncFileRequest& request : requests)
+    {
+        // Refused requests were left untouched
+        if (request.GetPath() == path)
+        {
+            service.WaitFor(request);
+            JPT_ENSURE(request.Succeeded());
+            JPT_ENSURE(request.GetData().Count() == 9);
+        }
+    }
+    JPT_ENSURE(service.GetInFlightCount() == 0);
+
+    Delete(path);
+    return true;
+}
+
+export bool RunUnitTests_AsyncFileIO()
+{
+    if (!AsyncFileIO::GetInstance().IsRunning())
+    {
+        return true;
+    }
+
+    JPT_ENSURE(UnitTests_AsyncFileIO_WriteRead());
+    JPT_ENSURE(UnitTests_AsyncFileIO_InFlight());
+
+    return true;
+}
\ No newline at end of file
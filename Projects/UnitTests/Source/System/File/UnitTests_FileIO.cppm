@@ -26,6 +26,8 @@ import jpt.FileEnums;
 import jpt.FileIO;
 import jpt.FilePath;
 import jpt.FilePathUtils;  
+import jpt.MappedFile;
+import jpt.StringView;
 import jpt.SystemPaths;
 
 using namespace jpt::File;
@@ -378,6 +380,178 @@ static bool FileIO_HashMap_Serialization()
     return true;
 }
 
+static bool FileIO_MappedFile()
+{
+    const Path path = jpt::File::Combine(Source::Client, "Assets/MappedFile_UnitTest.txt");
+    const jpt::String content = "Hello, World! I'm a mapped file\r\n I'm the second line";
+    WriteTextFile(path, content);
+
+    {
+        MappedFile file(path);
+        JPT_ENSURE(file.IsOpen());
+        JPT_ENSURE(file.Size() == content.Count());
+        JPT_ENSURE(file.GetStringView() == content);
+        JPT_ENSURE(file.GetArrayView()[13] == ' ');
+
+        // Moved from is closed, the view stays valid in the new owner
+        MappedFile moved = jpt::Move(file);
+        JPT_ENSURE(!file.IsOpen());
+        JPT_ENSURE(file.ConstBuffer() == nullptr);
+        JPT_ENSURE(moved.IsOpen());
+        JPT_ENSURE(moved.GetStringView() == content);
+    }
+
+    // Empty file
+    WriteTextFile(path, "");
+    {
+        MappedFile file(path);
+        JPT_ENSURE(file.IsOpen());
+        JPT_ENSURE(file.Size() == 0);
+        JPT_ENSURE(file.GetStringView().IsEmpty());
+    }
+
+    Delete(path);
+
+    MappedFile missing;
+    JPT_ENSURE(!missing.Open(path));
+    JPT_ENSURE(!missing.IsOpen());
+
+    return true;
+}
+
+static bool Serializer_Memory()
+{
+    static constexpr uint32 kMagic = 0x4A505431;   // JPT1
+
+    struct Vec { float32 x, y, z; };
+    jpt::DynamicArray<Vec> points = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+    jpt::DynamicArray<jpt::String> names = { "Jupiter", "Engine" };
+
+    jpt::Serializer writer;
+    writer.OpenMemory(8);
+    writer.WriteHeader(kMagic, 2);
+
+    const size_t section = writer.BeginSection();
+    writer.Write(points);
+    writer.Write(names);
+    writer.Write(int32(42));            // Field an older reader doesn't know about
+    writer.EndSection(section);
+    writer.Write(int32(7));
+
+    // Older reader skips the unknown field
+    jpt::Serializer reader;
+    reader.OpenMemory(writer.GetMemory(), writer.GetMemorySize());
+
+    uint32 version = 0;
+    JPT_ENSURE(reader.ReadHeader(kMagic, version));
+    JPT_ENSURE(version == 2);
+
+    const size_t sectionEnd = reader.BeginReadSection();
+    jpt::DynamicArray<Vec> loadedPoints;
+    jpt::DynamicArray<jpt::String> loadedNames;
+    reader.Read(loadedPoints);
+    reader.Read(loadedNames);
+    reader.EndReadSection(sectionEnd);
+
+    int32 trailing = 0;
+    reader.Read(trailing);
+    JPT_ENSURE(trailing == 7);
+    JPT_ENSURE(loadedPoints.Count() == 2 && loadedPoints[1].y == 5.0f);
+    JPT_ENSURE(loadedNames == names);
+    JPT_ENSURE(!reader.HasFailed());
+
+    // Past the end
+    reader.Read(trailing);
+    JPT_ENSURE(trailing == 0);
+    JPT_ENSURE(reader.HasFailed());
+
+    // Corrupt count, far more elements than there are bytes left
+    jpt::Serializer corrupt;
+    corrupt.OpenMemory(16);
+    corrupt.Write(Index(1) << 40);
+    corrupt.Write(Index(0));
+    corrupt.Write(points[0]);
+
+    jpt::Serializer corruptReader;
+    corruptReader.OpenMemory(corrupt.GetMemory(), corrupt.GetMemorySize());
+    corruptReader.Read(loadedPoints);
+    JPT_ENSURE(loadedPoints.IsEmpty());
+    JPT_ENSURE(corruptReader.HasFailed());
+
+    // Written on the other endianness, assuming we run little-endian
+    const char swapped[] = { 0x4A, 0x50, 0x54, 0x31,  0, 0, 0, 3,  0x12, 0x34, 0x56, 0x78 };
+
+    reader.OpenMemory(swapped, sizeof(swapped));
+    JPT_ENSURE(reader.ReadHeader(kMagic, version));
+    JPT_ENSURE(version == 3);
+
+    uint32 value = 0;
+    reader.Read(value);
+    JPT_ENSURE(value == 0x12345678);
+
+    reader.OpenMemory(swapped + 4, sizeof(swapped) - 4);
+    JPT_ENSURE(!reader.ReadHeader(kMagic, version));
+
+    return true;
+}
+
+static bool Serializer_BufferedFile()
+{
+    const Path path = jpt::System::Paths::GetInstance().GetOutputDir() + "BufferedSerializer_UnitTest.bin";
+
+    // Element count spans several blocks
+    jpt::DynamicArray<uint32> data;
+    for (uint32 i = 0; i < 50'000; ++i)
+    {
+        data.EmplaceBack(i * 3);
+    }
+
+    {
+        jpt::Serializer writer;
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        writer.Open(path.ConstBuffer(), jpt::SerializerMode::WriteAll);
+#else
+        writer.Open(path.GetString<wchar_t>().ConstBuffer(), jpt::SerializerMode::WriteAll);
+#endif
+        JPT_ENSURE(writer.IsOpen());
+
+        const size_t section = writer.BeginSection();
+        for (uint32 i = 0; i < 1000; ++i)
+        {
+            writer.Write(i);
+        }
+        writer.EndSection(section);
+
+        writer.Write(data);
+        JPT_ENSURE(writer.GetPosition() == sizeof(uint64) + 1000 * sizeof(uint32) + 2 * sizeof(Index) + data.Count() * sizeof(uint32));
+    }
+
+    jpt::Serializer reader;
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+    reader.Open(path.ConstBuffer(), jpt::SerializerMode::ReadBinary);
+#else
+    reader.Open(path.GetString<wchar_t>().ConstBuffer(), jpt::SerializerMode::ReadBinary);
+#endif
+    JPT_ENSURE(reader.IsOpen());
+
+    const size_t sectionEnd = reader.BeginReadSection();
+    JPT_ENSURE(sectionEnd == sizeof(uint64) + 1000 * sizeof(uint32));
+
+    uint32 first = 0;
+    reader.Read(first);
+    reader.EndReadSection(sectionEnd);
+
+    jpt::DynamicArray<uint32> loaded;
+    reader.Read(loaded);
+    JPT_ENSURE(loaded == data);
+    JPT_ENSURE(!reader.HasFailed());
+
+    reader.Close();
+    Delete(path);
+
+    return true;
+}
+
 export bool RunUnitTests_FileIO()
 {
     JPT_ENSURE(IsSerializeOverridden());
@@ -398,5 +572,10 @@ export bool RunUnitTests_FileIO()
     JPT_ENSURE(FileIO_HashMap_Text());
     JPT_ENSURE(FileIO_HashMap_Serialization());
 
+    JPT_ENSURE(FileIO_MappedFile());
+
+    JPT_ENSURE(Serializer_Memory());
+    JPT_ENSURE(Serializer_BufferedFile());
+
     return true;
 }
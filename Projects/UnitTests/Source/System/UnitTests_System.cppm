@@ -15,6 +15,7 @@ import UnitTests_File.Path.Helpers;
 
 // FileIO
 import UnitTests_FileIO;
+import UnitTests_AsyncFileIO;
 
 // FilePath
 import UnitTests_FilePath;
@@ -29,6 +30,7 @@ export bool RunUnitTests_System()
 
     // FileIO
     JPT_ENSURE(RunUnitTests_FileIO());
+    JPT_ENSURE(RunUnitTests_AsyncFileIO());
 
     // FilePath
     JPT_ENSURE(RunUnitTests_FilePath());
@@ -4,6 +4,7 @@ module;
 
 #include "Core/Memory/Memory.h"
 #include "Core/Validation/Assert.h"
+#include "Debugging/BinaryLogger.h"
 #include "Debugging/Logger.h"
 
 module jpt.Application;
@@ -21,6 +22,11 @@ import jpt.SceneManager;
 import jpt.Math;
 import jpt.ToString;
 
+import jpt.FrameArena;
+import jpt.JobSystem;
+import jpt.AsyncFileIO;
+import jpt.SizeClassAllocator;
+
 import jpt.Debugger;
 
 import jpt.EventManager;
@@ -35,6 +41,7 @@ import jpt.InputManager;
 
 import jpt.Platform;
 import jpt.ProjectSettings;
+import jpt.FilePath;
 import jpt.SystemPaths;
 import jpt.HardwareManager;
 
@@ -43,13 +50,27 @@ namespace jpt
     bool jpt::Application::PreInit()
     {
         System::Paths::GetInstance().PreInit();
+        Logger::GetInstance().Init();
         Debugger::GetInstance().PreInit();
         JPT_INFO("Application Launched with Args: " + ToString(LaunchArgs::GetInstance().GetArgs()));
 
         HardwareManager::GetInstance().PreInit();
 
+        // Main thread is worker 0, keep one logical processor for it
+        JobSystem::GetInstance().Init(Max(GetLogicalProcessorsCount(), 2u) - 1);
+        File::AsyncFileIO::GetInstance().Init();
+
         ProjectSettings::GetInstance().Load();
 
+        // Turns a binary log back into text next to it, then quits
+        if (LaunchArgs::GetInstance().Has("decode_log"))
+        {
+            const File::Path binaryPath = LaunchArgs::GetInstance().Get<String>("decode_log");
+            const bool success = BinaryLogger::DecodeFile(binaryPath, binaryPath + ".txt");
+            m_status = success ? Status::Success : Status::Failure;
+            return false;
+        }
+
         if (LaunchArgs::GetInstance().Has("no_window"))
         {
             m_status = Status::Success;
@@ -128,6 +149,9 @@ namespace jpt
     {
         ProjectSettings::GetInstance().Save();
 
+        File::AsyncFileIO::GetInstance().Terminate();
+        JobSystem::GetInstance().Terminate();
+
         AssetManager::GetInstance().Terminate();
         SceneManager::GetInstance().Terminate();
         InputManager::GetInstance().Terminate();
@@ -141,6 +165,10 @@ namespace jpt
         }
 
         JPT_TERMINATE(m_pPlatform);
+
+        SizeClassAllocator::GetInstance().LogStats();
+
+        Logger::GetInstance().Terminate();
     }
 
     void Application::Run()
@@ -150,6 +178,7 @@ namespace jpt
         while (m_status == Status::Running)
         {
             frameTimer.BeginFrame();
+            FrameArena::GetInstance().BeginFrame();
 
             Update(frameTimer.GetDeltaSeconds());
             m_pRenderer->DrawFrame();
@@ -31,6 +31,7 @@ export namespace jpt
 
     public:
         constexpr ArrayView() noexcept = default;
+        constexpr ArrayView(const TData* pBuffer, Index count) noexcept;
         constexpr ArrayView(const std::initializer_list<TData>& initializerList);
         constexpr ArrayView(const DynamicArray<TData>& arr) noexcept;
         template<Index N> constexpr ArrayView(const StaticArray<TData, N>& arr) noexcept;
@@ -61,6 +62,13 @@ export namespace jpt
         constexpr bool IsEmpty() const noexcept;
     };
 
+    template<typename TData>
+    constexpr ArrayView<TData>::ArrayView(const TData* pBuffer, Index count) noexcept
+        : m_pBuffer(pBuffer)
+        , m_count(count)
+    {
+    }
+
     template<typename TData>
     constexpr ArrayView<TData>::ArrayView(const std::initializer_list<TData>& initializerList)
         : m_pBuffer(initializerList.begin())
@@ -298,7 +298,8 @@ export namespace jpt
             }
         }
 
-        JPT_DELETE_ARRAY(m_pBuffer);
+        TAllocator::DeleteArray(m_pBuffer);
+        m_pBuffer = nullptr;
         m_count = 0;
         m_capacity = 0;
     }
@@ -494,18 +495,7 @@ export namespace jpt
     {
         serializer.Write(m_count);
         serializer.Write(m_capacity);
-
-        if constexpr (IsSerializeOverridden<TData>)
-        {
-            for (Index i = 0; i < m_count; ++i)
-            {
-                serializer.Write(m_pBuffer[i]);
-            }
-        }
-        else
-        {
-            serializer.Write(reinterpret_cast<const char*>(m_pBuffer), m_count * sizeof(TData));
-        }
+        serializer.WriteArray(m_pBuffer, m_count);
     }
 
     template<typename TData, typename TAllocator>
@@ -518,22 +508,16 @@ export namespace jpt
         serializer.Read(count);
         serializer.Read(capacity);
 
-        Resize(count);
-
-        if constexpr (IsSerializeOverridden<TData>)
+        // Capacity is kept in the format but not trusted. A corrupt value must not size the allocation, count does,
+        // once it's checked against what's left. Every element takes at least a byte, raw copied ones their full size
+        constexpr size_t kMinElementSize = (!IsSerializeOverridden<TData> && IsTriviallyCopyable<TData>) ? sizeof(TData) : 1;
+        if (count > kMax<Index> / kMinElementSize || !serializer.CanRead(count * kMinElementSize))
         {
-            for (Index i = 0; i < count; ++i)
-            {
-                serializer.Read(m_pBuffer[i]);
-            }
-        }
-        else
-        {
-            serializer.Read(reinterpret_cast<char*>(m_pBuffer), count * sizeof(TData));
+            return;
         }
 
-        m_count = count;
-        m_capacity = capacity;
+        Resize(count);
+        serializer.ReadArray(m_pBuffer, count);
     }
 
     template<typename TData, typename TAllocator>
@@ -47,7 +47,7 @@ export namespace jpt
         using Edge   = GraphEdge;
         using Node   = GraphNode<TData>;
         using Path   = DynamicArray<Index>;
-        using WalkerFunc = Function<void(const TData&)>;
+        using WalkerFunc = FunctionRef<void(const TData&)>;
 
     private:
         DynamicArray<Node> m_nodes;
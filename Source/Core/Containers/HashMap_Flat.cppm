@@ -0,0 +1,348 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <initializer_list>
+
+export module jpt.HashMap_Flat;
+
+import jpt.Comparators;
+import jpt.Constants;
+import jpt.Pair;
+import jpt.Serializer;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+import jpt_private.HashTable_Flat;
+
+export namespace jpt
+{
+    /** Unordered map with open addressing. Same API as HashMap, but elements live inline in one flat array:
+        no allocation per insert, and lookups compare 16 control bytes at once before touching any key
+
+        @note   Unlike HashMap, Clear() keeps the allocation. Adding may move elements, don't keep pointers to them across inserts */
+    template <typename _TKey, typename _TValue, typename _TComparator = Comparator_Equal<_TKey>>
+    class HashMap_Flat
+    {
+    public:
+        using TKey          = _TKey;
+        using TValue        = _TValue;
+        using TComparator   = _TComparator;
+        using Data          = Pair<TKey, TValue>;
+
+    private:
+        struct KeyOf
+        {
+            static const TKey& Get(const Data& data) { return data.first; }
+        };
+
+        using Table = jpt_private::HashTable_Flat<Data, TKey, KeyOf, TComparator>;
+
+    public:
+        using Iterator      = Table::Iterator;
+        using ConstIterator = Table::ConstIterator;
+
+    private:
+        Table m_table;
+
+    public:
+        HashMap_Flat() = default;
+        HashMap_Flat(const std::initializer_list<Data>& list);
+
+    public:
+        // Adding. If the key already exists, returns its value untouched
+        TValue& Add(const TKey& key, const TValue& value);
+        TValue& Add(const Data& element);
+        TValue& Add(TKey&& key, TValue&& value);
+        TValue& Add(Data&& element);
+        template<typename ...TArgs> TValue& Emplace(const TKey& key, TArgs&&... args);
+
+        // Erasing
+        Iterator Erase(const TKey& key);
+        Iterator Erase(const Iterator& iterator);
+        void Clear();
+
+        // Accessing
+        /** If key exists, return reference to it's associated value, caller may update it outside
+            If key doesn't exist, Add a default value, return the inserted value too */
+        TValue& operator[](const TKey& key);
+
+        /** If key exists, return reference to it's associated value, caller can't update it outside
+            If key doesn't exist, assertion fails */
+        const TValue& operator[](const TKey& key) const;
+
+        // Iterators
+        Iterator begin() noexcept;
+        Iterator end()   noexcept;
+        ConstIterator begin()  const noexcept;
+        ConstIterator end()    const noexcept;
+        ConstIterator cbegin() const noexcept;
+        ConstIterator cend()   const noexcept;
+
+        // Capacity
+        Index Count() const noexcept;
+        Index Capacity() const noexcept;
+        bool IsEmpty() const noexcept;
+
+        // Modifiers
+        void Reserve(Index count);
+
+        // Searching
+        Iterator      Find(const TKey& key);
+        ConstIterator Find(const TKey& key) const;
+        bool Has(const TKey& key) const;
+
+        // Serialization
+        void Serialize(Serializer& serializer) const;
+        void Deserialize(Serializer& serializer);
+    };
+
+    //----------------------------------------------------------------------------------------------
+    // Non-member functions
+    //----------------------------------------------------------------------------------------------
+    template<typename TKey, typename TValue, typename TComparator>
+    bool operator==(const HashMap_Flat<TKey, TValue, TComparator>& lhs, const HashMap_Flat<TKey, TValue, TComparator>& rhs)
+    {
+        if (lhs.Count() != rhs.Count())
+        {
+            return false;
+        }
+
+        for (const auto& [key, value] : lhs)
+        {
+            auto itr = rhs.Find(key);
+            if (itr == rhs.end() || itr->second != value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //----------------------------------------------------------------------------------------------
+    // Member function definitions
+    //----------------------------------------------------------------------------------------------
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::HashMap_Flat(const std::initializer_list<Data>& list)
+    {
+        Reserve(list.size());
+
+        for (const Data& element : list)
+        {
+            Add(element);
+        }
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::Add(const TKey& key, const TValue& value)
+    {
+        const auto [index, isInserted] = m_table.FindOrPrepareInsert(key);
+        if (isInserted)
+        {
+            m_table.Construct(index, key, value);
+        }
+
+        return m_table.GetSlot(index).second;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::Add(const Data& element)
+    {
+        return Add(element.first, element.second);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::Add(TKey&& key, TValue&& value)
+    {
+        const auto [index, isInserted] = m_table.FindOrPrepareInsert(key);
+        if (isInserted)
+        {
+            m_table.Construct(index, Move(key), Move(value));
+        }
+
+        return m_table.GetSlot(index).second;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::Add(Data&& element)
+    {
+        return Add(Move(element.first), Move(element.second));
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    template<typename ...TArgs>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::Emplace(const TKey& key, TArgs&&... args)
+    {
+        const auto [index, isInserted] = m_table.FindOrPrepareInsert(key);
+        if (isInserted)
+        {
+            m_table.Construct(index, key, TValue(Forward<TArgs>(args)...));
+        }
+
+        return m_table.GetSlot(index).second;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::Iterator HashMap_Flat<TKey, TValue, TComparator>::Erase(const TKey& key)
+    {
+        const Index index = m_table.FindIndex(key);
+        if (index == kInvalidIndex)
+        {
+            return end();
+        }
+
+        // Erasing never moves other elements, the next one is still after index
+        m_table.EraseAt(index);
+        return m_table.MakeIterator(index + 1);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::Iterator HashMap_Flat<TKey, TValue, TComparator>::Erase(const Iterator& iterator)
+    {
+        const Index index = iterator.GetIndex();
+        m_table.EraseAt(index);
+        return m_table.MakeIterator(index + 1);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    void HashMap_Flat<TKey, TValue, TComparator>::Clear()
+    {
+        m_table.Clear();
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    TValue& HashMap_Flat<TKey, TValue, TComparator>::operator[](const TKey& key)
+    {
+        const auto [index, isInserted] = m_table.FindOrPrepareInsert(key);
+        if (isInserted)
+        {
+            m_table.Construct(index, key, TValue());
+        }
+
+        return m_table.GetSlot(index).second;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    const TValue& HashMap_Flat<TKey, TValue, TComparator>::operator[](const TKey& key) const
+    {
+        const Index index = m_table.FindIndex(key);
+        JPT_ASSERT(index != kInvalidIndex);
+        return m_table.GetSlot(index).second;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::Iterator HashMap_Flat<TKey, TValue, TComparator>::begin() noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::Iterator HashMap_Flat<TKey, TValue, TComparator>::end() noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::ConstIterator HashMap_Flat<TKey, TValue, TComparator>::begin() const noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::ConstIterator HashMap_Flat<TKey, TValue, TComparator>::end() const noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::ConstIterator HashMap_Flat<TKey, TValue, TComparator>::cbegin() const noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::ConstIterator HashMap_Flat<TKey, TValue, TComparator>::cend() const noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    Index HashMap_Flat<TKey, TValue, TComparator>::Count() const noexcept
+    {
+        return m_table.Count();
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    Index HashMap_Flat<TKey, TValue, TComparator>::Capacity() const noexcept
+    {
+        return m_table.GetCapacity();
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    bool HashMap_Flat<TKey, TValue, TComparator>::IsEmpty() const noexcept
+    {
+        return m_table.IsEmpty();
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    void HashMap_Flat<TKey, TValue, TComparator>::Reserve(Index count)
+    {
+        m_table.Reserve(count);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::Iterator HashMap_Flat<TKey, TValue, TComparator>::Find(const TKey& key)
+    {
+        const Index index = m_table.FindIndex(key);
+        return index == kInvalidIndex ? end() : m_table.MakeIterator(index);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    HashMap_Flat<TKey, TValue, TComparator>::ConstIterator HashMap_Flat<TKey, TValue, TComparator>::Find(const TKey& key) const
+    {
+        const Index index = m_table.FindIndex(key);
+        return index == kInvalidIndex ? cend() : m_table.MakeIterator(index);
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    bool HashMap_Flat<TKey, TValue, TComparator>::Has(const TKey& key) const
+    {
+        return m_table.FindIndex(key) != kInvalidIndex;
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    void HashMap_Flat<TKey, TValue, TComparator>::Serialize(Serializer& serializer) const
+    {
+        serializer.Write(m_table.Count());
+
+        for (const auto& [key, value] : *this)
+        {
+            serializer.Write(key);
+            serializer.Write(value);
+        }
+    }
+
+    template<typename TKey, typename TValue, typename TComparator>
+    void HashMap_Flat<TKey, TValue, TComparator>::Deserialize(Serializer& serializer)
+    {
+        Clear();
+
+        Index count;
+        serializer.Read(count);
+        Reserve(count);
+
+        for (Index i = 0; i < count; ++i)
+        {
+            TKey key;
+            TValue value;
+
+            serializer.Read(key);
+            serializer.Read(value);
+
+            Add(Move(key), Move(value));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <initializer_list>
+
+export module jpt.HashSet_Flat;
+
+import jpt.Comparators;
+import jpt.Constants;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+import jpt_private.HashTable_Flat;
+
+export namespace jpt
+{
+    /** Open addressing counterpart of HashSet. See HashMap_Flat */
+    template<typename _TData, typename _Comparator = Comparator_Equal<_TData>>
+    class HashSet_Flat
+    {
+    public:
+        using TData         = _TData;
+        using TComparator   = _Comparator;
+
+    private:
+        struct KeyOf
+        {
+            static const TData& Get(const TData& data) { return data; }
+        };
+
+        using Table = jpt_private::HashTable_Flat<TData, TData, KeyOf, TComparator>;
+
+    public:
+        using Iterator      = Table::Iterator;
+        using ConstIterator = Table::ConstIterator;
+
+    private:
+        Table m_table;
+
+    public:
+        HashSet_Flat() = default;
+        HashSet_Flat(const std::initializer_list<TData>& list);
+
+    public:
+        // Adding
+        void Add(const TData& data);
+        void Add(TData&& data);
+
+        // Erasing
+        Iterator Erase(const TData& data);
+        Iterator Erase(const Iterator& iterator);
+        void Clear();
+
+        // Iterators
+        Iterator begin() noexcept;
+        Iterator end()   noexcept;
+        ConstIterator begin()  const noexcept;
+        ConstIterator end()    const noexcept;
+        ConstIterator cbegin() const noexcept;
+        ConstIterator cend()   const noexcept;
+
+        // Capacity
+        Index Count() const noexcept;
+        Index Capacity() const noexcept;
+        bool IsEmpty() const noexcept;
+
+        // Modifiers
+        void Reserve(Index count);
+
+        // Searching
+        Iterator      Find(const TData& key);
+        ConstIterator Find(const TData& key) const;
+        bool Has(const TData& key) const;
+    };
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::HashSet_Flat(const std::initializer_list<TData>& list)
+    {
+        Reserve(list.size());
+
+        for (const TData& data : list)
+        {
+            Add(data);
+        }
+    }
+
+    template<typename TData, typename TComparator>
+    void HashSet_Flat<TData, TComparator>::Add(const TData& data)
+    {
+        if (const auto [index, isInserted] = m_table.FindOrPrepareInsert(data); isInserted)
+        {
+            m_table.Construct(index, data);
+        }
+    }
+
+    template<typename TData, typename TComparator>
+    void HashSet_Flat<TData, TComparator>::Add(TData&& data)
+    {
+        if (const auto [index, isInserted] = m_table.FindOrPrepareInsert(data); isInserted)
+        {
+            m_table.Construct(index, Move(data));
+        }
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::Iterator HashSet_Flat<TData, TComparator>::Erase(const TData& data)
+    {
+        const Index index = m_table.FindIndex(data);
+        if (index == kInvalidIndex)
+        {
+            return end();
+        }
+
+        m_table.EraseAt(index);
+        return m_table.MakeIterator(index + 1);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::Iterator HashSet_Flat<TData, TComparator>::Erase(const Iterator& iterator)
+    {
+        const Index index = iterator.GetIndex();
+        m_table.EraseAt(index);
+        return m_table.MakeIterator(index + 1);
+    }
+
+    template<typename TData, typename TComparator>
+    void HashSet_Flat<TData, TComparator>::Clear()
+    {
+        m_table.Clear();
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::Iterator HashSet_Flat<TData, TComparator>::begin() noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::Iterator HashSet_Flat<TData, TComparator>::end() noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::ConstIterator HashSet_Flat<TData, TComparator>::begin() const noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::ConstIterator HashSet_Flat<TData, TComparator>::end() const noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::ConstIterator HashSet_Flat<TData, TComparator>::cbegin() const noexcept
+    {
+        return m_table.MakeIterator(0);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::ConstIterator HashSet_Flat<TData, TComparator>::cend() const noexcept
+    {
+        return m_table.MakeIterator(m_table.GetCapacity());
+    }
+
+    template<typename TData, typename TComparator>
+    Index HashSet_Flat<TData, TComparator>::Count() const noexcept
+    {
+        return m_table.Count();
+    }
+
+    template<typename TData, typename TComparator>
+    Index HashSet_Flat<TData, TComparator>::Capacity() const noexcept
+    {
+        return m_table.GetCapacity();
+    }
+
+    template<typename TData, typename TComparator>
+    bool HashSet_Flat<TData, TComparator>::IsEmpty() const noexcept
+    {
+        return m_table.IsEmpty();
+    }
+
+    template<typename TData, typename TComparator>
+    void HashSet_Flat<TData, TComparator>::Reserve(Index count)
+    {
+        m_table.Reserve(count);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::Iterator HashSet_Flat<TData, TComparator>::Find(const TData& key)
+    {
+        const Index index = m_table.FindIndex(key);
+        return index == kInvalidIndex ? end() : m_table.MakeIterator(index);
+    }
+
+    template<typename TData, typename TComparator>
+    HashSet_Flat<TData, TComparator>::ConstIterator HashSet_Flat<TData, TComparator>::Find(const TData& key) const
+    {
+        const Index index = m_table.FindIndex(key);
+        return index == kInvalidIndex ? cend() : m_table.MakeIterator(index);
+    }
+
+    template<typename TData, typename TComparator>
+    bool HashSet_Flat<TData, TComparator>::Has(const TData& key) const
+    {
+        return m_table.FindIndex(key) != kInvalidIndex;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,652 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define JPT_HASHTABLE_FLAT_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define JPT_HASHTABLE_FLAT_SSE2 0
+#endif
+
+export module jpt_private.HashTable_Flat;
+
+import jpt.Constants;
+import jpt.Hash;
+import jpt.Math;
+import jpt.TypeDefs;
+import jpt.TypeTraits;
+import jpt.Utilities;
+
+export namespace jpt_private
+{
+    using jpt::int8;
+    using jpt::uint8;
+    using jpt::uint16;
+    using jpt::uint32;
+    using jpt::uint64;
+    using jpt::Index;
+
+    /** One control byte per slot. Full slots store the 7 low bits of the key's hash (H2), so a group compare filters out almost every non-matching slot
+        without touching the slot itself. Empty and Deleted both have the sign bit set */
+    enum class Control : int8
+    {
+        Empty   = -128,   // 0b10000000
+        Deleted = -2,     // 0b11111110
+    };
+
+    /** kGroupWidth control bytes scanned at once. SSE2 when available, scalar otherwise. Every Match returns a bit mask, bit i stands for byte i */
+    struct Group
+    {
+        static constexpr Index kGroupWidth = 16;
+
+#if JPT_HASHTABLE_FLAT_SSE2
+        __m128i controls;
+
+        explicit Group(const int8* pControls)
+            : controls(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pControls)))
+        {
+        }
+
+        uint32 Match(int8 h2) const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), controls)));
+        }
+
+        uint32 MatchEmpty() const
+        {
+            return Match(static_cast<int8>(Control::Empty));
+        }
+
+        uint32 MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(controls));
+        }
+
+        uint32 MatchFull() const
+        {
+            return ~MatchEmptyOrDeleted() & 0xFFFF;
+        }
+#else
+        int8 controls[kGroupWidth];
+
+        explicit Group(const int8* pControls)
+        {
+            std::memcpy(controls, pControls, kGroupWidth);
+        }
+
+        uint32 Match(int8 h2) const
+        {
+            uint32 mask = 0;
+            for (Index i = 0; i < kGroupWidth; ++i)
+            {
+                mask |= static_cast<uint32>(controls[i] == h2) << i;
+            }
+            return mask;
+        }
+
+        uint32 MatchEmpty() const
+        {
+            return Match(static_cast<int8>(Control::Empty));
+        }
+
+        uint32 MatchEmptyOrDeleted() const
+        {
+            uint32 mask = 0;
+            for (Index i = 0; i < kGroupWidth; ++i)
+            {
+                mask |= static_cast<uint32>(controls[i] < 0) << i;
+            }
+            return mask;
+        }
+
+        uint32 MatchFull() const
+        {
+            return ~MatchEmptyOrDeleted() & 0xFFFF;
+        }
+#endif
+    };
+
+    template<typename TData, bool kIsConst>
+    class Iterator_HashTable_Flat
+    {
+    private:
+        using TPointer   = std::conditional_t<kIsConst, const TData*, TData*>;
+        using TReference = std::conditional_t<kIsConst, const TData&, TData&>;
+
+    private:
+        const int8* m_pControls = nullptr;
+        TPointer m_pSlots = nullptr;
+        Index m_index    = 0;
+        Index m_capacity = 0;
+
+    public:
+        constexpr Iterator_HashTable_Flat() = default;
+        Iterator_HashTable_Flat(const int8* pControls, TPointer pSlots, Index index, Index capacity);
+
+        /** Non-const to const conversion */
+        template<bool kOtherIsConst> requires (kIsConst && !kOtherIsConst)
+        Iterator_HashTable_Flat(const Iterator_HashTable_Flat<TData, kOtherIsConst>& other)
+            : Iterator_HashTable_Flat(other.m_pControls, other.m_pSlots, other.m_index, other.m_capacity)
+        {
+        }
+
+        Iterator_HashTable_Flat& operator++();
+        Iterator_HashTable_Flat operator++(int32);
+
+        TPointer   operator->() const { return m_pSlots + m_index; }
+        TReference operator*()  const { return m_pSlots[m_index]; }
+
+        Index GetIndex() const { return m_index; }
+
+        bool operator==(const Iterator_HashTable_Flat& other) const { return m_pSlots == other.m_pSlots && m_index == other.m_index; }
+
+    private:
+        /** Moves to the first full slot at or after m_index, a whole group at a time */
+        void FindNextFull();
+
+        template<typename, bool>
+        friend class Iterator_HashTable_Flat;
+    };
+
+    /** Open addressing hash table storing TData inline, Swiss table layout.
+        Shared implementation of jpt::HashMap_Flat and jpt::HashSet_Flat
+
+        - Capacity is a power of two, at least one group
+        - Probing visits whole groups with triangular steps, which covers every group exactly once
+        - The first kGroupWidth control bytes are mirrored after the last slot so a group load never wraps
+
+        @param TKeyOf       struct with a static const TKey& Get(const TData&) */
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    class HashTable_Flat
+    {
+    public:
+        using Iterator      = Iterator_HashTable_Flat<TData, false>;
+        using ConstIterator = Iterator_HashTable_Flat<TData, true>;
+
+        /** Result of FindOrPrepareInsert. When isInserted is true, the slot at index is reserved but not constructed yet */
+        struct InsertResult
+        {
+            Index index;
+            bool isInserted;
+        };
+
+    private:
+        static constexpr TComparator kComparator = TComparator();
+        static constexpr Index kGroupWidth = Group::kGroupWidth;
+
+    private:
+        TData* m_pSlots    = nullptr;
+        int8*  m_pControls = nullptr;
+        Index  m_capacity  = 0;
+        Index  m_count     = 0;
+        Index  m_deletedCount = 0;   /**< Tombstones. They count against the load factor until the next rehash */
+
+    public:
+        HashTable_Flat() = default;
+        HashTable_Flat(const HashTable_Flat& other);
+        HashTable_Flat(HashTable_Flat&& other) noexcept;
+        HashTable_Flat& operator=(const HashTable_Flat& other);
+        HashTable_Flat& operator=(HashTable_Flat&& other) noexcept;
+        ~HashTable_Flat();
+
+        /** @return     Index of the slot holding key, or a reserved slot the caller must construct with Construct() */
+        InsertResult FindOrPrepareInsert(const TKey& key);
+
+        template<typename ...TArgs>
+        TData& Construct(Index index, TArgs&&... args);
+
+        /** @return     Index of the slot holding key, kInvalidIndex if not found */
+        Index FindIndex(const TKey& key) const;
+
+        void EraseAt(Index index);
+
+        /** Destroys every element. Keeps the allocation */
+        void Clear();
+
+        /** Makes room for count elements without rehashing */
+        void Reserve(Index count);
+
+        TData&       GetSlot(Index index)       { return m_pSlots[index]; }
+        const TData& GetSlot(Index index) const { return m_pSlots[index]; }
+
+        Iterator      MakeIterator(Index index)       { return Iterator(m_pControls, m_pSlots, index, m_capacity); }
+        ConstIterator MakeIterator(Index index) const { return ConstIterator(m_pControls, m_pSlots, index, m_capacity); }
+
+        Index Count()       const { return m_count; }
+        Index GetCapacity() const { return m_capacity; }
+        bool  IsEmpty()     const { return m_count == 0; }
+
+    private:
+        static uint64 HashKey(const TKey& key);
+        static constexpr Index GetMaxLoad(Index capacity) { return capacity - capacity / 8; }   // 7/8
+
+        void SetControl(Index index, int8 control);
+
+        /** @return     First empty or deleted slot on the probe sequence of hash. Only valid when the key is known to be absent */
+        Index FindFirstNonFull(uint64 hash) const;
+
+        void Rehash(Index newCapacity);
+        void Allocate(Index capacity);
+        void DestroyAndDeallocate();
+        void CopyFrom(const HashTable_Flat& other);
+        void MoveFrom(HashTable_Flat&& other);
+    };
+
+    //----------------------------------------------------------------------------------------------
+    // Iterator_HashTable_Flat
+    //----------------------------------------------------------------------------------------------
+    template<typename TData, bool kIsConst>
+    Iterator_HashTable_Flat<TData, kIsConst>::Iterator_HashTable_Flat(const int8* pControls, TPointer pSlots, Index index, Index capacity)
+        : m_pControls(pControls)
+        , m_pSlots(pSlots)
+        , m_index(index)
+        , m_capacity(capacity)
+    {
+        FindNextFull();
+    }
+
+    template<typename TData, bool kIsConst>
+    Iterator_HashTable_Flat<TData, kIsConst>& Iterator_HashTable_Flat<TData, kIsConst>::operator++()
+    {
+        ++m_index;
+        FindNextFull();
+        return *this;
+    }
+
+    template<typename TData, bool kIsConst>
+    Iterator_HashTable_Flat<TData, kIsConst> Iterator_HashTable_Flat<TData, kIsConst>::operator++(int32)
+    {
+        Iterator_HashTable_Flat iterator = *this;
+        ++(*this);
+        return iterator;
+    }
+
+    template<typename TData, bool kIsConst>
+    void Iterator_HashTable_Flat<TData, kIsConst>::FindNextFull()
+    {
+        while (m_index < m_capacity)
+        {
+            uint32 mask = Group(m_pControls + m_index).MatchFull();
+
+            // Bytes past the last slot are the mirrored first group
+            const Index remaining = m_capacity - m_index;
+            if (remaining < Group::kGroupWidth)
+            {
+                mask &= (1u << remaining) - 1;
+            }
+
+            if (mask != 0)
+            {
+                m_index += std::countr_zero(mask);
+                return;
+            }
+
+            m_index += Group::kGroupWidth;
+        }
+
+        m_index = m_capacity;
+    }
+
+    //----------------------------------------------------------------------------------------------
+    // HashTable_Flat
+    //----------------------------------------------------------------------------------------------
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>::HashTable_Flat(const HashTable_Flat& other)
+    {
+        CopyFrom(other);
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>::HashTable_Flat(HashTable_Flat&& other) noexcept
+    {
+        MoveFrom(jpt::Move(other));
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>& HashTable_Flat<TData, TKey, TKeyOf, TComparator>::operator=(const HashTable_Flat& other)
+    {
+        if (this != &other)
+        {
+            DestroyAndDeallocate();
+            CopyFrom(other);
+        }
+
+        return *this;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>& HashTable_Flat<TData, TKey, TKeyOf, TComparator>::operator=(HashTable_Flat&& other) noexcept
+    {
+        if (this != &other)
+        {
+            DestroyAndDeallocate();
+            MoveFrom(jpt::Move(other));
+        }
+
+        return *this;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>::~HashTable_Flat()
+    {
+        DestroyAndDeallocate();
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    HashTable_Flat<TData, TKey, TKeyOf, TComparator>::InsertResult HashTable_Flat<TData, TKey, TKeyOf, TComparator>::FindOrPrepareInsert(const TKey& key)
+    {
+        if (m_count + m_deletedCount + 1 > GetMaxLoad(m_capacity))
+        {
+            // Mostly tombstones: clean up in place. Otherwise grow
+            const bool isMostlyDeleted = m_count + 1 <= GetMaxLoad(m_capacity) / 2;
+            Rehash(isMostlyDeleted ? m_capacity : Max(m_capacity * 2, kGroupWidth));
+        }
+
+        const uint64 hash = HashKey(key);
+        const int8 h2 = static_cast<int8>(hash & 0x7F);
+        const Index mask = m_capacity - 1;
+
+        Index position = static_cast<Index>(hash >> 7) & mask;
+        Index step = 0;
+        Index available = jpt::kInvalidIndex;
+
+        while (true)
+        {
+            const Group group(m_pControls + position);
+
+            for (uint32 matches = group.Match(h2); matches != 0; matches &= matches - 1)
+            {
+                const Index index = (position + std::countr_zero(matches)) & mask;
+                if (kComparator(TKeyOf::Get(m_pSlots[index]), key))
+                {
+                    return { index, false };
+                }
+            }
+
+            // Remember the first reusable slot, but keep probing until an empty one proves the key is absent
+            if (available == jpt::kInvalidIndex)
+            {
+                if (const uint32 nonFull = group.MatchEmptyOrDeleted(); nonFull != 0)
+                {
+                    available = (position + std::countr_zero(nonFull)) & mask;
+                }
+            }
+
+            if (group.MatchEmpty() != 0)
+            {
+                break;
+            }
+
+            step += kGroupWidth;
+            position = (position + step) & mask;
+        }
+
+        if (m_pControls[available] == static_cast<int8>(Control::Deleted))
+        {
+            --m_deletedCount;
+        }
+
+        SetControl(available, h2);
+        ++m_count;
+
+        return { available, true };
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    template<typename ...TArgs>
+    TData& HashTable_Flat<TData, TKey, TKeyOf, TComparator>::Construct(Index index, TArgs&&... args)
+    {
+        return *std::construct_at(m_pSlots + index, jpt::Forward<TArgs>(args)...);
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    Index HashTable_Flat<TData, TKey, TKeyOf, TComparator>::FindIndex(const TKey& key) const
+    {
+        if (m_count == 0)
+        {
+            return jpt::kInvalidIndex;
+        }
+
+        const uint64 hash = HashKey(key);
+        const int8 h2 = static_cast<int8>(hash & 0x7F);
+        const Index mask = m_capacity - 1;
+
+        Index position = static_cast<Index>(hash >> 7) & mask;
+        Index step = 0;
+
+        while (true)
+        {
+            const Group group(m_pControls + position);
+
+            for (uint32 matches = group.Match(h2); matches != 0; matches &= matches - 1)
+            {
+                const Index index = (position + std::countr_zero(matches)) & mask;
+                if (kComparator(TKeyOf::Get(m_pSlots[index]), key))
+                {
+                    return index;
+                }
+            }
+
+            if (group.MatchEmpty() != 0)
+            {
+                return jpt::kInvalidIndex;
+            }
+
+            step += kGroupWidth;
+            position = (position + step) & mask;
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::EraseAt(Index index)
+    {
+        JPT_ASSERT(index < m_capacity && m_pControls[index] >= 0);
+
+        std::destroy_at(m_pSlots + index);
+        --m_count;
+
+        // If no group window covering this slot was ever full, no probe sequence went past it. It can become Empty instead of a tombstone
+        const Index mask = m_capacity - 1;
+        const uint32 emptyBefore = Group(m_pControls + ((index - kGroupWidth) & mask)).MatchEmpty();
+        const uint32 emptyAfter  = Group(m_pControls + index).MatchEmpty();
+        const bool wasNeverFull = emptyBefore != 0 && emptyAfter != 0 &&
+                                  std::countl_zero(static_cast<uint16>(emptyBefore)) + std::countr_zero(emptyAfter) < kGroupWidth;
+
+        if (wasNeverFull)
+        {
+            SetControl(index, static_cast<int8>(Control::Empty));
+        }
+        else
+        {
+            SetControl(index, static_cast<int8>(Control::Deleted));
+            ++m_deletedCount;
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::Clear()
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+
+        if constexpr (!jpt::IsTriviallyDestructible<TData>)
+        {
+            for (Iterator itr = MakeIterator(0); itr != MakeIterator(m_capacity); ++itr)
+            {
+                std::destroy_at(&*itr);
+            }
+        }
+
+        std::memset(m_pControls, static_cast<int8>(Control::Empty), m_capacity + kGroupWidth);
+        m_count = 0;
+        m_deletedCount = 0;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::Reserve(Index count)
+    {
+        Index capacity = kGroupWidth;
+        while (GetMaxLoad(capacity) < count)
+        {
+            capacity *= 2;
+        }
+
+        if (capacity > m_capacity)
+        {
+            Rehash(capacity);
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    uint64 HashTable_Flat<TData, TKey, TKeyOf, TComparator>::HashKey(const TKey& key)
+    {
+        // Hasher may be the identity for integers. Mix so both the probe start (high bits) and H2 (low 7 bits) see every input bit
+        uint64 hash = jpt::Hash(key);
+        hash ^= hash >> 32;
+        hash *= 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+        return hash;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::SetControl(Index index, int8 control)
+    {
+        m_pControls[index] = control;
+
+        if (index < kGroupWidth)
+        {
+            m_pControls[m_capacity + index] = control;
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    Index HashTable_Flat<TData, TKey, TKeyOf, TComparator>::FindFirstNonFull(uint64 hash) const
+    {
+        const Index mask = m_capacity - 1;
+        Index position = static_cast<Index>(hash >> 7) & mask;
+        Index step = 0;
+
+        while (true)
+        {
+            if (const uint32 nonFull = Group(m_pControls + position).MatchEmptyOrDeleted(); nonFull != 0)
+            {
+                return (position + std::countr_zero(nonFull)) & mask;
+            }
+
+            step += kGroupWidth;
+            position = (position + step) & mask;
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::Rehash(Index newCapacity)
+    {
+        JPT_ASSERT(jpt::IsPowerOfTwo(newCapacity) && newCapacity >= kGroupWidth);
+
+        TData* pOldSlots    = m_pSlots;
+        int8*  pOldControls = m_pControls;
+        const Index oldCapacity = m_capacity;
+
+        Allocate(newCapacity);
+
+        for (Index i = 0; i < oldCapacity; ++i)
+        {
+            if (pOldControls[i] < 0)
+            {
+                continue;
+            }
+
+            TData& data = pOldSlots[i];
+            const uint64 hash = HashKey(TKeyOf::Get(data));
+            const Index index = FindFirstNonFull(hash);
+
+            SetControl(index, static_cast<int8>(hash & 0x7F));
+            std::construct_at(m_pSlots + index, jpt::Move(data));
+            std::destroy_at(&data);
+        }
+
+        m_deletedCount = 0;
+
+        if (pOldSlots)
+        {
+            ::operator delete(pOldSlots, std::align_val_t{ alignof(TData) });
+            ::operator delete(pOldControls, std::align_val_t{ Group::kGroupWidth });
+        }
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::Allocate(Index capacity)
+    {
+        m_pSlots    = static_cast<TData*>(::operator new(capacity * sizeof(TData), std::align_val_t{ alignof(TData) }));
+        m_pControls = static_cast<int8*>(::operator new(capacity + kGroupWidth, std::align_val_t{ Group::kGroupWidth }));
+        m_capacity  = capacity;
+
+        std::memset(m_pControls, static_cast<int8>(Control::Empty), capacity + kGroupWidth);
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::DestroyAndDeallocate()
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+
+        Clear();
+
+        ::operator delete(m_pSlots, std::align_val_t{ alignof(TData) });
+        ::operator delete(m_pControls, std::align_val_t{ Group::kGroupWidth });
+
+        m_pSlots    = nullptr;
+        m_pControls = nullptr;
+        m_capacity  = 0;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::CopyFrom(const HashTable_Flat& other)
+    {
+        if (other.m_capacity == 0)
+        {
+            return;
+        }
+
+        // Same capacity and hash function, every element lands at the same index. Copy the controls as they are
+        Allocate(other.m_capacity);
+        std::memcpy(m_pControls, other.m_pControls, m_capacity + kGroupWidth);
+
+        for (ConstIterator itr = other.MakeIterator(0); itr != other.MakeIterator(other.m_capacity); ++itr)
+        {
+            std::construct_at(m_pSlots + itr.GetIndex(), *itr);
+        }
+
+        m_count        = other.m_count;
+        m_deletedCount = other.m_deletedCount;
+    }
+
+    template<typename TData, typename TKey, typename TKeyOf, typename TComparator>
+    void HashTable_Flat<TData, TKey, TKeyOf, TComparator>::MoveFrom(HashTable_Flat&& other)
+    {
+        m_pSlots       = other.m_pSlots;
+        m_pControls    = other.m_pControls;
+        m_capacity     = other.m_capacity;
+        m_count        = other.m_count;
+        m_deletedCount = other.m_deletedCount;
+
+        other.m_pSlots       = nullptr;
+        other.m_pControls    = nullptr;
+        other.m_capacity     = 0;
+        other.m_count        = 0;
+        other.m_deletedCount = 0;
+    }
+}
\ No newline at end of file
@@ -2,380 +2,643 @@
 
 module;
 
-#include "Core/Memory/Memory.h"
+#include "Core/Validation/Assert.h"
 
 export module jpt.KDTree3;
 
-import jpt.Allocator;
 import jpt.Concepts;
+import jpt.Constants;
 import jpt.DynamicArray;
-import jpt.Sort;
+import jpt.JobSystem;
 import jpt.TypeDefs;
+import jpt.Utilities;
 import jpt.Vector3;
 
-import jpt_private.Iterator_BinaryTree;
-
 namespace jpt
 {
-    /** 3D K-D Tree implementation */
+    /** 3D K-D Tree, bulk built for proximity queries over large point sets.
+        Implicit balanced tree in a flat array: node i has children 2i + 1 and 2i + 2, no pointers nor per node allocations.
+        Points live in leaf buckets of up to kLeafSize, stored as separate x, y, z arrays so a bucket scan streams contiguous coordinates.
+        Every split is the median along the widest axis, found by linear selection. Large inputs build their subtrees in parallel on the JobSystem
+
+        Points are identified by id: their index in the array given to Build(), or the value returned by Add().
+
+        @note   Add() and Erase() don't rebalance. Added points go to a pending list every query scans,
+                folded into the tree once it grows past a fraction of it
+        @example
+            jpt::KDTree3f tree(positions);
+
+            jpt::DynamicArray<Index> ids;      // Reused every frame, only allocates when it grows
+            tree.FindInRadius(center, 10.0f, ids);
+
+            Index nearestIds[8];
+            float32 nearestDistances2[8];
+            const Index found = tree.FindKNearest(center, 8, nearestIds, nearestDistances2); */
     export template<Floating T>
     class KDTree3
     {
+    public:
+        static constexpr Index kLeafSize = 16;
+        static constexpr Index kParallelBuildThreshold = 64 * 1024;     /**< Smaller inputs are built on the calling thread */
+
     private:
-        using Node = jpt_private::BinaryTreeNode<Vector3<T>>;
-        using TAllocator = Allocator<Node>;
+        struct Node
+        {
+            T split = 0;            /**< Internal nodes. Points <= split are on the left, >= split on the right */
+            uint32 begin = 0;       /**< Leaves. First slot of the bucket */
+            uint32 count = 0;       /**< Leaves. Points left in the bucket, Erase() shrinks it */
+            uint8 axis = 0;         /**< Internal nodes */
+        };
+
+        struct Entry
+        {
+            Vector3<T> point;
+            Index id = kInvalidIndex;
+        };
+
+        /** Subtree handed to a job during parallel builds */
+        struct Subtree
+        {
+            Index node;
+            Index begin;
+            Index end;
+            Index level;
+        };
+
+        static constexpr Index kMaxDepth = 48;
 
     private:
-        Node* m_pRoot = nullptr;
+        DynamicArray<Node> m_nodes;
+        DynamicArray<T> m_x;
+        DynamicArray<T> m_y;
+        DynamicArray<T> m_z;
+        DynamicArray<Index> m_ids;
+        DynamicArray<Entry> m_pending;      /**< Added since the last build, not in the tree yet */
+
+        Index m_depth = 0;                  /**< Leaves are at this level */
         Index m_count = 0;
+        Index m_nextId = 0;
 
     public:
-        constexpr KDTree3() = default;
-        constexpr KDTree3(const DynamicArray<Vector3<T>>& points);
-        constexpr ~KDTree3();
+        KDTree3() = default;
+        KDTree3(const DynamicArray<Vector3<T>>& points);
 
     public:
         // Modifiers
-        constexpr void Add(const Vector3<T>& point);
-        constexpr void Erase(const Vector3<T>& point);
-        constexpr void Clear();
+        /** @return     Id of the new point */
+        Index Add(const Vector3<T>& point);
+
+        /** Erases one point exactly equal to the given one
+            @return     false if there was none */
+        bool Erase(const Vector3<T>& point);
+        void Clear();
 
         // Capacity
-        constexpr Index Count() const noexcept;
-        constexpr bool IsEmpty() const noexcept;
+        constexpr Index Count() const noexcept { return m_count; }
+        constexpr bool IsEmpty() const noexcept { return m_count == 0; }
 
         // Building
-        constexpr void Build(const DynamicArray<Vector3<T>>& points);
+        /** Replaces all points. Ids are the indices in points */
+        void Build(const DynamicArray<Vector3<T>>& points);
+        void Build(const Vector3<T>* pPoints, Index count);
 
         // Searching
-        constexpr bool Has(const Vector3<T>& point) const;
-        constexpr DynamicArray<Vector3<T>> FindNearest(const Vector3<T>& point, T threshold) const;
+        bool Has(const Vector3<T>& point) const;
+
+        /** Ids of the points within radius, inclusive, in no particular order
+            @param outIds       Cleared first. Keeps its capacity, reuse it across queries to avoid allocations
+            @return             Found count */
+        Index FindInRadius(const Vector3<T>& point, T radius, DynamicArray<Index>& outIds) const;
+
+        /** The k closest points, nearest first
+            @param pOutIds          Holds at least k ids
+            @param pOutDistances2   Holds at least k squared distances
+            @return                 Found count. Less than k only if the tree has fewer points */
+        Index FindKNearest(const Vector3<T>& point, Index k, Index* pOutIds, T* pOutDistances2) const;
+
+        /** @return     Copy of the points closer than threshold. Allocates every call, prefer FindInRadius() for frequent queries */
+        DynamicArray<Vector3<T>> FindNearest(const Vector3<T>& point, T threshold) const;
 
     private:
         // Building
-        constexpr Node* InternalBuild(const DynamicArray<Vector3<T>>& points, Index begin, Index end, Index depth);
+        void BuildEntries(DynamicArray<Entry>& entries);
+        void BuildNode(Entry* pEntries, Index nodeIndex, Index begin, Index end, Index level, Index stopLevel, DynamicArray<Subtree>* pSubtrees);
+
+        /** Folds the pending points into the tree */
+        void Rebuild();
+
+        /** Reorders [begin, end) so that nth holds the value it would have if sorted along axis, with no greater value before and no smaller after. Expected O(n) */
+        static void SelectNth(Entry* pEntries, Index begin, Index nth, Index end, Index axis);
 
         // Searching
-        void RecurFindNearest(Node* pNode, const Vector3<T>& point, T threshold, Index depth, DynamicArray<Vector3<T>>& result) const;
+        /** Exact comparison. Vector3's operator== tolerates an epsilon */
+        static constexpr bool IsSamePoint(const Vector3<T>& a, const Vector3<T>& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+        constexpr Index GetFirstLeaf() const { return (Index(1) << m_depth) - 1; }
+        constexpr T GetDistance2(Index slot, const Vector3<T>& point) const;
 
-        // Traversal
+        /** @return     Slot of a point exactly equal to point, or kInvalidIndex. outLeaf is set to its leaf */
+        Index FindSlot(const Vector3<T>& point, Index& outLeaf) const;
+
+        /** Calls func(const Vector3<T>& point, Index id, T distance2) for every point within radius, inclusive */
         template<typename TFunc>
-        void RecurPostOrderWalkNode(Node* pNode, TFunc&& func);
+        void VisitInRadius(const Vector3<T>& point, T radius, TFunc&& func) const;
+
+        void SearchKNearest(Index nodeIndex, const Vector3<T>& point, Index k, Index& found, Index* pOutIds, T* pOutDistances2) const;
+        static void InsertNearest(Index id, T distance2, Index k, Index& found, Index* pOutIds, T* pOutDistances2);
     };
 
     template<Floating T>
-    constexpr KDTree3<T>::KDTree3(const DynamicArray<Vector3<T>>& points)
+    KDTree3<T>::KDTree3(const DynamicArray<Vector3<T>>& points)
     {
         Build(points);
     }
 
     template<Floating T>
-    constexpr KDTree3<T>::~KDTree3()
+    Index KDTree3<T>::Add(const Vector3<T>& point)
     {
-        Clear();
+        const Index id = m_nextId++;
+        m_pending.EmplaceBack(Entry{ point, id });
+        ++m_count;
+
+        if (m_pending.Count() > kLeafSize && m_pending.Count() * 8 > m_count)
+        {
+            Rebuild();
+        }
+
+        return id;
     }
 
     template<Floating T>
-    constexpr void KDTree3<T>::Add(const Vector3<T>& point)
+    bool KDTree3<T>::Erase(const Vector3<T>& point)
     {
-        Node* pNode = m_pRoot;
-        Index depth = 0;
-
-        while (true)
+        for (Index i = 0; i < m_pending.Count(); ++i)
         {
-            Index axis = depth % 3;
-
-            if (point[axis] < pNode->data[axis])
+            if (IsSamePoint(m_pending[i].point, point))
             {
-                if (pNode->pLeft == nullptr)
-                {
-                    pNode->pLeft = TAllocator::New();
-                    pNode->pLeft->data = point;
-                    break;
-                }
-                else
-                {
-                    pNode = pNode->pLeft;
-                }
-            }
-            else
-            {
-                if (pNode->pRight == nullptr)
-                {
-                    pNode->pRight = TAllocator::New();
-                    pNode->pRight->data = point;
-                    break;
-                }
-                else
-                {
-                    pNode = pNode->pRight;
-                }
+                m_pending[i] = m_pending.Back();
+                m_pending.Pop();
+                --m_count;
+                return true;
             }
+        }
 
-            ++depth;
+        Index leaf = kInvalidIndex;
+        const Index slot = FindSlot(point, leaf);
+        if (slot == kInvalidIndex)
+        {
+            return false;
         }
 
-        ++m_count;
+        // Move the bucket's last point into the hole
+        Node& node = m_nodes[leaf];
+        const Index last = node.begin + node.count - 1;
+        m_x[slot]   = m_x[last];
+        m_y[slot]   = m_y[last];
+        m_z[slot]   = m_z[last];
+        m_ids[slot] = m_ids[last];
+        --node.count;
+
+        --m_count;
+        return true;
+    }
+
+    template<Floating T>
+    void KDTree3<T>::Clear()
+    {
+        m_nodes.Clear();
+        m_x.Clear();
+        m_y.Clear();
+        m_z.Clear();
+        m_ids.Clear();
+        m_pending.Clear();
+
+        m_depth = 0;
+        m_count = 0;
+        m_nextId = 0;
     }
 
     template<Floating T>
-    constexpr void KDTree3<T>::Erase(const Vector3<T>& point)
+    void KDTree3<T>::Build(const DynamicArray<Vector3<T>>& points)
     {
-        Node* pNode = m_pRoot;
-        Node* pParent = nullptr;
-        Index depth = 0;
+        Build(points.ConstBuffer(), points.Count());
+    }
 
-        // Find the node to erase
-        while (pNode != nullptr)
+    template<Floating T>
+    void KDTree3<T>::Build(const Vector3<T>* pPoints, Index count)
+    {
+        Clear();
+
+        DynamicArray<Entry> entries;
+        entries.Reserve(count);
+        for (Index i = 0; i < count; ++i)
         {
-            Index axis = depth % 3;
+            entries.EmplaceBack(Entry{ pPoints[i], i });
+        }
+
+        BuildEntries(entries);
+        m_nextId = count;
+    }
 
-            if (point[axis] == pNode->data[axis])
+    template<Floating T>
+    bool KDTree3<T>::Has(const Vector3<T>& point) const
+    {
+        for (const Entry& entry : m_pending)
+        {
+            if (IsSamePoint(entry.point, point))
             {
-                break;
+                return true;
             }
+        }
 
-            pParent = pNode;
+        Index leaf = kInvalidIndex;
+        return FindSlot(point, leaf) != kInvalidIndex;
+    }
 
-            if (point[axis] < pNode->data[axis])
-            {
-                pNode = pNode->pLeft;
-            }
-            else
+    template<Floating T>
+    Index KDTree3<T>::FindInRadius(const Vector3<T>& point, T radius, DynamicArray<Index>& outIds) const
+    {
+        outIds.Clear();
+        VisitInRadius(point, radius, [&outIds](const Vector3<T>&, Index id, T)
             {
-                pNode = pNode->pRight;
-            }
+                outIds.EmplaceBack(id);
+            });
 
-            ++depth;
-        }
+        return outIds.Count();
+    }
 
-        if (pNode == nullptr)
+    template<Floating T>
+    Index KDTree3<T>::FindKNearest(const Vector3<T>& point, Index k, Index* pOutIds, T* pOutDistances2) const
+    {
+        Index found = 0;
+        if (k == 0)
         {
-            return;
+            return found;
         }
 
-        // If the node is a leaf node, just remove it
-        if (pNode->pLeft == nullptr && pNode->pRight == nullptr)
+        for (const Entry& entry : m_pending)
         {
-            if (pParent == nullptr)
-            {
-                TAllocator::Delete(pNode);
-                m_pRoot = nullptr;
-            }
-            else if (pParent->pLeft == pNode)
-            {
-                TAllocator::Delete(pNode);
-                pParent->pLeft = nullptr;
-            }
-            else
-            {
-                TAllocator::Delete(pNode);
-                pParent->pRight = nullptr;
-            }
+            InsertNearest(entry.id, entry.point.Distance2(point), k, found, pOutIds, pOutDistances2);
         }
-        // If the node has only one child, replace the node with the child
-        else if (pNode->pLeft != nullptr && pNode->pRight == nullptr)
+
+        if (!m_nodes.IsEmpty())
         {
-            if (pParent == nullptr)
-            {
-                m_pRoot = pNode->pLeft;
-                TAllocator::Delete(pNode);
-            }
-            else if (pParent->pLeft == pNode)
-            {
-                pParent->pLeft = pNode->pLeft;
-                TAllocator::Delete(pNode);
-            }
-            else
+            SearchKNearest(0, point, k, found, pOutIds, pOutDistances2);
+        }
+
+        return found;
+    }
+
+    template<Floating T>
+    DynamicArray<Vector3<T>> KDTree3<T>::FindNearest(const Vector3<T>& point, T threshold) const
+    {
+        DynamicArray<Vector3<T>> result;
+
+        const T threshold2 = threshold * threshold;
+        VisitInRadius(point, threshold, [&result, threshold2](const Vector3<T>& found, Index, T distance2)
             {
-                pParent->pRight = pNode->pLeft;
-                TAllocator::Delete(pNode);
-            }
+                if (distance2 < threshold2)
+                {
+                    result.EmplaceBack(found);
+                }
+            });
+
+        return result;
+    }
+
+    template<Floating T>
+    void KDTree3<T>::BuildEntries(DynamicArray<Entry>& entries)
+    {
+        const Index count = entries.Count();
+        JPT_ASSERT(count <= 0xFFFFFFFF, "KDTree3 holds up to 2^32 points");
+
+        m_nodes.Clear();
+        m_pending.Clear();
+        m_count = count;
+
+        m_depth = 0;
+        while ((count >> m_depth) > kLeafSize && m_depth < kMaxDepth)
+        {
+            ++m_depth;
         }
-        else if (pNode->pLeft == nullptr && pNode->pRight != nullptr)
+        m_nodes.Resize((Index(2) << m_depth) - 1);
+
+        // Split the top levels here, then give each subtree below to a job. Jobs write disjoint nodes and entries
+        JobSystem& jobSystem = JobSystem::GetInstance();
+        const uint32 workersCount = jobSystem.GetWorkersCount();
+        if (count >= kParallelBuildThreshold && workersCount > 0)
         {
-            if (pParent == nullptr)
-            {
-                m_pRoot = pNode->pRight;
-                TAllocator::Delete(pNode);
-            }
-            else if (pParent->pLeft == pNode)
-            {
-                pParent->pLeft = pNode->pRight;
-                TAllocator::Delete(pNode);
-            }
-            else
+            Index parallelLevel = 0;
+            while ((Index(1) << parallelLevel) < workersCount * 4 && parallelLevel < m_depth)
             {
-                pParent->pRight = pNode->pRight;
-                TAllocator::Delete(pNode);
+                ++parallelLevel;
             }
+
+            DynamicArray<Subtree> subtrees;
+            BuildNode(entries.Buffer(), 0, 0, count, 0, parallelLevel, &subtrees);
+
+            jobSystem.ParallelFor(subtrees.Count(), 1, [this, &entries, &subtrees](size_t i)
+                {
+                    const Subtree& subtree = subtrees[i];
+                    BuildNode(entries.Buffer(), subtree.node, subtree.begin, subtree.end, subtree.level, kInvalidIndex, nullptr);
+                });
         }
-        // If the node has two children, replace the node with the minimum node in the right subtree
         else
         {
-            Node* pMinNode = pNode->pRight;
-            Node* pMinParent = pNode;
+            BuildNode(entries.Buffer(), 0, 0, count, 0, kInvalidIndex, nullptr);
+        }
 
-            while (pMinNode->pLeft != nullptr)
-            {
-                pMinParent = pMinNode;
-                pMinNode = pMinNode->pLeft;
-            }
+        // Entries are in tree order now, scatter them to the coordinate arrays
+        m_x.Resize(count);
+        m_y.Resize(count);
+        m_z.Resize(count);
+        m_ids.Resize(count);
+        for (Index i = 0; i < count; ++i)
+        {
+            m_x[i]   = entries[i].point.x;
+            m_y[i]   = entries[i].point.y;
+            m_z[i]   = entries[i].point.z;
+            m_ids[i] = entries[i].id;
+        }
+    }
 
-            pNode->data = pMinNode->data;
+    template<Floating T>
+    void KDTree3<T>::BuildNode(Entry* pEntries, Index nodeIndex, Index begin, Index end, Index level, Index stopLevel, DynamicArray<Subtree>* pSubtrees)
+    {
+        Node& node = m_nodes[nodeIndex];
 
-            if (pMinParent->pLeft == pMinNode)
-            {
-                pMinParent->pLeft = pMinNode->pRight;
-            }
-            else
+        if (level == m_depth)
+        {
+            node.begin = static_cast<uint32>(begin);
+            node.count = static_cast<uint32>(end - begin);
+            return;
+        }
+
+        if (level == stopLevel)
+        {
+            pSubtrees->EmplaceBack(Subtree{ nodeIndex, begin, end, level });
+            return;
+        }
+
+        // Split along the widest axis
+        Vector3<T> min = pEntries[begin].point;
+        Vector3<T> max = pEntries[begin].point;
+        for (Index i = begin + 1; i < end; ++i)
+        {
+            const Vector3<T>& point = pEntries[i].point;
+            for (Index axis = 0; axis < 3; ++axis)
             {
-                pMinParent->pRight = pMinNode->pRight;
+                min[axis] = point[axis] < min[axis] ? point[axis] : min[axis];
+                max[axis] = point[axis] > max[axis] ? point[axis] : max[axis];
             }
-
-            TAllocator::Delete(pMinNode);
         }
 
-        --m_count;
-    }
+        const Vector3<T> extent = max - min;
+        Index axis = extent.x >= extent.y ? 0 : 1;
+        axis = extent.z > extent[axis] ? 2 : axis;
 
-    template<Floating T>
-    constexpr void KDTree3<T>::Clear()
-    {
-        RecurPostOrderWalkNode(m_pRoot, [](Node* pNode) 
-            { 
-                TAllocator::Delete(pNode);
-                pNode = nullptr;
-            });
+        const Index mid = begin + (end - begin) / 2;
+        SelectNth(pEntries, begin, mid, end, axis);
 
-        m_pRoot = nullptr;
-        m_count = 0;
-    }
+        node.split = pEntries[mid].point[axis];
+        node.axis = static_cast<uint8>(axis);
 
-    template<Floating T>
-    constexpr Index KDTree3<T>::Count() const noexcept
-    {
-        return m_count;
+        BuildNode(pEntries, nodeIndex * 2 + 1, begin, mid, level + 1, stopLevel, pSubtrees);
+        BuildNode(pEntries, nodeIndex * 2 + 2, mid,   end, level + 1, stopLevel, pSubtrees);
     }
 
     template<Floating T>
-    constexpr bool KDTree3<T>::IsEmpty() const noexcept
+    void KDTree3<T>::Rebuild()
     {
-        return m_count == 0;
-    }
+        DynamicArray<Entry> entries;
+        entries.Reserve(m_count);
 
-    template<Floating T>
-    constexpr void KDTree3<T>::Build(const DynamicArray<Vector3<T>>& points)
-    {
-        Clear();
-        m_pRoot = InternalBuild(points, 0, points.Count(), 0);
-        m_count = points.Count();
+        for (Index leaf = GetFirstLeaf(); leaf < m_nodes.Count(); ++leaf)
+        {
+            const Node& node = m_nodes[leaf];
+            for (Index slot = node.begin; slot < node.begin + node.count; ++slot)
+            {
+                entries.EmplaceBack(Entry{ Vector3<T>(m_x[slot], m_y[slot], m_z[slot]), m_ids[slot] });
+            }
+        }
+        for (const Entry& entry : m_pending)
+        {
+            entries.EmplaceBack(entry);
+        }
+
+        BuildEntries(entries);
     }
 
     template<Floating T>
-    constexpr bool KDTree3<T>::Has(const Vector3<T>& point) const
+    void KDTree3<T>::SelectNth(Entry* pEntries, Index begin, Index nth, Index end, Index axis)
     {
-        Node* pNode = m_pRoot;
-        Index depth = 0;
-
-        while (pNode != nullptr)
+        while (end - begin > 1)
         {
-            Index axis = depth % 3;
-
-            if (point[axis] == pNode->data[axis])
+            // Median of three pivot, sorted input doesn't degrade
+            const T a = pEntries[begin].point[axis];
+            const T b = pEntries[begin + (end - begin) / 2].point[axis];
+            const T c = pEntries[end - 1].point[axis];
+            const T pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+            // Three way partition: [begin, less) < pivot, [less, greater) == pivot, [greater, end) > pivot. Duplicates don't degrade either
+            Index less = begin;
+            Index greater = end;
+            Index i = begin;
+            while (i < greater)
             {
-                return true;
+                const T value = pEntries[i].point[axis];
+                if (value < pivot)
+                {
+                    Swap(pEntries[less++], pEntries[i++]);
+                }
+                else if (value > pivot)
+                {
+                    Swap(pEntries[i], pEntries[--greater]);
+                }
+                else
+                {
+                    ++i;
+                }
             }
 
-            if (point[axis] < pNode->data[axis])
+            if (nth < less)
             {
-                pNode = pNode->pLeft;
+                end = less;
+            }
+            else if (nth >= greater)
+            {
+                begin = greater;
             }
             else
             {
-                pNode = pNode->pRight;
+                return;
             }
-
-            ++depth;
         }
-
-        return false;
     }
 
     template<Floating T>
-    constexpr DynamicArray<Vector3<T>> KDTree3<T>::FindNearest(const Vector3<T>& point, T threshold) const
+    constexpr T KDTree3<T>::GetDistance2(Index slot, const Vector3<T>& point) const
     {
-        DynamicArray<Vector3<T>> result;
-        RecurFindNearest(m_pRoot, point, threshold, 0, result);
-        return result;
+        const T dx = m_x[slot] - point.x;
+        const T dy = m_y[slot] - point.y;
+        const T dz = m_z[slot] - point.z;
+        return dx * dx + dy * dy + dz * dz;
     }
 
     template<Floating T>
-    constexpr typename KDTree3<T>::Node* KDTree3<T>::InternalBuild(const DynamicArray<Vector3<T>>& points, Index begin, Index end, Index depth)
+    Index KDTree3<T>::FindSlot(const Vector3<T>& point, Index& outLeaf) const
     {
-        if (begin >= end)
+        if (m_nodes.IsEmpty())
         {
-            return nullptr;
+            return kInvalidIndex;
         }
 
-        Index axis = depth % 3;
-        Index mid = begin + (end - begin) / 2;
+        const Index firstLeaf = GetFirstLeaf();
 
-        // Sort the points based on the axis so that we can find the median
-        DynamicArray<Vector3<T>> sortedpoints = points;
-        jpt::Sort(sortedpoints, [axis](const Vector3<T>& a, const Vector3<T>& b)
+        // Points equal to a split may be on either side
+        Index stack[kMaxDepth + 1];
+        Index stackCount = 0;
+        stack[stackCount++] = 0;
+
+        while (stackCount > 0)
+        {
+            const Index nodeIndex = stack[--stackCount];
+            const Node& node = m_nodes[nodeIndex];
+
+            if (nodeIndex >= firstLeaf)
             {
-                return a[axis] < b[axis];
-            });
+                for (Index slot = node.begin; slot < node.begin + node.count; ++slot)
+                {
+                    if (m_x[slot] == point.x && m_y[slot] == point.y && m_z[slot] == point.z)
+                    {
+                        outLeaf = nodeIndex;
+                        return slot;
+                    }
+                }
+                continue;
+            }
 
-        // Build the node and recur to the left and right child
-        KDTree3<T>::Node* pNode = JPT_NEW(KDTree3<T>::Node);
-        pNode->data = sortedpoints[mid];
-        pNode->pLeft = InternalBuild(sortedpoints, begin, mid, depth + 1);
-        pNode->pRight = InternalBuild(sortedpoints, mid + 1, end, depth + 1);
+            const T value = point[node.axis];
+            if (value >= node.split)
+            {
+                stack[stackCount++] = nodeIndex * 2 + 2;
+            }
+            if (value <= node.split)
+            {
+                stack[stackCount++] = nodeIndex * 2 + 1;
+            }
+        }
 
-        return pNode;
+        return kInvalidIndex;
     }
 
     template<Floating T>
-    void KDTree3<T>::RecurFindNearest(Node* pNode, const Vector3<T>& point, T threshold, Index depth, DynamicArray<Vector3<T>>& result) const
+    template<typename TFunc>
+    void KDTree3<T>::VisitInRadius(const Vector3<T>& point, T radius, TFunc&& func) const
     {
-        if (pNode == nullptr)
+        const T radius2 = radius * radius;
+
+        for (const Entry& entry : m_pending)
+        {
+            const T distance2 = entry.point.Distance2(point);
+            if (distance2 <= radius2)
+            {
+                func(entry.point, entry.id, distance2);
+            }
+        }
+
+        if (m_nodes.IsEmpty())
         {
             return;
         }
 
-        Index axis = depth % 3;
-        Index count = 0;
+        const Index firstLeaf = GetFirstLeaf();
 
-        // Check if the current node is closer than threshold, if so add it to the result
-        if (pNode->data.Distance(point) < threshold)
+        Index stack[kMaxDepth + 1];
+        Index stackCount = 0;
+        stack[stackCount++] = 0;
+
+        while (stackCount > 0)
         {
-            result.EmplaceBack(pNode->data);
-            ++count;
+            const Index nodeIndex = stack[--stackCount];
+            const Node& node = m_nodes[nodeIndex];
+
+            if (nodeIndex >= firstLeaf)
+            {
+                for (Index slot = node.begin; slot < node.begin + node.count; ++slot)
+                {
+                    const T distance2 = GetDistance2(slot, point);
+                    if (distance2 <= radius2)
+                    {
+                        func(Vector3<T>(m_x[slot], m_y[slot], m_z[slot]), m_ids[slot], distance2);
+                    }
+                }
+                continue;
+            }
+
+            // Only visit the sides the sphere reaches
+            const T offset = point[node.axis] - node.split;
+            if (offset >= -radius)
+            {
+                stack[stackCount++] = nodeIndex * 2 + 2;
+            }
+            if (offset <= radius)
+            {
+                stack[stackCount++] = nodeIndex * 2 + 1;
+            }
         }
+    }
+
+    template<Floating T>
+    void KDTree3<T>::SearchKNearest(Index nodeIndex, const Vector3<T>& point, Index k, Index& found, Index* pOutIds, T* pOutDistances2) const
+    {
+        const Node& node = m_nodes[nodeIndex];
 
-        // Recur to the left or right child based on the axis
-        if (point[axis] - threshold < pNode->data[axis])
+        if (nodeIndex >= GetFirstLeaf())
         {
-            RecurFindNearest(pNode->pLeft, point, threshold, depth + 1, result);
+            for (Index slot = node.begin; slot < node.begin + node.count; ++slot)
+            {
+                InsertNearest(m_ids[slot], GetDistance2(slot, point), k, found, pOutIds, pOutDistances2);
+            }
+            return;
         }
-        if (point[axis] + threshold >= pNode->data[axis])
+
+        // Nearer side first, so the far side is usually pruned by the k-th distance found so far
+        const T offset = point[node.axis] - node.split;
+        const Index nearIndex = offset <= 0 ? nodeIndex * 2 + 1 : nodeIndex * 2 + 2;
+        const Index farIndex  = offset <= 0 ? nodeIndex * 2 + 2 : nodeIndex * 2 + 1;
+
+        SearchKNearest(nearIndex, point, k, found, pOutIds, pOutDistances2);
+
+        if (found < k || offset * offset <= pOutDistances2[k - 1])
         {
-            RecurFindNearest(pNode->pRight, point, threshold, depth + 1, result);
+            SearchKNearest(farIndex, point, k, found, pOutIds, pOutDistances2);
         }
     }
 
     template<Floating T>
-    template<typename TFunc>
-    void KDTree3<T>::RecurPostOrderWalkNode(Node* pNode, TFunc&& func)
+    void KDTree3<T>::InsertNearest(Index id, T distance2, Index k, Index& found, Index* pOutIds, T* pOutDistances2)
     {
-        if (pNode)
+        if (found == k)
         {
-            RecurPostOrderWalkNode(pNode->pLeft, func);
-            RecurPostOrderWalkNode(pNode->pRight, func);
-            func(pNode);
+            if (distance2 >= pOutDistances2[k - 1])
+            {
+                return;
+            }
+            --found;
         }
+
+        // Insertion into the sorted outputs. k is small in practice
+        Index i = found;
+        while (i > 0 && pOutDistances2[i - 1] > distance2)
+        {
+            pOutIds[i] = pOutIds[i - 1];
+            pOutDistances2[i] = pOutDistances2[i - 1];
+            --i;
+        }
+
+        pOutIds[i] = id;
+        pOutDistances2[i] = distance2;
+        ++found;
     }
 }
 
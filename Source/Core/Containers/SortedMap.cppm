@@ -37,7 +37,7 @@ export namespace jpt
         using ConstIterator = jpt_private::ConstIterator_RedBlackTree<TData>;
 
         using Color         = typename Node::Color;
-        using WalkerFunc    = Function<void(const TKey&, TValue&)>;
+        using WalkerFunc    = FunctionRef<void(const TKey&, TValue&)>;
 
     public:
         static constexpr TComparator kComparator = TComparator();
@@ -117,7 +117,7 @@ export namespace jpt
         constexpr void PreOrderWalk(Node* pNode, const WalkerFunc& function);
         constexpr void InOrderWalk(Node* pNode, const WalkerFunc& function);
         constexpr void PostOrderWalk(Node* pNode, const WalkerFunc& function);
-        constexpr void PostOrderWalkNode(Node* pNode, const Function<void(Node*)>& func);
+        constexpr void PostOrderWalkNode(Node* pNode, FunctionRef<void(Node*)> func);
 
         // Search
         constexpr       Node* FindNode(const TKey& key);
@@ -512,7 +512,7 @@ export namespace jpt
     }
 
     template<Comparable TKey, typename TValue, typename TComparator, typename TAllocator>
-    constexpr void SortedMap<TKey, TValue, TComparator, TAllocator>::PostOrderWalkNode(Node* pNode, const Function<void(Node*)>& func)
+    constexpr void SortedMap<TKey, TValue, TComparator, TAllocator>::PostOrderWalkNode(Node* pNode, FunctionRef<void(Node*)> func)
     {
         if (pNode)
         {
@@ -33,7 +33,7 @@ export namespace jpt
         using ConstIterator = jpt_private::ConstIterator_RedBlackTree<TData>;
 
         using Color = typename Node::Color;
-        using WalkerFunc = Function<void(const TData&)>;
+        using WalkerFunc = FunctionRef<void(const TData&)>;
 
     public:
         static constexpr TComparator kComparator = TComparator();
@@ -82,7 +82,7 @@ export namespace jpt
         constexpr void PreOrderWalk(Node* pNode, const WalkerFunc& func);
         constexpr void InOrderWalk(Node* pNode, const WalkerFunc& func);
         constexpr void PostOrderWalk(Node* pNode, const WalkerFunc& func);
-        constexpr void PostOrderWalkNode(Node* pNode, const Function<void(Node*)>& func);
+        constexpr void PostOrderWalkNode(Node* pNode, FunctionRef<void(Node*)> func);
 
         // Searching
         constexpr       Node* FindNode(const TData& data);
@@ -377,7 +377,7 @@ export namespace jpt
     }
 
     template<Comparable TData, typename Comparator, typename TAllocator>
-    constexpr void SortedSet<TData, Comparator, TAllocator>::PostOrderWalkNode(Node* pNode, const Function<void(Node*)>& func)
+    constexpr void SortedSet<TData, Comparator, TAllocator>::PostOrderWalkNode(Node* pNode, FunctionRef<void(Node*)> func)
     {
         if (pNode)
         {
@@ -5,120 +5,109 @@ module;
 #include "Core/Memory/Memory.h"
 #include "Core/Validation/Assert.h"
 
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
 export module jpt.Function;
 
 import jpt.Allocator;
+import jpt.TypeDefs;
 import jpt.TypeTraits;
 import jpt.Utilities;
 
-export namespace jpt
+namespace jpt_private
 {
-    template<class>
-    class Function;
-
-    /** Wrapper for a function that can hold a global function, a lambda, or a member function
-        @example: jpt::Function<int32(int32, int32)> func; */
-    template<class TReturn, class... TArgs>
-    class Function<TReturn(TArgs...)>
+    enum class FunctionOperation : uint8
     {
-    public:
-        struct Function_Base
-        {
-            virtual ~Function_Base() {}
-            virtual TReturn operator()(TArgs... args) const = 0;
-            virtual Function_Base* Clone() const = 0;
+        Move,       /**< Move-constructs destination from source, then destroys source */
+        Copy,       /**< Copy-constructs destination from source */
+        Destroy,    /**< Destroys source */
+        GetCaller,  /**< Returns the caller if source is a member function, nullptr otherwise */
+    };
 
-            virtual       void* GetCaller()       { return nullptr; }
-            virtual const void* GetCaller() const { return nullptr; }
-        };
+    template<class TCaller, class TReturn, class... TArgs>
+    struct MemberCall
+    {
+        TCaller* pCaller;
+        TReturn(TCaller::* pMemberFunction)(TArgs...);
 
-        template<class TFunction>
-        struct FunctionData final : public Function_Base
+        TReturn operator()(TArgs... args) const
         {
-            TFunction m_function;
-
-            template<typename T>
-            FunctionData(T&& function)
-                : m_function(Forward<T>(function))
-            {
-            }
-
-            virtual TReturn operator()(TArgs... args) const override final
-            {
-                if constexpr (AreSameType<TReturn, void>)
-                {
-                    m_function(Forward<TArgs>(args)...);
-                }
-                else
-                {
-                    return m_function(Forward<TArgs>(args)...);
-                }
-            }
+            return (pCaller->*pMemberFunction)(jpt::Forward<TArgs>(args)...);
+        }
+    };
 
-            virtual Function_Base* Clone() const override final
-            {
-                return JPT_NEW(FunctionData, m_function);
-            }
-        };
+    template<class T>                                      constexpr bool kIsMemberCall                                          = false;
+    template<class TCaller, class TReturn, class... TArgs> constexpr bool kIsMemberCall<MemberCall<TCaller, TReturn, TArgs...>> = true;
+}
 
-        template<class TCaller>
-        struct MemberFunctionData final : public Function_Base
-        {
-            TCaller* m_pCaller;
-            TReturn(TCaller::* m_pMemberFunction)(TArgs...);
+export namespace jpt
+{
+    /** Bytes a jpt::Function holds its callable in without allocating. Fits a lambda capturing 6 pointers, and keeps sizeof(Function) at 64 */
+    constexpr size_t kFunctionInlineSize = 48;
 
-            MemberFunctionData(TCaller* pCaller, TReturn(TCaller::* pMemberFunction)(TArgs...))
-                : m_pCaller(pCaller)
-                , m_pMemberFunction(pMemberFunction)
-            {
-            }
+    template<class TSignature, size_t kInlineSize = kFunctionInlineSize, bool kIsCopyable = true>
+    class Function;
 
-            virtual TReturn operator()(TArgs... args) const override final
-            {
-                if constexpr (AreSameType<TReturn, void>)
-                {
-                    (m_pCaller->*m_pMemberFunction)(Forward<TArgs>(args)...);
-                }
-                else
-                {
-                    return (m_pCaller->*m_pMemberFunction)(Forward<TArgs>(args)...);
-                }
-            }
+    /** jpt::Function that can't be copied, and so accepts callables capturing move-only data
+        @example: jpt::MoveOnlyFunction<void()> job = [buffer = Move(buffer)]() { ... }; */
+    template<class TSignature, size_t kInlineSize = kFunctionInlineSize>
+    using MoveOnlyFunction = Function<TSignature, kInlineSize, false>;
 
-            virtual Function_Base* Clone() const override final
-            {
-                return JPT_NEW(MemberFunctionData, m_pCaller, m_pMemberFunction);
-            }
+    /** Wrapper for a function that can hold a global function, a lambda, or a member function
+        Callables up to kInlineSize bytes are stored inline, bigger or over-aligned ones are allocated.
+        Calls go through a single function pointer. Moving, copying and destroying go through another one, skipped for trivially copyable callables
+        @example: jpt::Function<int32(int32, int32)> func; */
+    template<class TReturn, class... TArgs, size_t kInlineSize, bool kIsCopyable>
+    class Function<TReturn(TArgs...), kInlineSize, kIsCopyable>
+    {
+        static_assert(kInlineSize >= sizeof(void*), "Inline storage must at least hold the pointer to an allocated callable");
 
-            virtual       void* GetCaller()       override { return m_pCaller; }
-            virtual const void* GetCaller() const override { return m_pCaller; }
-        };
+    private:
+        using Operation = jpt_private::FunctionOperation;
+        using Invoker   = TReturn(*)(void* pStorage, TArgs&&... args);
+        using Manager   = void*(*)(Operation operation, void* pDestination, void* pSource);
+
+        template<class TCallable>
+        static constexpr bool kIsInline = sizeof(TCallable) <= kInlineSize &&
+                                          alignof(TCallable) <= alignof(std::max_align_t) &&
+                                          std::is_nothrow_move_constructible_v<TCallable>;
+
+        /** Function pointers and lambdas capturing pointers or values. Copied with memcpy, nothing to destroy */
+        template<class TCallable>
+        static constexpr bool kIsTrivial = kIsInline<TCallable> &&
+                                           IsTriviallyCopyable<TCallable> &&
+                                           IsTriviallyDestructible<TCallable> &&
+                                           !jpt_private::kIsMemberCall<TCallable>;
 
     private:
-        // Switch to union and by value?
-        Function_Base* m_pFunction = nullptr;
+        alignas(std::max_align_t) unsigned char m_storage[kInlineSize];
+        Invoker m_invoker = nullptr;
+        Manager m_manager = nullptr;    /**< nullptr when the callable is trivial */
 
     public:
         constexpr Function() = default;
-        constexpr Function(const Function& other);
-        constexpr Function(Function&& other);
-        constexpr Function& operator=(const Function& other);
-        constexpr Function& operator=(Function&& other);
+        constexpr Function(const Function& other) requires kIsCopyable;
+        constexpr Function(Function&& other) noexcept;
+        constexpr Function& operator=(const Function& other) requires kIsCopyable;
+        constexpr Function& operator=(Function&& other) noexcept;
         constexpr ~Function();
 
-        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
+        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function>)
         constexpr Function(TFunction&& function);
 
-        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
+        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function>)
         constexpr Function& operator=(TFunction&& function);
 
         template<class TCaller>
         constexpr Function(TCaller* pCaller, TReturn(TCaller::* pMemberFunction)(TArgs...));
-    
+
         /** Connects a global function or lambda to this jpt::Function
             @example: func.Connect(&Add);
             @example: func.Connect([](int32 a, int32 b) -> int32 { return a - b; }); */
-        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
+        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function>)
         constexpr void Connect(TFunction&& function);
 
         /** Connects a member function to this jpt::Function
@@ -126,7 +115,7 @@ export namespace jpt
         template<class TCaller>
         constexpr void Connect(TCaller* pCaller, TReturn(TCaller::* pMemberFunction)(TArgs...));
 
-        /** Calls the connected function 
+        /** Calls the connected function
             @example: func(1, 2); */
         constexpr TReturn operator()(TArgs... args) const;
 
@@ -136,153 +125,377 @@ export namespace jpt
         constexpr bool IsMemberFunction() const;
         template<class TCaller>    constexpr       TCaller* GetCaller();
         template<class TCaller>    constexpr const TCaller* GetCaller() const;
+
+        /** @return     Whether TCallable would be stored inline, without allocating */
+        template<class TCallable>
+        static consteval bool IsStoredInline() { return kIsInline<std::decay_t<TCallable>>; }
+
+    private:
+        template<class TCallable, class... TParams>
+        constexpr void Emplace(TParams&&... params);
+
+        constexpr void MoveFrom(Function& other);
+        constexpr void CopyFrom(const Function& other);
+
+        template<class TCallable>
+        static TCallable* GetCallable(void* pStorage);
+
+        template<class TCallable>
+        static TReturn Invoke(void* pStorage, TArgs&&... args);
+
+        template<class TCallable>
+        static void* Manage(Operation operation, void* pDestination, void* pSource);
     };
 
-    template<class TReturn, class ...TArgs>
-    constexpr Function<TReturn(TArgs...)>::Function(const Function& other)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Function(const Function& other) requires kIsCopyable
     {
-        if (other.IsConnected())
-        {
-            m_pFunction = other.m_pFunction->Clone();
-        }
+        CopyFrom(other);
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr Function<TReturn(TArgs...)>::Function(Function&& other)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Function(Function&& other) noexcept
     {
-        m_pFunction = other.m_pFunction;
-        other.m_pFunction = nullptr;
+        MoveFrom(other);
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr Function<TReturn(TArgs...)>& Function<TReturn(TArgs...)>::operator=(const Function& other)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>& Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::operator=(const Function& other) requires kIsCopyable
     {
         if (this != &other)
         {
             Disconnect();
-            if (other.IsConnected())
-            {
-                m_pFunction = other.m_pFunction->Clone();
-            }
+            CopyFrom(other);
         }
 
         return *this;
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr Function<TReturn(TArgs...)>& Function<TReturn(TArgs...)>::operator=(Function&& other)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>& Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::operator=(Function&& other) noexcept
     {
         if (this != &other)
         {
             Disconnect();
-            m_pFunction = other.m_pFunction;
-            other.m_pFunction = nullptr;
+            MoveFrom(other);
         }
 
         return *this;
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr Function<TReturn(TArgs...)>::~Function()
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::~Function()
     {
         Disconnect();
     }
 
-    template<class TReturn, class ...TArgs>
-    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
-    constexpr Function<TReturn(TArgs...)>::Function(TFunction&& function)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...), kInlineSize, kIsCopyable>>)
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Function(TFunction&& function)
     {
         Connect(Forward<TFunction>(function));
     }
 
-    template<class TReturn, class ...TArgs>
-    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
-    constexpr Function<TReturn(TArgs...)>& Function<TReturn(TArgs...)>::operator=(TFunction&& function)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...), kInlineSize, kIsCopyable>>)
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>& Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::operator=(TFunction&& function)
     {
-        Disconnect();
         Connect(Forward<TFunction>(function));
         return *this;
     }
 
-    template<class TReturn, class ...TArgs>
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
     template<class TCaller>
-    constexpr Function<TReturn(TArgs...)>::Function(TCaller* pCaller, TReturn(TCaller::* pMemberFunction)(TArgs...))
+    constexpr Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Function(TCaller* pCaller, TReturn(TCaller::* pMemberFunction)(TArgs...))
     {
         Connect(pCaller, pMemberFunction);
     }
 
-    template<class TReturn, class ...TArgs>
-    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...)>>)
-    constexpr void Function<TReturn(TArgs...)>::Connect(TFunction&& function)
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, Function<TReturn(TArgs...), kInlineSize, kIsCopyable>>)
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Connect(TFunction&& function)
     {
+        using TCallable = std::decay_t<TFunction>;
+        static_assert(!kIsCopyable || std::is_copy_constructible_v<TCallable>, "Callable can't be copied, use jpt::MoveOnlyFunction");
+
         Disconnect();
-        m_pFunction = JPT_NEW(FunctionData<TFunction>, Forward<TFunction>(function));
+
+        if constexpr (std::is_pointer_v<TRemoveReference<TFunction>>)
+        {
+            if (!function)
+            {
+                return;
+            }
+        }
+
+        Emplace<TCallable>(Forward<TFunction>(function));
     }
 
-    template<class TReturn, class ...TArgs>
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
     template<class TCaller>
-    constexpr void Function<TReturn(TArgs...)>::Connect(TCaller* pCaller, TReturn(TCaller::*pMemberFunction)(TArgs...))
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Connect(TCaller* pCaller, TReturn(TCaller::*pMemberFunction)(TArgs...))
     {
+        using TMemberCall = jpt_private::MemberCall<TCaller, TReturn, TArgs...>;
+
         Disconnect();
-        m_pFunction = JPT_NEW(MemberFunctionData<TCaller>, pCaller, pMemberFunction);
+        Emplace<TMemberCall>(TMemberCall{ pCaller, pMemberFunction });
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr TReturn Function<TReturn(TArgs...)>::operator()(TArgs...args) const
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr TReturn Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::operator()(TArgs...args) const
     {
         JPT_ASSERT(IsConnected(), "Function is not connected");
 
-        if constexpr (AreSameType<TReturn, void>)
+        // Mutable lambdas are allowed to change their captures, like std::function
+        return m_invoker(const_cast<unsigned char*>(m_storage), Forward<TArgs>(args)...);
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Disconnect()
+    {
+        if (m_manager)
         {
-            (*m_pFunction)(Forward<TArgs>(args)...);
+            m_manager(Operation::Destroy, nullptr, m_storage);
+        }
+
+        m_invoker = nullptr;
+        m_manager = nullptr;
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr bool Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::IsConnected() const
+    {
+        return m_invoker != nullptr;
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr bool Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::IsMemberFunction() const
+    {
+        JPT_ASSERT(IsConnected(), "Function is not connected");
+        return m_manager && m_manager(Operation::GetCaller, nullptr, const_cast<unsigned char*>(m_storage)) != nullptr;
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCaller>
+    constexpr TCaller* Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::GetCaller()
+    {
+        JPT_ASSERT(IsMemberFunction(), "Function is not a member function");
+        return static_cast<TCaller*>(m_manager(Operation::GetCaller, nullptr, m_storage));
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCaller>
+    constexpr const TCaller* Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::GetCaller() const
+    {
+        JPT_ASSERT(IsMemberFunction(), "Function is not a member function");
+        return static_cast<const TCaller*>(m_manager(Operation::GetCaller, nullptr, const_cast<unsigned char*>(m_storage)));
+    }
+
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCallable, class... TParams>
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Emplace(TParams&&... params)
+    {
+        if constexpr (kIsInline<TCallable>)
+        {
+            new (m_storage) TCallable(Forward<TParams>(params)...);
         }
         else
         {
-            return (*m_pFunction)(Forward<TArgs>(args)...);
+            TCallable* pCallable = JPT_NEW(TCallable, Forward<TParams>(params)...);
+            std::memcpy(m_storage, &pCallable, sizeof(pCallable));
         }
+
+        m_invoker = &Invoke<TCallable>;
+        m_manager = kIsTrivial<TCallable> ? nullptr : &Manage<TCallable>;
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr void Function<TReturn(TArgs...)>::Disconnect()
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::MoveFrom(Function& other)
     {
-        Allocator<Function_Base>::Delete(m_pFunction);
-        m_pFunction = nullptr;
+        if (!other.IsConnected())
+        {
+            return;
+        }
+
+        if (other.m_manager)
+        {
+            other.m_manager(Operation::Move, m_storage, other.m_storage);
+        }
+        else
+        {
+            std::memcpy(m_storage, other.m_storage, kInlineSize);
+        }
+
+        m_invoker = other.m_invoker;
+        m_manager = other.m_manager;
+        other.m_invoker = nullptr;
+        other.m_manager = nullptr;
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr bool Function<TReturn(TArgs...)>::IsConnected() const
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    constexpr void Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::CopyFrom(const Function& other)
     {
-        return m_pFunction != nullptr;
+        if (!other.IsConnected())
+        {
+            return;
+        }
+
+        if (other.m_manager)
+        {
+            other.m_manager(Operation::Copy, m_storage, const_cast<unsigned char*>(other.m_storage));
+        }
+        else
+        {
+            std::memcpy(m_storage, other.m_storage, kInlineSize);
+        }
+
+        m_invoker = other.m_invoker;
+        m_manager = other.m_manager;
     }
 
-    template<class TReturn, class ...TArgs>
-    constexpr bool Function<TReturn(TArgs...)>::IsMemberFunction() const
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCallable>
+    TCallable* Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::GetCallable(void* pStorage)
     {
-        JPT_ASSERT(IsConnected(), "Function is not connected");
-        return m_pFunction->GetCaller() != nullptr;
+        if constexpr (kIsInline<TCallable>)
+        {
+            return std::launder(static_cast<TCallable*>(pStorage));
+        }
+        else
+        {
+            TCallable* pCallable = nullptr;
+            std::memcpy(&pCallable, pStorage, sizeof(pCallable));
+            return pCallable;
+        }
     }
 
-    template<class TReturn, class ...TArgs>
-    template<class TCaller>
-    constexpr TCaller* Function<TReturn(TArgs...)>::GetCaller()
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCallable>
+    TReturn Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Invoke(void* pStorage, TArgs&&... args)
     {
-        JPT_ASSERT(IsMemberFunction(), "Function is not a member function");
+        return (*GetCallable<TCallable>(pStorage))(Forward<TArgs>(args)...);
+    }
 
-        MemberFunctionData<TCaller>* pMemberFunctionData = static_cast<MemberFunctionData<TCaller>*>(m_pFunction);
-        JPT_ASSERT(pMemberFunctionData, "Failed converting member function to TCaller");
+    template<class TReturn, class ...TArgs, size_t kInlineSize, bool kIsCopyable>
+    template<class TCallable>
+    void* Function<TReturn(TArgs...), kInlineSize, kIsCopyable>::Manage(Operation operation, void* pDestination, void* pSource)
+    {
+        TCallable* pCallable = GetCallable<TCallable>(pSource);
 
-        return pMemberFunctionData->m_pCaller;
+        switch (operation)
+        {
+            case Operation::Move:
+            {
+                if constexpr (kIsInline<TCallable>)
+                {
+                    new (pDestination) TCallable(Move(*pCallable));
+                    pCallable->~TCallable();
+                }
+                else
+                {
+                    std::memcpy(pDestination, &pCallable, sizeof(pCallable));
+                }
+                return nullptr;
+            }
+            case Operation::Copy:
+            {
+                if constexpr (kIsCopyable && kIsInline<TCallable>)
+                {
+                    new (pDestination) TCallable(*pCallable);
+                }
+                else if constexpr (kIsCopyable)
+                {
+                    TCallable* pCopy = JPT_NEW(TCallable, *pCallable);
+                    std::memcpy(pDestination, &pCopy, sizeof(pCopy));
+                }
+                return nullptr;
+            }
+            case Operation::Destroy:
+            {
+                if constexpr (kIsInline<TCallable>)
+                {
+                    pCallable->~TCallable();
+                }
+                else
+                {
+                    JPT_DELETE(pCallable);
+                }
+                return nullptr;
+            }
+            case Operation::GetCaller:
+            {
+                if constexpr (jpt_private::kIsMemberCall<TCallable>)
+                {
+                    return pCallable->pCaller;
+                }
+                return nullptr;
+            }
+        }
+
+        return nullptr;
     }
 
-    template<class TReturn, class ...TArgs>
-    template<class TCaller>
-    constexpr const TCaller* Function<TReturn(TArgs...)>::GetCaller() const
+    template<class>
+    class FunctionRef;
+
+    /** Non-owning reference to a callable, for parameters that are only called, never stored. Two pointers wide, never allocates
+        @note   Doesn't extend the lifetime of what it references. Binding a temporary lambda is only safe as a function argument
+        @example: void ForEach(jpt::FunctionRef<void(int32)> func);
+                  ForEach([&sum](int32 i) { sum += i; }); */
+    template<class TReturn, class... TArgs>
+    class FunctionRef<TReturn(TArgs...)>
     {
-        JPT_ASSERT(IsMemberFunction(), "Function is not a member function");
+    private:
+        using FunctionPointer = TReturn(*)(TArgs...);
 
-        const MemberFunctionData<TCaller>* pMemberFunctionData = static_cast<const MemberFunctionData<TCaller>*>(m_pFunction);
-        JPT_ASSERT(pMemberFunctionData, "Failed converting member function to TCaller");
+        /** Global functions are held by value, their pointer can't go through void* */
+        union Target
+        {
+            void* pCallable;
+            FunctionPointer pFunction;
+        };
 
-        return pMemberFunctionData->m_pCaller;
+        using Invoker = TReturn(*)(Target target, TArgs&&... args);
+
+    private:
+        Target m_target;
+        Invoker m_invoker;
+
+    public:
+        template<class TFunction> requires (!AreSameType<TDecay<TFunction>, FunctionRef>)
+        constexpr FunctionRef(TFunction&& function);
+
+        constexpr TReturn operator()(TArgs... args) const;
+    };
+
+    template<class TReturn, class... TArgs>
+    template<class TFunction> requires (!AreSameType<TDecay<TFunction>, FunctionRef<TReturn(TArgs...)>>)
+    constexpr FunctionRef<TReturn(TArgs...)>::FunctionRef(TFunction&& function)
+    {
+        using TCallable = TRemoveReference<TFunction>;
+
+        if constexpr (std::is_function_v<TCallable> || AreSameType<std::decay_t<TCallable>, FunctionPointer>)
+        {
+            m_target.pFunction = function;
+            m_invoker = [](Target target, TArgs&&... args) -> TReturn
+                {
+                    JPT_ASSERT(target.pFunction, "FunctionRef references a null function");
+                    return target.pFunction(Forward<TArgs>(args)...);
+                };
+        }
+        else
+        {
+            m_target.pCallable = const_cast<void*>(static_cast<const void*>(&function));
+            m_invoker = [](Target target, TArgs&&... args) -> TReturn
+                {
+                    return (*static_cast<TCallable*>(target.pCallable))(Forward<TArgs>(args)...);
+                };
+        }
+    }
+
+    template<class TReturn, class... TArgs>
+    constexpr TReturn FunctionRef<TReturn(TArgs...)>::operator()(TArgs... args) const
+    {
+        return m_invoker(m_target, Forward<TArgs>(args)...);
     }
 }
\ No newline at end of file
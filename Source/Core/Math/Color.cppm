@@ -102,9 +102,9 @@ export namespace jpt
     constexpr uint64 Hash(Color color) noexcept
     {
         uint64 hash = jpt::Hash(color.r);
-        hash ^= jpt::Hash(color.g) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= jpt::Hash(color.b) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= jpt::Hash(color.a) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash = HashCombine(hash, jpt::Hash(color.g));
+        hash = HashCombine(hash, jpt::Hash(color.b));
+        hash = HashCombine(hash, jpt::Hash(color.a));
         return hash;
     }
 
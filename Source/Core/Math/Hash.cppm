@@ -2,22 +2,205 @@
 
 module;
 
+#include <bit>
 #include <concepts>
+#include <cstring>
 #include <string>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
 
 export module jpt.Hash;
 
 import jpt.Concepts;
 import jpt.TypeDefs;
 
+namespace jpt_private
+{
+    /** wyhash secret. Odd, with balanced bits in every byte */
+    constexpr uint64 kHashSecret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+    /** Full 64x64 bit product. Low half to a, high half to b */
+    constexpr void MultiplyFull(uint64& a, uint64& b)
+    {
+        if (!std::is_constant_evaluated())
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+            return;
+#elif defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<uint64>(product);
+            b = static_cast<uint64>(product >> 64);
+            return;
+#endif
+        }
+
+        const uint64 aHigh = a >> 32, aLow = static_cast<uint32>(a);
+        const uint64 bHigh = b >> 32, bLow = static_cast<uint32>(b);
+        const uint64 high = aHigh * bHigh, middle0 = aHigh * bLow, middle1 = bHigh * aLow, low = aLow * bLow;
+
+        const uint64 t = low + (middle0 << 32);
+        uint64 carry = t < low;
+        const uint64 lo = t + (middle1 << 32);
+        carry += lo < t;
+
+        a = lo;
+        b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+    }
+
+    constexpr uint64 Mix(uint64 a, uint64 b)
+    {
+        MultiplyFull(a, b);
+        return a ^ b;
+    }
+
+    /** Little-endian bytes [offset, offset + count) of the string's memory. count <= 8 */
+    template<typename TChar>
+    constexpr uint64 ReadBytes(const TChar* pData, size_t offset, size_t count)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            uint64 value = 0;
+            std::memcpy(&value, reinterpret_cast<const char*>(pData) + offset, count);
+            return value;
+        }
+
+        // Same bytes, one char at a time, as reinterpret_cast isn't allowed here
+        using TUnsigned = std::make_unsigned_t<TChar>;
+        uint64 value = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t byte = offset + i;
+            const uint64 c = static_cast<TUnsigned>(pData[byte / sizeof(TChar)]);
+            value |= ((c >> (8 * (byte % sizeof(TChar)))) & 0xFF) << (8 * i);
+        }
+        return value;
+    }
+
+    template<typename TChar> constexpr uint64 Read8(const TChar* pData, size_t offset) { return ReadBytes(pData, offset, 8); }
+    template<typename TChar> constexpr uint64 Read4(const TChar* pData, size_t offset) { return ReadBytes(pData, offset, 4); }
+    template<typename TChar> constexpr uint64 Read1(const TChar* pData, size_t offset) { return ReadBytes(pData, offset, 1); }
+}
+
 export namespace jpt
 {
+    /** Hashes the memory of count chars, 8 bytes at a time (wyhash).
+        Gives the same value at compile time and runtime, so a literal's hash can be a constant that matches String's */
+    template<typename TChar>
+    constexpr uint64 HashString(const TChar* str, size_t count, uint64 seed = 0)
+    {
+        using namespace jpt_private;
+
+        const size_t size = count * sizeof(TChar);
+        seed ^= Mix(seed ^ kHashSecret[0], kHashSecret[1]);
+
+        uint64 a = 0;
+        uint64 b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                const size_t quarter = (size >> 3) << 2;
+                a = (Read4(str, 0) << 32) | Read4(str, quarter);
+                b = (Read4(str, size - 4) << 32) | Read4(str, size - 4 - quarter);
+            }
+            else if (size > 0)
+            {
+                a = (Read1(str, 0) << 16) | (Read1(str, size >> 1) << 8) | Read1(str, size - 1);
+            }
+        }
+        else
+        {
+            size_t offset = 0;
+            size_t remaining = size;
+
+            // Three independent lanes keep the multipliers busy
+            if (remaining >= 48)
+            {
+                uint64 seed1 = seed;
+                uint64 seed2 = seed;
+                do
+                {
+                    seed  = Mix(Read8(str, offset)      ^ kHashSecret[1], Read8(str, offset + 8)  ^ seed);
+                    seed1 = Mix(Read8(str, offset + 16) ^ kHashSecret[2], Read8(str, offset + 24) ^ seed1);
+                    seed2 = Mix(Read8(str, offset + 32) ^ kHashSecret[3], Read8(str, offset + 40) ^ seed2);
+                    offset += 48;
+                    remaining -= 48;
+                } while (remaining >= 48);
+
+                seed ^= seed1 ^ seed2;
+            }
+
+            while (remaining > 16)
+            {
+                seed = Mix(Read8(str, offset) ^ kHashSecret[1], Read8(str, offset + 8) ^ seed);
+                offset += 16;
+                remaining -= 16;
+            }
+
+            // Last 16 bytes, overlapping what's already consumed
+            a = Read8(str, offset + remaining - 16);
+            b = Read8(str, offset + remaining - 8);
+        }
+
+        a ^= kHashSecret[1];
+        b ^= seed;
+        MultiplyFull(a, b);
+        return Mix(a ^ kHashSecret[0] ^ size, b ^ kHashSecret[1]);
+    }
+
+    /** Hashes raw memory */
+    inline uint64 HashBytes(const void* pData, size_t size, uint64 seed = 0)
+    {
+        return HashString(static_cast<const char*>(pData), size, seed);
+    }
+
+    /** Scrambles every input bit into every output bit. Identity-like hashes of small integers would cluster in power-of-two tables */
+    constexpr uint64 HashInteger(uint64 value)
+    {
+        using namespace jpt_private;
+
+        // A single multiply leaves the top input bits under-mixed
+        return Mix(Mix(value ^ kHashSecret[0], kHashSecret[1]) ^ kHashSecret[2], kHashSecret[3]);
+    }
+
+    /** Order-dependent combination of two hashes */
+    constexpr uint64 HashCombine(uint64 seed, uint64 hash)
+    {
+        return jpt_private::Mix(seed ^ jpt_private::kHashSecret[0], hash ^ jpt_private::kHashSecret[1]);
+    }
+
     template<typename T>
     struct Hasher
     {
         constexpr uint64 operator()(const T& object) const
         {
-            return std::hash<T>()(object);
+            if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            {
+                return HashInteger(static_cast<uint64>(object));
+            }
+            else if constexpr (std::is_floating_point_v<T> && (sizeof(T) == sizeof(uint32) || sizeof(T) == sizeof(uint64)))
+            {
+                // 0.0 == -0.0, they must hash the same
+                if (object == T(0))
+                {
+                    return HashInteger(0);
+                }
+
+                using TBits = std::conditional_t<sizeof(T) == sizeof(uint32), uint32, uint64>;
+                return HashInteger(std::bit_cast<TBits>(object));
+            }
+            else if constexpr (std::is_pointer_v<T>)
+            {
+                return HashInteger(reinterpret_cast<uintptr>(object));
+            }
+            else
+            {
+                return std::hash<T>()(object);
+            }
         }
     };
 
@@ -29,10 +212,21 @@ export namespace jpt
 
     /** constexpr compile time hash functions, 32 and 64 bit
         @str: should be a null terminated string literal */
-    constexpr uint32 StringHash32(const char* const str, const uint32 value = 0x811c9dc5)            noexcept { return (str[0] ==  '\0') ? value : StringHash32(&str[1], (value ^ uint32(str[0])) * 0x1000193); }
-    constexpr uint64 StringHash64(const char* const str, const uint64 value = 0xcbf29ce484222325)    noexcept { return (str[0] ==  '\0') ? value : StringHash64(&str[1], (value ^ uint64(str[0])) * 0x100000001b3); }
-    constexpr uint32 StringHash32(const wchar_t* const str, const uint32 value = 0x811c9dc5)         noexcept { return (str[0] == L'\0') ? value : StringHash32(&str[1], (value ^ uint32(str[0])) * 0x1000193); }
-    constexpr uint64 StringHash64(const wchar_t* const str, const uint64 value = 0xcbf29ce484222325) noexcept { return (str[0] == L'\0') ? value : StringHash64(&str[1], (value ^ uint64(str[0])) * 0x100000001b3); }
+    template<typename TChar>
+    constexpr size_t HashStringLength(const TChar* const str) noexcept
+    {
+        size_t count = 0;
+        while (str[count] != TChar(0))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    constexpr uint64 StringHash64(const char* const str)    noexcept { return HashString(str, HashStringLength(str)); }
+    constexpr uint64 StringHash64(const wchar_t* const str) noexcept { return HashString(str, HashStringLength(str)); }
+    constexpr uint32 StringHash32(const char* const str)    noexcept { const uint64 hash = StringHash64(str); return static_cast<uint32>(hash ^ (hash >> 32)); }
+    constexpr uint32 StringHash32(const wchar_t* const str) noexcept { const uint64 hash = StringHash64(str); return static_cast<uint32>(hash ^ (hash >> 32)); }
 
     constexpr uint64 Hash(const char* cStr)
     {
@@ -104,9 +104,9 @@ export namespace jpt
             };
 
         uint64 hash = jpt::Hash(round(color.r));
-        hash ^= jpt::Hash(round(color.g)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= jpt::Hash(round(color.b)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= jpt::Hash(round(color.a)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash = HashCombine(hash, jpt::Hash(round(color.g)));
+        hash = HashCombine(hash, jpt::Hash(round(color.b)));
+        hash = HashCombine(hash, jpt::Hash(round(color.a)));
         return hash;
     }
 
@@ -167,13 +167,13 @@ export namespace jpt
                 };
 
             uint64 hash = jpt::Hash(round(vector2.x));
-            hash ^= jpt::Hash(round(vector2.y)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(round(vector2.y)));
             return hash;
         }
         else
         {
             uint64 hash = jpt::Hash(vector2.x);
-            hash ^= jpt::Hash(vector2.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(vector2.y));
             return hash;
         }
     }
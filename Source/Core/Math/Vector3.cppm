@@ -180,15 +180,15 @@ export namespace jpt
                 };
 
             uint64 hash = jpt::Hash(round(vector3.x));
-            hash ^= jpt::Hash(round(vector3.y)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(round(vector3.z)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(round(vector3.y)));
+            hash = HashCombine(hash, jpt::Hash(round(vector3.z)));
             return hash;
         }
         else
         {
             uint64 hash = jpt::Hash(vector3.x);
-            hash ^= jpt::Hash(vector3.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(vector3.z) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(vector3.y));
+            hash = HashCombine(hash, jpt::Hash(vector3.z));
             return hash;
         }
     }
@@ -176,17 +176,17 @@ export namespace jpt
                 };
 
             uint64 hash = jpt::Hash(round(vector4.x));
-            hash ^= jpt::Hash(round(vector4.y)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(round(vector4.z)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(round(vector4.w)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(round(vector4.y)));
+            hash = HashCombine(hash, jpt::Hash(round(vector4.z)));
+            hash = HashCombine(hash, jpt::Hash(round(vector4.w)));
             return hash;
         }
         else
         {
             uint64 hash = jpt::Hash(vector4.x);
-            hash ^= jpt::Hash(vector4.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(vector4.z) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-            hash ^= jpt::Hash(vector4.w) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash = HashCombine(hash, jpt::Hash(vector4.y));
+            hash = HashCombine(hash, jpt::Hash(vector4.z));
+            hash = HashCombine(hash, jpt::Hash(vector4.w));
             return hash;
         }
     }
@@ -0,0 +1,140 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <limits>
+#include <memory>
+
+export module jpt.FrameAllocator;
+
+import jpt.FrameArena;
+import jpt.LinearArena;
+import jpt.Math;
+import jpt.TypeDefs;
+import jpt.TypeTraits;
+import jpt.Utilities;
+
+export namespace jpt
+{
+    /** Allocator<T> interface on top of the FrameArena. Plugs into any container's TAllocator slot.
+        Delete() and DeleteArray() only run destructors, the memory is released by the next FrameArena::BeginFrame()
+
+        @note   A container using this must not outlive the frame (or the next frame when double buffered)
+        @example
+            DynamicArray<Entity*, FrameAllocator<Entity*>> visibleEntities;
+            String_Base<char, FrameAllocator_DoubleBuffered<char>> message; */
+    template<typename T, bool kIsDoubleBuffered = false>
+    class FrameAllocator
+    {
+    private:
+        /** Arrays keep their count right before the first element so DeleteArray() can destroy them */
+        static constexpr size_t kArrayHeaderSize = Max(sizeof(size_t), alignof(T));
+
+    public:
+        template<typename ...TArgs>
+        static T* New(TArgs&&... args);
+
+        /** Same as Allocator<T>::NewArray, the first elements are constructed from args, the rest are value-initialized */
+        template<typename ...TArgs>
+        static T* NewArray(size_t count, TArgs&&... args);
+
+        static void Delete(T* pPointer);
+        static void DeleteArray(T* pArray);
+
+        template<typename ...TArgs>
+        static constexpr void Construct(T* pPointer, TArgs&&... args);
+        static constexpr void Destruct(T* pPointer);
+
+    private:
+        static void* Allocate(size_t size);
+    };
+
+    template<typename T>
+    using FrameAllocator_DoubleBuffered = FrameAllocator<T, true>;
+
+    template<typename T, bool kIsDoubleBuffered>
+    template<typename ...TArgs>
+    T* FrameAllocator<T, kIsDoubleBuffered>::New(TArgs&&... args)
+    {
+        return std::construct_at(static_cast<T*>(Allocate(sizeof(T))), Forward<TArgs>(args)...);
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    template<typename ...TArgs>
+    T* FrameAllocator<T, kIsDoubleBuffered>::NewArray(size_t count, TArgs&&... args)
+    {
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        // Check for overflow
+        JPT_ASSERT(count <= (std::numeric_limits<size_t>::max() - kArrayHeaderSize) / sizeof(T));
+        JPT_ASSERT(sizeof...(TArgs) <= count);
+
+        uint8* pMemory = static_cast<uint8*>(Allocate(kArrayHeaderSize + count * sizeof(T)));
+        T* pArray = reinterpret_cast<T*>(pMemory + kArrayHeaderSize);
+        *(reinterpret_cast<size_t*>(pArray) - 1) = count;
+
+        size_t i = 0;
+        ((std::construct_at(pArray + i, static_cast<T>(Forward<TArgs>(args))), ++i), ...);
+        for (; i < count; ++i)
+        {
+            std::construct_at(pArray + i);
+        }
+
+        return pArray;
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    void FrameAllocator<T, kIsDoubleBuffered>::Delete(T* pPointer)
+    {
+        if (pPointer)
+        {
+            std::destroy_at(pPointer);
+        }
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    void FrameAllocator<T, kIsDoubleBuffered>::DeleteArray(T* pArray)
+    {
+        if constexpr (!IsTriviallyDestructible<T>)
+        {
+            if (pArray)
+            {
+                const size_t count = *(reinterpret_cast<const size_t*>(pArray) - 1);
+                std::destroy_n(pArray, count);
+            }
+        }
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    template<typename ...TArgs>
+    constexpr void FrameAllocator<T, kIsDoubleBuffered>::Construct(T* pPointer, TArgs&& ...args)
+    {
+        std::construct_at(pPointer, Forward<TArgs>(args)...);
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    constexpr void FrameAllocator<T, kIsDoubleBuffered>::Destruct(T* pPointer)
+    {
+        std::destroy_at(pPointer);
+    }
+
+    template<typename T, bool kIsDoubleBuffered>
+    void* FrameAllocator<T, kIsDoubleBuffered>::Allocate(size_t size)
+    {
+        constexpr size_t kAlignment = Max(alignof(T), LinearArena::kDefaultAlignment);
+
+        if constexpr (kIsDoubleBuffered)
+        {
+            return FrameArena::GetInstance().AllocateDoubleBuffered(size, kAlignment);
+        }
+        else
+        {
+            return FrameArena::GetInstance().Allocate(size, kAlignment);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module jpt.FrameArena;
+
+namespace jpt
+{
+    FrameArena::FrameArena()
+        : m_frameArena(kDefaultCapacity)
+        , m_doubleBufferedArenas{ LinearArena(kDefaultCapacity), LinearArena(kDefaultCapacity) }
+    {
+    }
+
+    void FrameArena::BeginFrame()
+    {
+        ++m_frameIndex;
+
+        // The arena picked up this frame was filled two frames ago. Its data has had its extra frame
+        m_frameArena.Reset();
+        m_doubleBufferedArenas[m_frameIndex & 1].Reset();
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        return m_frameArena.Allocate(size, alignment);
+    }
+
+    void* FrameArena::AllocateDoubleBuffered(size_t size, size_t alignment)
+    {
+        return m_doubleBufferedArenas[m_frameIndex & 1].Allocate(size, alignment);
+    }
+}
\ No newline at end of file
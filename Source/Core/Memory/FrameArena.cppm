@@ -0,0 +1,45 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/Utilities.h"
+
+export module jpt.FrameArena;
+
+import jpt.LinearArena;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Per-frame scratch memory. Application::Run() calls BeginFrame() once per frame on the main thread
+        - Allocate():                 valid until the end of the current frame
+        - AllocateDoubleBuffered():   valid until the end of the next frame. For data produced this frame and consumed the next
+
+        @note   Main thread only */
+    class FrameArena
+    {
+    public:
+        static constexpr size_t kDefaultCapacity = 1024 * 1024;
+
+    private:
+        LinearArena m_frameArena;
+        LinearArena m_doubleBufferedArenas[2];
+        uint64 m_frameIndex = 0;
+
+    public:
+        JPT_DECLARE_SINGLETON(FrameArena);
+
+        /** Releases this frame's allocations, and the double buffered allocations of the previous frame */
+        void BeginFrame();
+
+        void* Allocate(size_t size, size_t alignment = LinearArena::kDefaultAlignment);
+        void* AllocateDoubleBuffered(size_t size, size_t alignment = LinearArena::kDefaultAlignment);
+
+        const LinearArena& GetFrameArena() const { return m_frameArena; }
+        const LinearArena& GetDoubleBufferedArena() const { return m_doubleBufferedArenas[m_frameIndex & 1]; }
+        uint64 GetFrameIndex() const { return m_frameIndex; }
+
+    private:
+        FrameArena();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <new>
+
+module jpt.LinearArena;
+
+import jpt.Math;
+
+namespace jpt
+{
+    /** Header of each block, the data follows right after. Aligned so the data starts at a kDefaultAlignment boundary */
+    struct alignas(LinearArena::kDefaultAlignment) LinearArena::Block
+    {
+        Block* pPrevious;
+        size_t capacity;
+        size_t offset;
+
+        uint8* GetData() { return reinterpret_cast<uint8*>(this + 1); }
+    };
+
+    LinearArena::LinearArena(size_t capacity)
+        : m_blockCapacity(capacity)
+    {
+        JPT_ASSERT(capacity > 0);
+        PushBlock(capacity);
+    }
+
+    LinearArena::~LinearArena()
+    {
+        FreeBlocks();
+    }
+
+    void* LinearArena::Allocate(size_t size, size_t alignment)
+    {
+        JPT_ASSERT(IsPowerOfTwo(alignment));
+
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        const size_t alignMask = alignment - 1;
+        uintptr address = reinterpret_cast<uintptr>(m_pCurrent->GetData() + m_pCurrent->offset);
+        size_t padding = ((address + alignMask) & ~alignMask) - address;
+
+        if (m_pCurrent->offset + padding + size > m_pCurrent->capacity)
+        {
+            // Worst case padding so the new block always fits
+            PushBlock(Max(m_blockCapacity, size + alignment));
+
+            address = reinterpret_cast<uintptr>(m_pCurrent->GetData());
+            padding = ((address + alignMask) & ~alignMask) - address;
+        }
+
+        uint8* pMemory = m_pCurrent->GetData() + m_pCurrent->offset + padding;
+        m_pCurrent->offset += padding + size;
+
+        m_usedBytes += padding + size;
+        m_peakBytes = Max(m_peakBytes, m_usedBytes);
+
+        return pMemory;
+    }
+
+    void LinearArena::Reset()
+    {
+        if (m_pCurrent->pPrevious)
+        {
+            // Overflowed since the last reset. Replace the chain with one block that fits the whole peak, plus headroom for alignment padding
+            m_blockCapacity = Max(m_blockCapacity, m_peakBytes + m_peakBytes / 2);
+            FreeBlocks();
+            PushBlock(m_blockCapacity);
+        }
+        else
+        {
+            m_pCurrent->offset = 0;
+        }
+
+        m_usedBytes = 0;
+    }
+
+    size_t LinearArena::GetCapacity() const
+    {
+        size_t capacity = 0;
+        for (const Block* pBlock = m_pCurrent; pBlock; pBlock = pBlock->pPrevious)
+        {
+            capacity += pBlock->capacity;
+        }
+        return capacity;
+    }
+
+    void LinearArena::PushBlock(size_t capacity)
+    {
+        Block* pBlock = static_cast<Block*>(::operator new(sizeof(Block) + capacity));
+        pBlock->pPrevious = m_pCurrent;
+        pBlock->capacity  = capacity;
+        pBlock->offset    = 0;
+
+        m_pCurrent = pBlock;
+    }
+
+    void LinearArena::FreeBlocks()
+    {
+        while (m_pCurrent)
+        {
+            Block* pPrevious = m_pCurrent->pPrevious;
+            ::operator delete(m_pCurrent);
+            m_pCurrent = pPrevious;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.LinearArena;
+
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Bump allocator. Allocate() moves an offset forward, nothing is freed individually, Reset() releases everything at once.
+        When the current block is full a new one is chained. Reset() then merges the chain into a single block big enough for the peak usage,
+        so a steady workload ends up with one block and zero OS allocations.
+
+        @note   Not thread-safe
+        @example
+            LinearArena arena(1024);
+            int32* pNumbers = static_cast<int32*>(arena.Allocate(sizeof(int32) * 16, alignof(int32)));
+            arena.Reset(); */
+    class LinearArena
+    {
+    public:
+        static constexpr size_t kDefaultAlignment = 16;
+
+    private:
+        struct Block;
+
+        Block* m_pCurrent      = nullptr;   /**< Newest block. Older ones are reached through Block::pPrevious */
+        size_t m_blockCapacity = 0;         /**< Capacity of the block allocated by the next Reset() */
+        size_t m_usedBytes     = 0;         /**< Bytes handed out since the last Reset(), including alignment padding */
+        size_t m_peakBytes     = 0;
+
+    public:
+        LinearArena(size_t capacity);
+        ~LinearArena();
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        /** @return     Memory valid until the next Reset(). nullptr if size is 0 */
+        void* Allocate(size_t size, size_t alignment = kDefaultAlignment);
+
+        /** Invalidates every allocation made since the last Reset() */
+        void Reset();
+
+        size_t GetUsedBytes() const { return m_usedBytes; }
+        size_t GetPeakBytes() const { return m_peakBytes; }
+        size_t GetCapacity() const;
+
+    private:
+        void PushBlock(size_t capacity);
+        void FreeBlocks();
+    };
+}
\ No newline at end of file
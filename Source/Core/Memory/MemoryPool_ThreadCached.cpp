@@ -0,0 +1,344 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <atomic>
+#include <new>
+
+module jpt.MemoryPool_ThreadCached;
+
+import jpt.Math;
+
+namespace jpt
+{
+    // std::atomic instead of jpt::Atomic, these need constant initialization. Pools may be constructed during static init
+    static std::atomic<MemoryPool_ThreadCached*> locPools[MemoryPool_ThreadCached::kMaxPools];
+    static std::atomic<uint32> locGenerations[MemoryPool_ThreadCached::kMaxPools];
+
+    static constexpr uint64 locPackHead(uint32 index, uint32 tag)
+    {
+        return (static_cast<uint64>(tag) << 32) | index;
+    }
+
+    static constexpr uint32 locGetHeadIndex(uint64 head)
+    {
+        return static_cast<uint32>(head & 0xFFFFFFFF);
+    }
+
+    static constexpr uint32 locGetHeadTag(uint64 head)
+    {
+        return static_cast<uint32>(head >> 32);
+    }
+
+    struct MemoryPool_ThreadCached::ThreadCache
+    {
+        uint32 head       = kInvalidBlock;
+        uint32 count      = 0;
+        uint32 generation = 0;
+    };
+
+    struct MemoryPool_ThreadCached::ThreadCacheTable
+    {
+        ThreadCache caches[kMaxPools];
+
+        /** Thread is exiting, give the cached blocks back to the pools that are still alive */
+        ~ThreadCacheTable()
+        {
+            for (uint32 slot = 0; slot < kMaxPools; ++slot)
+            {
+                ThreadCache& cache = caches[slot];
+                if (cache.count == 0)
+                {
+                    continue;
+                }
+
+                MemoryPool_ThreadCached* pPool = locPools[slot].load(std::memory_order_acquire);
+                if (pPool && pPool->m_generation == cache.generation)
+                {
+                    pPool->Spill(cache, cache.count);
+                }
+            }
+        }
+    };
+
+    thread_local MemoryPool_ThreadCached::ThreadCacheTable MemoryPool_ThreadCached::s_threadCaches;
+
+    MemoryPool_ThreadCached::MemoryPool_ThreadCached(const Config& config) noexcept
+        : m_config(config)
+        , m_freeHead(locPackHead(kInvalidBlock, 0))
+    {
+        // Free blocks store the next block's index in their data
+        JPT_ASSERT(config.blockSize >= sizeof(uint32));
+
+        // Ensure alignment is a power of 2
+        JPT_ASSERT(IsPowerOfTwo(config.alignment));
+
+        // Block indices are 32-bit, the chunk table is fixed
+        JPT_ASSERT(config.maxChunks > 0, "MemoryPool_ThreadCached requires a bounded maxChunks");
+        JPT_ASSERT(config.maxChunks * config.blocksPerChunk < kInvalidBlock);
+
+        // Header keeps the data aligned, slot size keeps the next header aligned
+        const size_t alignMask = config.alignment - 1;
+        m_headerSize = (sizeof(uint32) + alignMask) & ~alignMask;
+        m_slotSize   = m_headerSize + ((config.blockSize + alignMask) & ~alignMask);
+
+        m_ppChunks = new uint8*[config.maxChunks]{};
+
+        // Claim a slot in the thread cache tables
+        bool isRegistered = false;
+        for (uint32 slot = 0; slot < kMaxPools; ++slot)
+        {
+            MemoryPool_ThreadCached* pExpected = nullptr;
+            if (locPools[slot].compare_exchange_strong(pExpected, this, std::memory_order_acq_rel))
+            {
+                m_slot = slot;
+                m_generation = locGenerations[slot].fetch_add(1, std::memory_order_relaxed) + 1;
+                isRegistered = true;
+                break;
+            }
+        }
+        JPT_ASSERT(isRegistered, "Too many MemoryPool_ThreadCached alive at the same time");
+
+        // Allocate initial chunks
+        for (size_t i = 0; i < config.initialChunks && i < config.maxChunks; ++i)
+        {
+            uint32 first = kInvalidBlock;
+            uint32 last  = kInvalidBlock;
+            if (AllocateChunk(first, last))
+            {
+                PushShared(first, last);
+            }
+        }
+    }
+
+    MemoryPool_ThreadCached::~MemoryPool_ThreadCached() noexcept
+    {
+        locPools[m_slot].store(nullptr, std::memory_order_release);
+
+        for (size_t i = 0; i < m_config.maxChunks; ++i)
+        {
+            if (m_ppChunks[i])
+            {
+                ::operator delete(m_ppChunks[i], std::align_val_t{ m_config.alignment });
+            }
+        }
+
+        delete[] m_ppChunks;
+    }
+
+    void* MemoryPool_ThreadCached::New()
+    {
+        ThreadCache& cache = GetThreadCache();
+
+        if (cache.count == 0 && !Refill(cache))
+        {
+            return nullptr;
+        }
+
+        const uint32 index = cache.head;
+        cache.head = GetNextIndex(index);
+        --cache.count;
+
+        return GetSlotAddress(index) + m_headerSize;
+    }
+
+    void MemoryPool_ThreadCached::Delete(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        const uint32 index = *reinterpret_cast<uint32*>(static_cast<uint8*>(ptr) - m_headerSize);
+
+        ThreadCache& cache = GetThreadCache();
+        SetNextIndex(index, cache.head);
+        cache.head = index;
+        ++cache.count;
+
+        if (cache.count > kMaxCachedBlocks)
+        {
+            Spill(cache, kBatchSize);
+        }
+    }
+
+    void MemoryPool_ThreadCached::FlushThreadCache()
+    {
+        ThreadCache& cache = GetThreadCache();
+        if (cache.count > 0)
+        {
+            Spill(cache, cache.count);
+        }
+    }
+
+    MemoryPool_ThreadCached::ThreadCache& MemoryPool_ThreadCached::GetThreadCache()
+    {
+        ThreadCache& cache = s_threadCaches.caches[m_slot];
+
+        // Blocks of a destroyed pool that used the same slot. Its memory is gone, drop them
+        if (cache.generation != m_generation)
+        {
+            cache = ThreadCache{ kInvalidBlock, 0, m_generation };
+        }
+
+        return cache;
+    }
+
+    bool MemoryPool_ThreadCached::Refill(ThreadCache& cache)
+    {
+        for (uint32 i = 0; i < kBatchSize; ++i)
+        {
+            const uint32 index = PopShared();
+            if (index == kInvalidBlock)
+            {
+                break;
+            }
+
+            SetNextIndex(index, cache.head);
+            cache.head = index;
+            ++cache.count;
+        }
+
+        if (cache.count > 0)
+        {
+            return true;
+        }
+
+        // Shared list is empty too. Take one batch of a fresh chunk, share the rest
+        uint32 first = kInvalidBlock;
+        uint32 last  = kInvalidBlock;
+        if (!AllocateChunk(first, last))
+        {
+            return false;
+        }
+
+        const uint32 takeCount = Min(kBatchSize, last - first + 1);
+        const uint32 takeLast  = first + takeCount - 1;
+
+        if (takeLast != last)
+        {
+            PushShared(takeLast + 1, last);
+        }
+
+        SetNextIndex(takeLast, kInvalidBlock);
+        cache.head  = first;
+        cache.count = takeCount;
+
+        return true;
+    }
+
+    void MemoryPool_ThreadCached::Spill(ThreadCache& cache, uint32 count)
+    {
+        JPT_ASSERT(count > 0 && count <= cache.count);
+
+        // Cut the first count blocks off the cache. Walking the cache is thread local, no contention
+        const uint32 first = cache.head;
+        uint32 last = first;
+        for (uint32 i = 1; i < count; ++i)
+        {
+            last = GetNextIndex(last);
+        }
+
+        cache.head = GetNextIndex(last);
+        cache.count -= count;
+
+        PushShared(first, last);
+    }
+
+    uint32 MemoryPool_ThreadCached::PopShared()
+    {
+        uint64 head = m_freeHead.Load();
+
+        while (true)
+        {
+            const uint32 index = locGetHeadIndex(head);
+            if (index == kInvalidBlock)
+            {
+                return kInvalidBlock;
+            }
+
+            // The block may be popped and reused by another thread meanwhile, chunks are never freed before the pool
+            // so the read is safe, and the tag makes the CAS below fail in that case
+            const uint64 newHead = locPackHead(GetNextIndex(index), locGetHeadTag(head) + 1);
+            if (m_freeHead.CompareExchangeWeak(head, newHead))
+            {
+                return index;
+            }
+        }
+    }
+
+    void MemoryPool_ThreadCached::PushShared(uint32 firstIndex, uint32 lastIndex)
+    {
+        uint64 head = m_freeHead.Load();
+        uint64 newHead = 0;
+
+        do
+        {
+            SetNextIndex(lastIndex, locGetHeadIndex(head));
+            newHead = locPackHead(firstIndex, locGetHeadTag(head) + 1);
+        }
+        while (!m_freeHead.CompareExchangeWeak(head, newHead));
+    }
+
+    bool MemoryPool_ThreadCached::AllocateChunk(uint32& outFirst, uint32& outLast)
+    {
+        size_t chunkIndex = m_numChunks.Load();
+        if (chunkIndex >= m_config.maxChunks)
+        {
+            return false;
+        }
+
+        // Allocate before reserving an index. A reserved index is never given back, a failed allocation must not hold one
+        const size_t chunkSize = m_config.blocksPerChunk * m_slotSize;
+        uint8* pChunk = static_cast<uint8*>(::operator new(chunkSize, std::align_val_t{ m_config.alignment }, std::nothrow));
+        if (!pChunk)
+        {
+            return false;
+        }
+
+        do
+        {
+            // Another thread took the last index meanwhile
+            if (chunkIndex >= m_config.maxChunks)
+            {
+                ::operator delete(pChunk, std::align_val_t{ m_config.alignment });
+                return false;
+            }
+        }
+        while (!m_numChunks.CompareExchangeWeak(chunkIndex, chunkIndex + 1));
+
+        m_ppChunks[chunkIndex] = pChunk;
+
+        // Stamp every slot with its index and chain them in order
+        const uint32 first = static_cast<uint32>(chunkIndex * m_config.blocksPerChunk);
+        const uint32 last  = first + static_cast<uint32>(m_config.blocksPerChunk) - 1;
+        for (uint32 index = first; index <= last; ++index)
+        {
+            *reinterpret_cast<uint32*>(GetSlotAddress(index)) = index;
+            SetNextIndex(index, index == last ? kInvalidBlock : index + 1);
+        }
+
+        outFirst = first;
+        outLast  = last;
+        return true;
+    }
+
+    uint8* MemoryPool_ThreadCached::GetSlotAddress(uint32 index) const
+    {
+        const size_t chunkIndex = index / m_config.blocksPerChunk;
+        const size_t slotIndex  = index % m_config.blocksPerChunk;
+        return m_ppChunks[chunkIndex] + slotIndex * m_slotSize;
+    }
+
+    uint32 MemoryPool_ThreadCached::GetNextIndex(uint32 index) const
+    {
+        return *reinterpret_cast<const uint32*>(GetSlotAddress(index) + m_headerSize);
+    }
+
+    void MemoryPool_ThreadCached::SetNextIndex(uint32 index, uint32 nextIndex)
+    {
+        *reinterpret_cast<uint32*>(GetSlotAddress(index) + m_headerSize) = nextIndex;
+    }
+}
\ No newline at end of file
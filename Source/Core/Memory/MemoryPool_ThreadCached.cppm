@@ -0,0 +1,90 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.MemoryPool_ThreadCached;
+
+export import jpt.MemoryPool;
+
+import jpt.Atomic;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** A multi-threaded memory pool that never takes a mutex. Each thread keeps a small cache of free blocks,
+        New() and Delete() only touch that cache. The caches refill from and spill to a shared lock-free free list in batches.
+        The shared list head packs a 32-bit block index with a 32-bit tag, so a CAS never succeeds on a recycled head (ABA-safe).
+
+        @note   Config::maxChunks must be greater than 0, the chunk table is allocated up-front
+        @note   Blocks cached by a thread are returned to the pool when that thread exits, or when it calls FlushThreadCache()
+
+        @examples
+            MemoryPool::Config config
+            {
+                .blockSize = 64,
+                .blocksPerChunk = 4096,
+                .maxChunks = 16,
+                .alignment = 16
+            };
+            MemoryPool_ThreadCached pool(config);
+
+            // From any thread
+            void* pData = pool.New();
+            pool.Delete(pData); */
+    class MemoryPool_ThreadCached
+    {
+    public:
+        using Config = MemoryPool::Config;
+
+        static constexpr uint32 kInvalidBlock    = 0xFFFFFFFF;
+        static constexpr uint32 kBatchSize       = 32;             /**< How many blocks move between a thread cache and the shared list at once */
+        static constexpr uint32 kMaxCachedBlocks = kBatchSize * 2; /**< A thread cache spills one batch when it grows beyond this */
+        static constexpr uint32 kMaxPools        = 64;             /**< How many thread cached pools can be alive at the same time */
+
+    private:
+        struct ThreadCache;
+        struct ThreadCacheTable;
+        static thread_local ThreadCacheTable s_threadCaches;
+
+        Config m_config;
+        uint8** m_ppChunks = nullptr;   /**< Chunk table with maxChunks entries. A chunk is published here before any of its blocks are reachable */
+        Atomic<uint64> m_freeHead;      /**< Tagged head of the shared free list. Low 32 bits: block index. High 32 bits: tag */
+        Atomic<size_t> m_numChunks = 0;
+        size_t m_headerSize = 0;        /**< Hidden header before each block's data, stores the block's index */
+        size_t m_slotSize   = 0;        /**< Header plus aligned block size */
+        uint32 m_slot       = 0;        /**< Index of this pool in every thread's cache table */
+        uint32 m_generation = 0;        /**< Invalidates stale thread caches when the slot is reused by another pool */
+
+    public:
+        MemoryPool_ThreadCached(const Config& config) noexcept;
+        ~MemoryPool_ThreadCached() noexcept;
+
+        MemoryPool_ThreadCached(const MemoryPool_ThreadCached&) = delete;
+        MemoryPool_ThreadCached& operator=(const MemoryPool_ThreadCached&) = delete;
+
+        void* New();
+        void Delete(void* ptr);
+
+        /** Returns every block cached by the calling thread to the shared free list */
+        void FlushThreadCache();
+
+    private:
+        ThreadCache& GetThreadCache();
+
+        /** Moves up to kBatchSize blocks from the shared list, or a fresh chunk, into the cache
+            @return     false if the pool is exhausted */
+        bool Refill(ThreadCache& cache);
+
+        /** Moves count blocks from the front of the cache to the shared list with a single CAS */
+        void Spill(ThreadCache& cache, uint32 count);
+
+        uint32 PopShared();
+        void PushShared(uint32 firstIndex, uint32 lastIndex);
+
+        /** Allocates a new chunk and links all of its blocks into a chain [outFirst, outLast]
+            @return     false if maxChunks is reached or the OS allocation failed */
+        bool AllocateChunk(uint32& outFirst, uint32& outLast);
+
+        uint8* GetSlotAddress(uint32 index) const;
+        uint32 GetNextIndex(uint32 index) const;
+        void SetNextIndex(uint32 index, uint32 nextIndex);
+    };
+}
\ No newline at end of file
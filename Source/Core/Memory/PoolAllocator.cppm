@@ -0,0 +1,113 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <limits>
+#include <memory>
+
+export module jpt.PoolAllocator;
+
+import jpt.SizeClassAllocator;
+import jpt.Utilities;
+
+export namespace jpt
+{
+    /** Drop-in replacement of Allocator<T> backed by the SizeClassAllocator. Plugs into any container's TAllocator slot
+
+        @example
+            DynamicArray<int32, PoolAllocator<int32>> numbers;
+            String_Base<char, PoolAllocator<char>> str; */
+    template<typename T>
+    class PoolAllocator
+    {
+    public:
+        template<typename ...TArgs>
+        static T* New(TArgs&&... args);
+
+        /** Same as Allocator<T>::NewArray, the first elements are constructed from args, the rest are value-initialized */
+        template<typename ...TArgs>
+        static T* NewArray(size_t count, TArgs&&... args);
+
+        static void Delete(T* pPointer);
+        static void DeleteArray(T* pArray);
+
+        template<typename ...TArgs>
+        static constexpr void Construct(T* pPointer, TArgs&&... args);
+        static constexpr void Destruct(T* pPointer);
+    };
+
+    template<typename T>
+    template<typename ...TArgs>
+    T* PoolAllocator<T>::New(TArgs&&... args)
+    {
+        void* pMemory = SizeClassAllocator::GetInstance().Allocate(sizeof(T), alignof(T));
+        return std::construct_at(static_cast<T*>(pMemory), Forward<TArgs>(args)...);
+    }
+
+    template<typename T>
+    template<typename ...TArgs>
+    T* PoolAllocator<T>::NewArray(size_t count, TArgs&&... args)
+    {
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        // Check for overflow
+        JPT_ASSERT(count <= std::numeric_limits<size_t>::max() / sizeof(T));
+        JPT_ASSERT(sizeof...(TArgs) <= count);
+
+        T* pArray = static_cast<T*>(SizeClassAllocator::GetInstance().Allocate(count * sizeof(T), alignof(T)));
+
+        size_t i = 0;
+        ((std::construct_at(pArray + i, static_cast<T>(Forward<TArgs>(args))), ++i), ...);
+        for (; i < count; ++i)
+        {
+            std::construct_at(pArray + i);
+        }
+
+        return pArray;
+    }
+
+    template<typename T>
+    void PoolAllocator<T>::Delete(T* pPointer)
+    {
+        if (!pPointer)
+        {
+            return;
+        }
+
+        std::destroy_at(pPointer);
+        SizeClassAllocator::GetInstance().Deallocate(pPointer);
+    }
+
+    template<typename T>
+    void PoolAllocator<T>::DeleteArray(T* pArray)
+    {
+        if (!pArray)
+        {
+            return;
+        }
+
+        // The allocation header remembers the requested size, no need for a count prefix
+        SizeClassAllocator& allocator = SizeClassAllocator::GetInstance();
+        const size_t count = allocator.GetAllocationSize(pArray) / sizeof(T);
+        std::destroy_n(pArray, count);
+        allocator.Deallocate(pArray);
+    }
+
+    template<typename T>
+    template<typename ...TArgs>
+    constexpr void PoolAllocator<T>::Construct(T* pPointer, TArgs&& ...args)
+    {
+        std::construct_at(pPointer, Forward<TArgs>(args)...);
+    }
+
+    template<typename T>
+    constexpr void PoolAllocator<T>::Destruct(T* pPointer)
+    {
+        std::destroy_at(pPointer);
+    }
+}
\ No newline at end of file
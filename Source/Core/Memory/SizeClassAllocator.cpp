@@ -0,0 +1,214 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+
+#include <atomic>
+#include <new>
+
+module jpt.SizeClassAllocator;
+
+import jpt.Math;
+
+namespace jpt
+{
+    /** Sits right before every pointer handed out. kHeaderSize bytes, keeps the data 16-byte aligned */
+    struct AllocationHeader
+    {
+        uint64 size;        /**< Requested size */
+        uint32 sizeClass;   /**< Bin index, kLargeClass for over-sized or over-aligned requests */
+        uint16 offset;      /**< Distance from the start of the raw allocation to the data */
+        uint16 isPooled;    /**< 0 if the memory came from the OS, even when sizeClass is a bin (bin was exhausted) */
+    };
+    static_assert(sizeof(AllocationHeader) == SizeClassAllocator::kHeaderSize);
+
+    static constexpr size_t locBytesPerChunk = 64 * 1024;
+    static constexpr size_t locMaxChunks     = 256;
+
+    static constexpr uint32 locInvalidShard = 0xFFFFFFFF;
+    static std::atomic<uint32> locNextStatsShard = 0;
+    static thread_local uint32 locStatsShard = locInvalidShard;
+
+    static AllocationHeader* locGetHeader(void* pMemory)
+    {
+        return reinterpret_cast<AllocationHeader*>(static_cast<uint8*>(pMemory) - SizeClassAllocator::kHeaderSize);
+    }
+
+    static const AllocationHeader* locGetHeader(const void* pMemory)
+    {
+        return reinterpret_cast<const AllocationHeader*>(static_cast<const uint8*>(pMemory) - SizeClassAllocator::kHeaderSize);
+    }
+
+    SizeClassAllocator& SizeClassAllocator::GetInstance()
+    {
+        // Intentionally leaked. Static containers using this allocator may be destroyed after a function-local static would be
+        static SizeClassAllocator* s_pInstance = new SizeClassAllocator();
+        return *s_pInstance;
+    }
+
+    SizeClassAllocator::SizeClassAllocator()
+    {
+        for (uint32 sizeClass = 0; sizeClass < kSizeClassesCount; ++sizeClass)
+        {
+            const size_t blockSize = kHeaderSize + GetClassSize(sizeClass);
+
+            MemoryPool_ThreadCached::Config config;
+            config.blockSize      = blockSize;
+            config.blocksPerChunk = Max(locBytesPerChunk / blockSize, static_cast<size_t>(64));
+            config.initialChunks  = 0;
+            config.maxChunks      = locMaxChunks;
+            config.alignment      = kHeaderSize;
+
+            m_pBins[sizeClass] = new MemoryPool_ThreadCached(config);
+        }
+    }
+
+    void* SizeClassAllocator::Allocate(size_t size, size_t alignment)
+    {
+        JPT_ASSERT(IsPowerOfTwo(alignment));
+
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        if (alignment > kHeaderSize)
+        {
+            return AllocateLarge(size, alignment, kLargeClass);
+        }
+
+        const uint32 sizeClass = GetSizeClass(size);
+        if (sizeClass == kLargeClass)
+        {
+            return AllocateLarge(size, kHeaderSize, kLargeClass);
+        }
+
+        uint8* pBlock = static_cast<uint8*>(m_pBins[sizeClass]->New());
+        if (!pBlock)
+        {
+            // Bin reached maxChunks. Still counted against its class so the miss shows up in the stats
+            return AllocateLarge(size, kHeaderSize, sizeClass);
+        }
+
+        AllocationHeader* pHeader = reinterpret_cast<AllocationHeader*>(pBlock);
+        pHeader->size      = size;
+        pHeader->sizeClass = sizeClass;
+        pHeader->offset    = static_cast<uint16>(kHeaderSize);
+        pHeader->isPooled  = 1;
+
+        StatsCounters& counters = GetLocalCounters(sizeClass);
+        counters.hits.fetch_add(1, std::memory_order_relaxed);
+        counters.bytesInUse.fetch_add(size, std::memory_order_relaxed);
+
+        return pBlock + kHeaderSize;
+    }
+
+    void SizeClassAllocator::Deallocate(void* pMemory)
+    {
+        if (!pMemory)
+        {
+            return;
+        }
+
+        const AllocationHeader* pHeader = locGetHeader(pMemory);
+        const uint64 size      = pHeader->size;
+        const uint32 sizeClass = pHeader->sizeClass;
+
+        GetLocalCounters(sizeClass).bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+
+        if (pHeader->isPooled)
+        {
+            m_pBins[sizeClass]->Delete(static_cast<uint8*>(pMemory) - kHeaderSize);
+        }
+        else
+        {
+            // See AllocateLarge(), offset doubles as the alignment
+            const size_t offset = pHeader->offset;
+            ::operator delete(static_cast<uint8*>(pMemory) - offset, std::align_val_t{ offset });
+        }
+    }
+
+    size_t SizeClassAllocator::GetAllocationSize(const void* pMemory) const
+    {
+        JPT_ASSERT(pMemory);
+        return static_cast<size_t>(locGetHeader(pMemory)->size);
+    }
+
+    SizeClassAllocator::Stats SizeClassAllocator::GetStats(uint32 sizeClass) const
+    {
+        JPT_ASSERT(sizeClass < kSizeClassesCount);
+        return SumStats(sizeClass);
+    }
+
+    void SizeClassAllocator::LogStats() const
+    {
+        JPT_INFO("SizeClassAllocator stats:");
+
+        for (uint32 sizeClass = 0; sizeClass < kSizeClassesCount; ++sizeClass)
+        {
+            const Stats stats = SumStats(sizeClass);
+            if (stats.hits == 0 && stats.misses == 0)
+            {
+                continue;
+            }
+
+            JPT_INFO("    %4zu bytes: hits %llu, misses %llu, bytes in use %llu",
+                GetClassSize(sizeClass), stats.hits, stats.misses, stats.bytesInUse);
+        }
+
+        const Stats largeStats = GetLargeStats();
+        if (largeStats.misses > 0)
+        {
+            JPT_INFO("    large:      misses %llu, bytes in use %llu", largeStats.misses, largeStats.bytesInUse);
+        }
+    }
+
+    void* SizeClassAllocator::AllocateLarge(size_t size, size_t alignment, uint32 sizeClass)
+    {
+        // Data sits at the first alignment boundary after the header. Offset is then exactly the alignment
+        const size_t offset = Max(alignment, kHeaderSize);
+        JPT_ASSERT(offset <= 0x8000, "SizeClassAllocator supports alignment up to 32KB, offset is stored in 16 bits");
+
+        uint8* pRaw = static_cast<uint8*>(::operator new(offset + size, std::align_val_t{ offset }));
+        uint8* pData = pRaw + offset;
+
+        AllocationHeader* pHeader = locGetHeader(pData);
+        pHeader->size      = size;
+        pHeader->sizeClass = sizeClass;
+        pHeader->offset    = static_cast<uint16>(offset);
+        pHeader->isPooled  = 0;
+
+        StatsCounters& counters = GetLocalCounters(sizeClass);
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+        counters.bytesInUse.fetch_add(size, std::memory_order_relaxed);
+
+        return pData;
+    }
+
+    SizeClassAllocator::StatsCounters& SizeClassAllocator::GetLocalCounters(uint32 sizeClass)
+    {
+        if (locStatsShard == locInvalidShard) [[unlikely]]
+        {
+            locStatsShard = locNextStatsShard.fetch_add(1, std::memory_order_relaxed) % kStatsShardsCount;
+        }
+
+        const size_t counterIndex = (sizeClass == kLargeClass) ? kSizeClassesCount : sizeClass;
+        return m_statsShards[locStatsShard].classes[counterIndex];
+    }
+
+    SizeClassAllocator::Stats SizeClassAllocator::SumStats(size_t counterIndex) const
+    {
+        // Unsigned wrap-around makes the per-shard bytesInUse add up even when frees landed on another shard
+        Stats stats;
+        for (const StatsShard& shard : m_statsShards)
+        {
+            const StatsCounters& counters = shard.classes[counterIndex];
+            stats.hits       += counters.hits.load(std::memory_order_relaxed);
+            stats.misses     += counters.misses.load(std::memory_order_relaxed);
+            stats.bytesInUse += counters.bytesInUse.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+}
\ No newline at end of file
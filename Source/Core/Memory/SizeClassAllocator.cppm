@@ -0,0 +1,104 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <atomic>
+
+export module jpt.SizeClassAllocator;
+
+import jpt.MemoryPool_ThreadCached;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** General purpose allocator that serves small requests from power-of-two size class bins, each bin is a MemoryPool_ThreadCached.
+        Requests bigger than the largest class, over-aligned requests, and requests made while a bin is exhausted fall through to the OS.
+        Every allocation carries a small header so Deallocate() doesn't need the size back.
+
+        @note   Never destroyed. Containers with static lifetime may free their memory after every other static is gone */
+    class SizeClassAllocator
+    {
+    public:
+        static constexpr size_t kSizeClassesCount = 8;     /**< 16, 32, 64, ... 2048 bytes */
+        static constexpr size_t kMinClassSize     = 16;
+        static constexpr size_t kMaxClassSize     = kMinClassSize << (kSizeClassesCount - 1);
+        static constexpr size_t kHeaderSize       = 16;    /**< Also the alignment guaranteed by the bins */
+        static constexpr uint32 kLargeClass       = 0xFFFFFFFF;
+
+        /** Snapshot summed over every shard */
+        struct Stats
+        {
+            uint64 hits       = 0;   /**< Allocations served by the bin */
+            uint64 misses     = 0;   /**< Allocations that fell through to the OS */
+            uint64 bytesInUse = 0;   /**< Requested bytes currently alive */
+        };
+
+    private:
+        static constexpr size_t kStatsShardsCount = 16;
+        static constexpr size_t kCacheLineSize    = 64;
+
+        struct StatsCounters
+        {
+            std::atomic<uint64> hits       = 0;
+            std::atomic<uint64> misses     = 0;
+            std::atomic<uint64> bytesInUse = 0;   /**< Wraps below zero when freed on another shard. Only the sum is meaningful */
+        };
+
+        /** Counters of one group of threads. [kSizeClassesCount] is the large class */
+        struct alignas(kCacheLineSize) StatsShard
+        {
+            StatsCounters classes[kSizeClassesCount + 1];
+        };
+
+    private:
+        MemoryPool_ThreadCached* m_pBins[kSizeClassesCount] = {};
+        StatsShard m_statsShards[kStatsShardsCount];   /**< Threads are spread over the shards, so allocating never contends on a shared cache line */
+
+    public:
+        static SizeClassAllocator& GetInstance();
+
+        void* Allocate(size_t size, size_t alignment = kHeaderSize);
+        void Deallocate(void* pMemory);
+
+        /** @return     Requested size of an allocation made by this allocator */
+        size_t GetAllocationSize(const void* pMemory) const;
+
+        /** @return     Index of the bin serving size bytes, kLargeClass if none */
+        static constexpr uint32 GetSizeClass(size_t size);
+        static constexpr size_t GetClassSize(uint32 sizeClass) { return kMinClassSize << sizeClass; }
+
+        Stats GetStats(uint32 sizeClass) const;
+        Stats GetLargeStats() const { return SumStats(kSizeClassesCount); }
+
+        /** Logs hit/miss/bytes-in-use of every size class that has seen traffic */
+        void LogStats() const;
+
+    private:
+        SizeClassAllocator();
+        ~SizeClassAllocator() = default;
+
+        SizeClassAllocator(const SizeClassAllocator&) = delete;
+        SizeClassAllocator& operator=(const SizeClassAllocator&) = delete;
+
+        void* AllocateLarge(size_t size, size_t alignment, uint32 sizeClass);
+
+        /** @return     The calling thread's counters of sizeClass, kLargeClass included */
+        StatsCounters& GetLocalCounters(uint32 sizeClass);
+        Stats SumStats(size_t counterIndex) const;
+    };
+
+    constexpr uint32 SizeClassAllocator::GetSizeClass(size_t size)
+    {
+        if (size > kMaxClassSize)
+        {
+            return kLargeClass;
+        }
+
+        uint32 sizeClass = 0;
+        while (GetClassSize(sizeClass) < size)
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+}
\ No newline at end of file
@@ -16,6 +16,8 @@ export import jpt.ArrayView;
 export import jpt.Deque;
 export import jpt.DynamicArray;
 export import jpt.HashMap;
+export import jpt.HashMap_Flat;
+export import jpt.HashSet_Flat;
 export import jpt.Heap;
 export import jpt.LinkedList;
 export import jpt.Queue;
@@ -58,6 +60,12 @@ export import jpt.SharedPtr;
 export import jpt.UniquePtr;
 export import jpt.WeakPtr;
 export import jpt.MemoryPool;
+export import jpt.MemoryPool_ThreadCached;
+export import jpt.SizeClassAllocator;
+export import jpt.PoolAllocator;
+export import jpt.LinearArena;
+export import jpt.FrameArena;
+export import jpt.FrameAllocator;
 
 // Strings
 export import jpt.String;
@@ -5,12 +5,15 @@ module;
 #include "Core/Validation/Assert.h"
 #include "Core/Memory/Memory.h"
 
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <type_traits>
 
 export module jpt.Serializer;
 
 import jpt.Allocator;
+import jpt.TypeDefs;
 
 export namespace jpt
 {
@@ -29,13 +32,22 @@ export namespace jpt
 
         ReadBinary  = Read  | Binary,
         WriteBinary = Write | Binary,
+        AppendBinary = Append | Binary,
         ReadAll     = Read  | Binary | Truncate,
         WriteAll    = Write | Binary | Truncate,
         ReadWrite   = Read  | Write,
+        ReadWriteBinary = Read | Write | Binary,
 
         All = Read | Write | Binary | Truncate,
     };
 
+    enum class SerializerBackend : uint8
+    {
+        None,
+        File,       /**< std::fstream behind a kBlockSize buffer */
+        Memory,     /**< Growable buffer owned by the serializer, or a read-only view of caller's bytes */
+    };
+
     class Serializer;
 
     template<typename T>
@@ -48,51 +60,162 @@ export namespace jpt
     template<typename T>                constexpr bool IsSerializeOverridden    = false;
     template<SerializationOverridden T> constexpr bool IsSerializeOverridden<T> = true;
 
+    /** Writes and reads raw bytes and objects, to a file or to memory.
+        File writes and reads go through a kBlockSize buffer, so serializing containers element by element doesn't make a stream call per element.
+        Values are stored in native byte order. WriteHeader() tags the data so ReadHeader() can detect the other byte order, then arithmetic Read()s swap bytes.
+        Sections prefix their size, so a reader skips the fields a newer writer appended
+
+        @example
+            jpt::Serializer serializer;
+            serializer.OpenMemory();
+            serializer.WriteHeader(kSaveMagic, kSaveVersion);
+            const size_t section = serializer.BeginSection();
+            serializer.Write(player);
+            serializer.EndSection(section);
+
+            // Elsewhere, possibly an older build
+            jpt::Serializer reader;
+            reader.OpenMemory(pData, size);
+            uint32 version = 0;
+            if (reader.ReadHeader(kSaveMagic, version))
+            {
+                const size_t sectionEnd = reader.BeginReadSection();
+                reader.Read(player);
+                reader.EndReadSection(sectionEnd);
+            } */
     class Serializer
     {
+    public:
+        static constexpr size_t kBlockSize = 64 * 1024;
+
     private:
         std::fstream m_stream;
 
+        char* m_pBlock = nullptr;           /**< File backend buffer */
+        size_t m_pendingWriteSize = 0;      /**< Bytes in m_pBlock not written to the stream yet */
+        size_t m_readBegin = 0;             /**< Buffered read bytes are [m_readBegin, m_readEnd) of m_pBlock */
+        size_t m_readEnd = 0;
+
+        char* m_pMemory = nullptr;          /**< Memory backend data */
+        size_t m_memorySize = 0;
+        size_t m_memoryCapacity = 0;
+        size_t m_memoryCursor = 0;
+        bool m_isMemoryOwned = false;
+
+        SerializerBackend m_backend = SerializerBackend::None;
+        bool m_isByteSwapped = false;       /**< Data comes from the other endianness */
+        bool m_hasFailed = false;
+
     public:
         Serializer() = default;
         Serializer(const wchar_t* path, SerializerMode mode);
         ~Serializer();
 
+        Serializer(const Serializer&) = delete;
+        Serializer& operator=(const Serializer&) = delete;
+
         void Open(const wchar_t* path, SerializerMode mode);
+
+        /** Writes to a growable buffer. GetMemory() holds the result */
+        void OpenMemory(size_t initialCapacity = 0);
+
+        /** Reads from caller's bytes, which must outlive the serializer. Writing isn't allowed */
+        void OpenMemory(const char* pData, size_t size);
+
         bool IsOpen() const;
+
+        /** Writes pending bytes, then closes the file or frees the memory */
         void Close();
 
-        /** Writes raw buffer for given size to disk */
+        /** Writes raw buffer for given size */
         void Write(const char* buffer, size_t sizeInBytes);
 
-        /** Writes object without built-in Serialize() to disk */
+        /** Writes object without built-in Serialize() */
         template<typename T> 
         requires(!SerializationOverridden<T>)
         void Write(const T& obj);
 
-        /** Writes object with built-in Serialize() to disk */
+        /** Writes object with built-in Serialize() */
         template<SerializationOverridden T> 
         void Write(const T& obj);
 
-        /** Reads raw buffer for given size from disk */
+        /** Writes count elements. Trivially copyable ones in a single copy */
+        template<typename T>
+        void WriteArray(const T* pElements, size_t count);
+
+        /** Hands the buffered writes to the OS */
+        void Flush();
+
+        /** Reads raw buffer for given size. Reading past the end zero-fills the rest and sets HasFailed() */
         void Read(char* buffer, size_t sizeInBytes);
 
-        /** Reads object without built-in Deserialize() from disk */
+        /** Reads object without built-in Deserialize(). Swaps bytes of arithmetic types if ReadHeader() detected the other endianness */
         template<typename T> 
         requires(!SerializationOverridden<T>)
         void Read(T& obj);
 
-        /** Reads object with built-in Deserialize() from disk */
+        /** Reads object with built-in Deserialize() */
         template <SerializationOverridden T>
         void Read(T& obj);
 
+        /** Reads count elements. Trivially copyable ones in a single copy */
+        template<typename T>
+        void ReadArray(T* pElements, size_t count);
+
         char* ReadText();
 
-        /** Seeks to a specific position in the file */
+        /** Seeks to a specific position */
         void Seek(size_t position, SerializerMode mode = SerializerMode::Current);
 
-        /** Returns the size of the file in bytes */
+        /** Returns the size of the file or memory in bytes */
         size_t GetSize();
+
+        /** @return     Offset of the next byte read or written */
+        size_t GetPosition();
+
+        /** @return     false, marking the serializer failed, if fewer than sizeInBytes are left to read */
+        bool CanRead(size_t sizeInBytes);
+
+        /** Tags the data with magic, which also tells the byte order it was written in, and a version */
+        void WriteHeader(uint32 magic, uint32 version);
+
+        /** @return     false if the data doesn't start with magic in either byte order */
+        bool ReadHeader(uint32 magic, uint32& outVersion);
+
+        /** Reserves a size prefix for what's written until EndSection()
+            @return     Pass to EndSection() */
+        size_t BeginSection();
+        void EndSection(size_t sectionStart);
+
+        /** Reads a size prefix written by BeginSection()
+            @return     Pass to EndReadSection(), which skips whatever this reader didn't consume */
+        size_t BeginReadSection();
+        void EndReadSection(size_t sectionEnd);
+
+        bool HasFailed() const { return m_hasFailed; }
+        SerializerBackend GetBackend() const { return m_backend; }
+
+        /** Memory backend content */
+        const char* GetMemory() const { return m_pMemory; }
+        size_t GetMemorySize() const { return m_memorySize; }
+
+    private:
+        /** File backend: marks the serializer failed if the last stream write or flush didn't go through */
+        void CheckWrite();
+
+        /** File backend: writes the pending block to the stream */
+        void FlushBlock();
+
+        /** File backend: moves the stream back to the first unconsumed byte and forgets the buffered reads */
+        void DropReadBuffer();
+
+        void ReserveMemory(size_t capacity);
+
+        /** Overwrites bytes already written at position */
+        void Patch(size_t position, const char* pData, size_t size);
+
+        template<typename T>
+        static void ByteSwap(T& value);
     };
 
     Serializer::Serializer(const wchar_t* path, SerializerMode mode)
@@ -108,22 +231,124 @@ export namespace jpt
 
     void Serializer::Open(const wchar_t* path, SerializerMode mode)
     {
+        Close();
+
         m_stream.open(path, static_cast<std::ios_base::openmode>(mode));
+        if (m_stream.is_open())
+        {
+            m_backend = SerializerBackend::File;
+            m_pBlock = Allocator<char>::NewArray(kBlockSize);
+        }
+    }
+
+    void Serializer::OpenMemory(size_t initialCapacity /*= 0*/)
+    {
+        Close();
+
+        m_backend = SerializerBackend::Memory;
+        m_isMemoryOwned = true;
+        ReserveMemory(initialCapacity);
+    }
+
+    void Serializer::OpenMemory(const char* pData, size_t size)
+    {
+        Close();
+
+        m_backend = SerializerBackend::Memory;
+        m_pMemory = const_cast<char*>(pData);
+        m_memorySize = size;
+        m_memoryCapacity = size;
     }
 
     bool Serializer::IsOpen() const
     {
-        return m_stream.is_open();
+        switch (m_backend)
+        {
+            case SerializerBackend::File:   return m_stream.is_open();
+            case SerializerBackend::Memory: return true;
+            default:                        return false;
+        }
     }
 
     void Serializer::Close()
     {
-        m_stream.close();
+        if (m_backend == SerializerBackend::File)
+        {
+            FlushBlock();
+            m_stream.close();
+            Allocator<char>::DeleteArray(m_pBlock);
+        }
+        else if (m_backend == SerializerBackend::Memory && m_isMemoryOwned)
+        {
+            Allocator<char>::DeleteArray(m_pMemory);
+        }
+
+        m_pBlock = nullptr;
+        m_pendingWriteSize = 0;
+        m_readBegin = 0;
+        m_readEnd = 0;
+
+        m_pMemory = nullptr;
+        m_memorySize = 0;
+        m_memoryCapacity = 0;
+        m_memoryCursor = 0;
+        m_isMemoryOwned = false;
+
+        m_backend = SerializerBackend::None;
+        m_isByteSwapped = false;
+        m_hasFailed = false;
     }
 
     void Serializer::Write(const char* buffer, size_t sizeInBytes)
     {
-        m_stream.write(buffer, sizeInBytes);
+        if (sizeInBytes == 0)
+        {
+            return;
+        }
+
+        if (m_backend == SerializerBackend::Memory)
+        {
+            JPT_ASSERT(m_isMemoryOwned, "Writing to a read-only memory serializer");
+
+            const size_t end = m_memoryCursor + sizeInBytes;
+            if (end > m_memoryCapacity)
+            {
+                ReserveMemory(end > m_memoryCapacity * 2 ? end : m_memoryCapacity * 2);
+            }
+
+            std::memcpy(m_pMemory + m_memoryCursor, buffer, sizeInBytes);
+            m_memoryCursor = end;
+            m_memorySize = end > m_memorySize ? end : m_memorySize;
+            return;
+        }
+
+        DropReadBuffer();
+
+        if (m_pendingWriteSize + sizeInBytes > kBlockSize)
+        {
+            FlushBlock();
+
+            // Big enough to skip the copy
+            if (sizeInBytes >= kBlockSize)
+            {
+                m_stream.write(buffer, sizeInBytes);
+                CheckWrite();
+                return;
+            }
+        }
+
+        std::memcpy(m_pBlock + m_pendingWriteSize, buffer, sizeInBytes);
+        m_pendingWriteSize += sizeInBytes;
+    }
+
+    void Serializer::Flush()
+    {
+        if (m_backend == SerializerBackend::File)
+        {
+            FlushBlock();
+            m_stream.flush();
+            CheckWrite();
+        }
     }
 
     template<typename T> 
@@ -139,9 +364,84 @@ export namespace jpt
         obj.Serialize(*this);
     }
 
+    template<typename T>
+    void Serializer::WriteArray(const T* pElements, size_t count)
+    {
+        if constexpr (!IsSerializeOverridden<T> && std::is_trivially_copyable_v<T>)
+        {
+            Write(reinterpret_cast<const char*>(pElements), count * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Write(pElements[i]);
+            }
+        }
+    }
+
     void Serializer::Read(char* buffer, size_t sizeInBytes)
     {
-        m_stream.read(buffer, sizeInBytes);
+        if (m_backend == SerializerBackend::Memory)
+        {
+            const size_t available = m_memorySize - m_memoryCursor;
+            const size_t size = sizeInBytes < available ? sizeInBytes : available;
+
+            std::memcpy(buffer, m_pMemory + m_memoryCursor, size);
+            m_memoryCursor += size;
+
+            if (size < sizeInBytes)
+            {
+                std::memset(buffer + size, 0, sizeInBytes - size);
+                m_hasFailed = true;
+            }
+            return;
+        }
+
+        FlushBlock();
+
+        while (sizeInBytes > 0)
+        {
+            // Buffered bytes first
+            if (m_readBegin < m_readEnd)
+            {
+                const size_t buffered = m_readEnd - m_readBegin;
+                const size_t size = sizeInBytes < buffered ? sizeInBytes : buffered;
+
+                std::memcpy(buffer, m_pBlock + m_readBegin, size);
+                m_readBegin += size;
+                buffer += size;
+                sizeInBytes -= size;
+                continue;
+            }
+
+            // Big enough to skip the copy
+            if (sizeInBytes >= kBlockSize)
+            {
+                m_stream.read(buffer, sizeInBytes);
+                const size_t readSize = static_cast<size_t>(m_stream.gcount());
+                buffer += readSize;
+                sizeInBytes -= readSize;
+            }
+            else
+            {
+                m_stream.read(m_pBlock, kBlockSize);
+                m_readBegin = 0;
+                m_readEnd = static_cast<size_t>(m_stream.gcount());
+            }
+
+            // End of file
+            if (m_stream.eof() || m_stream.fail())
+            {
+                m_stream.clear();
+                if (m_readBegin == m_readEnd && sizeInBytes > 0)
+                {
+                    std::memset(buffer, 0, sizeInBytes);
+                    m_hasFailed = true;
+                    return;
+                }
+            }
+        }
     }
 
     template<typename T> 
@@ -149,6 +449,14 @@ export namespace jpt
     void Serializer::Read(T& obj)
     {
         Read(reinterpret_cast<char*>(&obj), sizeof(T));
+
+        if constexpr ((std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) > 1)
+        {
+            if (m_isByteSwapped)
+            {
+                ByteSwap(obj);
+            }
+        }
     }
 
     template<SerializationOverridden T>
@@ -157,8 +465,49 @@ export namespace jpt
         obj.Deserialize(*this);
     }
 
+    template<typename T>
+    void Serializer::ReadArray(T* pElements, size_t count)
+    {
+        if constexpr (!IsSerializeOverridden<T> && std::is_trivially_copyable_v<T>)
+        {
+            Read(reinterpret_cast<char*>(pElements), count * sizeof(T));
+
+            if constexpr ((std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) > 1)
+            {
+                if (m_isByteSwapped)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        ByteSwap(pElements[i]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Read(pElements[i]);
+            }
+        }
+    }
+
     char* Serializer::ReadText()
     {
+        if (m_backend == SerializerBackend::Memory)
+        {
+            const size_t size = m_memorySize - m_memoryCursor;
+            char* buffer = JPT_NEW_ARRAY(char, size + 1);
+            std::memcpy(buffer, m_pMemory + m_memoryCursor, size);
+            buffer[size] = '\0';
+
+            m_memoryCursor = m_memorySize;
+            return buffer;
+        }
+
+        FlushBlock();
+        DropReadBuffer();
+
         std::string content;
         std::string line;
         while (std::getline(m_stream, line))
@@ -178,11 +527,34 @@ export namespace jpt
 
     void Serializer::Seek(size_t position, SerializerMode mode /*= SerializerMode::Current*/)
     {
+        if (m_backend == SerializerBackend::Memory)
+        {
+            switch (mode)
+            {
+                case SerializerMode::Begin: m_memoryCursor = position;                  break;
+                case SerializerMode::End:   m_memoryCursor = m_memorySize + position;   break;
+                default:                    m_memoryCursor += position;                 break;
+            }
+
+            JPT_ASSERT(m_memoryCursor <= m_memorySize, "Seeking past the end of memory");
+            return;
+        }
+
+        FlushBlock();
+        DropReadBuffer();
         m_stream.seekg(position, static_cast<std::ios_base::seekdir>(mode));
     }
 
     size_t Serializer::GetSize()
     {
+        if (m_backend == SerializerBackend::Memory)
+        {
+            return m_memorySize;
+        }
+
+        FlushBlock();
+        DropReadBuffer();
+
         size_t current = m_stream.tellg();
 
         m_stream.seekg(0, std::ios_base::end);
@@ -191,4 +563,175 @@ export namespace jpt
         m_stream.seekg(current);
         return size;
     }
+
+    size_t Serializer::GetPosition()
+    {
+        if (m_backend == SerializerBackend::Memory)
+        {
+            return m_memoryCursor;
+        }
+
+        if (m_pendingWriteSize > 0)
+        {
+            return static_cast<size_t>(m_stream.tellp()) + m_pendingWriteSize;
+        }
+
+        return static_cast<size_t>(m_stream.tellg()) - (m_readEnd - m_readBegin);
+    }
+
+    bool Serializer::CanRead(size_t sizeInBytes)
+    {
+        const size_t size = GetSize();
+        const size_t position = GetPosition();
+        if (position > size || sizeInBytes > size - position)
+        {
+            m_hasFailed = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    void Serializer::WriteHeader(uint32 magic, uint32 version)
+    {
+        Write(magic);
+        Write(version);
+    }
+
+    bool Serializer::ReadHeader(uint32 magic, uint32& outVersion)
+    {
+        m_isByteSwapped = false;
+
+        uint32 readMagic = 0;
+        Read(readMagic);
+
+        if (readMagic != magic)
+        {
+            ByteSwap(readMagic);
+            if (readMagic != magic)
+            {
+                m_hasFailed = true;
+                return false;
+            }
+            m_isByteSwapped = true;
+        }
+
+        Read(outVersion);
+        return !m_hasFailed;
+    }
+
+    size_t Serializer::BeginSection()
+    {
+        const size_t sectionStart = GetPosition();
+
+        const uint64 placeholder = 0;
+        Write(placeholder);
+
+        return sectionStart;
+    }
+
+    void Serializer::EndSection(size_t sectionStart)
+    {
+        const uint64 size = GetPosition() - sectionStart - sizeof(uint64);
+        Patch(sectionStart, reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+
+    size_t Serializer::BeginReadSection()
+    {
+        uint64 size = 0;
+        Read(size);
+        return GetPosition() + static_cast<size_t>(size);
+    }
+
+    void Serializer::EndReadSection(size_t sectionEnd)
+    {
+        JPT_ASSERT(GetPosition() <= sectionEnd, "Read past the end of a section");
+        Seek(sectionEnd, SerializerMode::Begin);
+    }
+
+    void Serializer::FlushBlock()
+    {
+        if (m_pendingWriteSize > 0)
+        {
+            m_stream.write(m_pBlock, m_pendingWriteSize);
+            m_pendingWriteSize = 0;
+            CheckWrite();
+        }
+    }
+
+    void Serializer::CheckWrite()
+    {
+        if (m_stream.fail())
+        {
+            m_hasFailed = true;
+        }
+    }
+
+    void Serializer::DropReadBuffer()
+    {
+        if (m_readBegin < m_readEnd)
+        {
+            m_stream.seekg(-static_cast<std::streamoff>(m_readEnd - m_readBegin), std::ios_base::cur);
+        }
+
+        m_readBegin = 0;
+        m_readEnd = 0;
+    }
+
+    void Serializer::ReserveMemory(size_t capacity)
+    {
+        if (capacity <= m_memoryCapacity)
+        {
+            return;
+        }
+
+        char* pMemory = Allocator<char>::NewArray(capacity);
+        if (m_pMemory)
+        {
+            std::memcpy(pMemory, m_pMemory, m_memorySize);
+            Allocator<char>::DeleteArray(m_pMemory);
+        }
+
+        m_pMemory = pMemory;
+        m_memoryCapacity = capacity;
+    }
+
+    void Serializer::Patch(size_t position, const char* pData, size_t size)
+    {
+        if (m_backend == SerializerBackend::Memory)
+        {
+            JPT_ASSERT(position + size <= m_memorySize);
+            std::memcpy(m_pMemory + position, pData, size);
+            return;
+        }
+
+        // Still in the pending block
+        const size_t blockStart = static_cast<size_t>(m_stream.tellp());
+        if (position >= blockStart && position + size <= blockStart + m_pendingWriteSize)
+        {
+            std::memcpy(m_pBlock + (position - blockStart), pData, size);
+            return;
+        }
+
+        FlushBlock();
+        const std::streampos current = m_stream.tellp();
+        m_stream.seekp(position);
+        m_stream.write(pData, size);
+        CheckWrite();
+        m_stream.seekp(current);
+    }
+
+    template<typename T>
+    void Serializer::ByteSwap(T& value)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (size_t i = 0; i < sizeof(T) / 2; ++i)
+        {
+            const char temp = bytes[i];
+            bytes[i] = bytes[sizeof(T) - 1 - i];
+            bytes[sizeof(T) - 1 - i] = temp;
+        }
+        std::memcpy(&value, bytes, sizeof(T));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,294 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <charconv>
+#include <system_error>
+#include <type_traits>
+
+export module jpt.NumberConversion;
+
+import jpt.Concepts;
+import jpt.Constants;
+import jpt.TypeDefs;
+
+namespace jpt_private
+{
+    constexpr const char* kDigits = "0123456789ABCDEF";
+
+    constexpr char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    template<typename TUnsigned>
+    constexpr Index CountDecimalDigits(TUnsigned value)
+    {
+        Index count = 1;
+        while (value >= 10000)
+        {
+            value /= 10000;
+            count += 4;
+        }
+        if (value >= 1000) { return count + 3; }
+        if (value >= 100)  { return count + 2; }
+        if (value >= 10)   { return count + 1; }
+        return count;
+    }
+
+    /** @return     Value of an ASCII digit in bases up to 16, or 0xFF */
+    template<typename TChar>
+    constexpr uint32 GetDigitValue(TChar c)
+    {
+        if (c >= '0' && c <= '9') { return static_cast<uint32>(c - '0'); }
+        if (c >= 'a' && c <= 'f') { return static_cast<uint32>(c - 'a' + 10); }
+        if (c >= 'A' && c <= 'F') { return static_cast<uint32>(c - 'A' + 10); }
+        return 0xFF;
+    }
+}
+
+export namespace jpt
+{
+    /** Buffer sizes that fit any value. Nothing is null terminated */
+    constexpr Index kMaxIntegerChars = 66;      /**< 64 binary digits and a sign */
+    constexpr Index kMaxFloatChars   = 32;      /**< Longest shortest round-trip float64, "-2.2250738585072014e-308" */
+
+    /** Longest wide text ParseFloat() considers. Longer digit runs are cut */
+    constexpr Index kMaxWideFloatParseChars = 128;
+
+    enum class ParseError : uint8
+    {
+        None,
+        Invalid,        /**< The buffer doesn't start with a number */
+        OutOfRange,     /**< The number doesn't fit in the type */
+    };
+
+    /** Outcome of ParseInteger() and ParseFloat() */
+    struct ParseResult
+    {
+        Index count = 0;                        /**< Chars consumed. Set for OutOfRange too */
+        ParseError error = ParseError::None;
+
+        constexpr bool IsValid() const { return error == ParseError::None; }
+    };
+
+    /** Writes value's digits to pBuffer, a '-' first if negative and a "0x" prefix for hex. No allocation, no terminator
+        @param pBuffer      Holds at least kMaxIntegerChars
+        @return             Chars written
+        @example
+            char buffer[jpt::kMaxIntegerChars];
+            const Index count = jpt::WriteInteger(buffer, -42);     // "-42", count 3 */
+    template<StringLiteral TChar, Integral TInt>
+    constexpr Index WriteInteger(TChar* pBuffer, TInt value, EIntBase base = EIntBase::Decimal)
+    {
+        using TUnsigned = std::make_unsigned_t<TInt>;
+
+        Index count = 0;
+        TUnsigned magnitude = static_cast<TUnsigned>(value);
+
+        if constexpr (std::is_signed_v<TInt>)
+        {
+            if (value < 0)
+            {
+                pBuffer[count++] = static_cast<TChar>('-');
+                magnitude = static_cast<TUnsigned>(TUnsigned(0) - magnitude);     // Also right for the minimum value
+            }
+        }
+
+        if (base == EIntBase::Decimal)
+        {
+            count += jpt_private::CountDecimalDigits(magnitude);
+            TChar* pDigit = pBuffer + count;
+
+            // Two digits per division
+            while (magnitude >= 100)
+            {
+                const uint32 pair = static_cast<uint32>(magnitude % 100) * 2;
+                magnitude = static_cast<TUnsigned>(magnitude / 100);
+                *--pDigit = static_cast<TChar>(jpt_private::kDigitPairs[pair + 1]);
+                *--pDigit = static_cast<TChar>(jpt_private::kDigitPairs[pair]);
+            }
+
+            if (magnitude >= 10)
+            {
+                const uint32 pair = static_cast<uint32>(magnitude) * 2;
+                *--pDigit = static_cast<TChar>(jpt_private::kDigitPairs[pair + 1]);
+                *--pDigit = static_cast<TChar>(jpt_private::kDigitPairs[pair]);
+            }
+            else
+            {
+                *--pDigit = static_cast<TChar>('0' + magnitude);
+            }
+
+            return count;
+        }
+
+        if (base == EIntBase::Hex)
+        {
+            pBuffer[count++] = static_cast<TChar>('0');
+            pBuffer[count++] = static_cast<TChar>('x');
+        }
+
+        // Power of two bases, shifts only
+        const uint32 shift = base == EIntBase::Hex ? 4 : (base == EIntBase::Octal ? 3 : 1);
+        const uint32 mask = (1u << shift) - 1;
+
+        Index digitsCount = 1;
+        for (TUnsigned rest = static_cast<TUnsigned>(magnitude >> shift); rest != 0; rest = static_cast<TUnsigned>(rest >> shift))
+        {
+            ++digitsCount;
+        }
+
+        count += digitsCount;
+        TChar* pDigit = pBuffer + count;
+        for (Index i = 0; i < digitsCount; ++i)
+        {
+            *--pDigit = static_cast<TChar>(jpt_private::kDigits[magnitude & mask]);
+            magnitude = static_cast<TUnsigned>(magnitude >> shift);
+        }
+
+        return count;
+    }
+
+    /** Writes the shortest text that reads back to exactly value, like std::to_chars. No allocation, no terminator
+        @param pBuffer      Holds at least kMaxFloatChars
+        @return             Chars written
+        @example
+            char buffer[jpt::kMaxFloatChars];
+            const Index count = jpt::WriteFloat(buffer, 0.1f);      // "0.1", count 3 */
+    template<StringLiteral TChar, Floating TFloat>
+    Index WriteFloat(TChar* pBuffer, TFloat value)
+    {
+        if constexpr (AreSameType<TChar, char>)
+        {
+            return static_cast<Index>(std::to_chars(pBuffer, pBuffer + kMaxFloatChars, value).ptr - pBuffer);
+        }
+        else
+        {
+            char buffer[kMaxFloatChars];
+            const Index count = static_cast<Index>(std::to_chars(buffer, buffer + kMaxFloatChars, value).ptr - buffer);
+            for (Index i = 0; i < count; ++i)
+            {
+                pBuffer[i] = static_cast<TChar>(buffer[i]);
+            }
+            return count;
+        }
+    }
+
+    /** Parses an integer at the start of pBuffer. Stops at the first char that isn't a digit of base
+        Accepts a leading '-' for signed types, and an optional "0x" prefix in hex. No whitespace, no '+'
+        @param outValue     Left untouched unless the result is valid
+        @example
+            int32 value = 0;
+            const jpt::ParseResult result = jpt::ParseInteger("123abc", 6, value);     // value 123, result.count 3 */
+    template<StringLiteral TChar, Integral TInt>
+    constexpr ParseResult ParseInteger(const TChar* pBuffer, Index count, TInt& outValue, EIntBase base = EIntBase::Decimal)
+    {
+        using TUnsigned = std::make_unsigned_t<TInt>;
+
+        Index i = 0;
+        bool isNegative = false;
+
+        if constexpr (std::is_signed_v<TInt>)
+        {
+            if (count > 0 && pBuffer[0] == '-')
+            {
+                isNegative = true;
+                ++i;
+            }
+        }
+
+        const uint32 numBase = static_cast<uint32>(base);
+        if (base == EIntBase::Hex && count - i > 2 && pBuffer[i] == '0' && (pBuffer[i + 1] == 'x' || pBuffer[i + 1] == 'X') &&
+            jpt_private::GetDigitValue(pBuffer[i + 2]) < numBase)
+        {
+            i += 2;
+        }
+
+        // Largest magnitude allowed. One more for negative values
+        const TUnsigned limit = static_cast<TUnsigned>(isNegative ? static_cast<TUnsigned>(kMax<TInt>) + 1u : static_cast<TUnsigned>(kMax<TInt>));
+
+        TUnsigned magnitude = 0;
+        bool isOutOfRange = false;
+        const Index digitsBegin = i;
+
+        for (; i < count; ++i)
+        {
+            const uint32 digit = jpt_private::GetDigitValue(pBuffer[i]);
+            if (digit >= numBase)
+            {
+                break;
+            }
+
+            // Keep consuming digits after an overflow, so count covers the whole number
+            if (magnitude > (limit - digit) / numBase)
+            {
+                isOutOfRange = true;
+                continue;
+            }
+            magnitude = static_cast<TUnsigned>(magnitude * numBase + digit);
+        }
+
+        if (i == digitsBegin)
+        {
+            return { 0, ParseError::Invalid };
+        }
+        if (isOutOfRange)
+        {
+            return { i, ParseError::OutOfRange };
+        }
+
+        outValue = isNegative ? static_cast<TInt>(TUnsigned(0) - magnitude) : static_cast<TInt>(magnitude);
+        return { i, ParseError::None };
+    }
+
+    /** Parses a decimal float at the start of pBuffer, correctly rounded like std::from_chars.
+        Accepts a leading '-', exponents, "inf" and "nan". No whitespace, no '+'. A suffix like 'f' is left unconsumed
+        @param outValue     Left untouched unless the result is valid */
+    template<StringLiteral TChar, Floating TFloat>
+    ParseResult ParseFloat(const TChar* pBuffer, Index count, TFloat& outValue)
+    {
+        const char* pBegin = nullptr;
+        Index narrowCount = 0;
+
+        char buffer[kMaxWideFloatParseChars];
+        if constexpr (AreSameType<TChar, char>)
+        {
+            pBegin = pBuffer;
+            narrowCount = count;
+        }
+        else
+        {
+            // Only ASCII can be part of a number
+            while (narrowCount < count && narrowCount < kMaxWideFloatParseChars && pBuffer[narrowCount] > 0 && pBuffer[narrowCount] < 0x80)
+            {
+                buffer[narrowCount] = static_cast<char>(pBuffer[narrowCount]);
+                ++narrowCount;
+            }
+            pBegin = buffer;
+        }
+
+        TFloat value = 0;
+        const std::from_chars_result result = std::from_chars(pBegin, pBegin + narrowCount, value);
+        const Index parsedCount = static_cast<Index>(result.ptr - pBegin);
+
+        if (result.ec == std::errc::invalid_argument)
+        {
+            return { 0, ParseError::Invalid };
+        }
+        if (result.ec == std::errc::result_out_of_range)
+        {
+            return { parsedCount, ParseError::OutOfRange };
+        }
+
+        outValue = value;
+        return { parsedCount, ParseError::None };
+    }
+}
\ No newline at end of file
@@ -21,6 +21,7 @@ import jpt.DynamicArray;
 import jpt.Hash;
 import jpt.Math;
 import jpt.StringHelpers;
+import jpt.StringSearch;
 import jpt.TypeDefs;
 import jpt.Utilities;
 import jpt.Serializer;
@@ -48,12 +49,12 @@ export namespace jpt
         constexpr String_Base(const TChar* CString, Index size);
         constexpr String_Base(const TChar* CString);
         constexpr String_Base(TChar c);
-        constexpr String_Base(const String_Base<TChar>& otherString);
-        constexpr String_Base(String_Base<TChar>&& otherString) noexcept;
+        constexpr String_Base(const String_Base& otherString);
+        constexpr String_Base(String_Base&& otherString) noexcept;
 
         String_Base& operator=(const TChar* CString);
-        String_Base& operator=(const String_Base<TChar>& otherString);
-        String_Base& operator=(String_Base<TChar>&& otherString) noexcept;
+        String_Base& operator=(const String_Base& otherString);
+        String_Base& operator=(String_Base&& otherString) noexcept;
         constexpr ~String_Base();
 
         // Element Access
@@ -126,11 +127,11 @@ export namespace jpt
         /** Appends a string to the end of buffer */
         constexpr void Append(const TChar* CString, Index newStringSize);
         constexpr void Append(const TChar* CString);
-        constexpr void Append(const String_Base<TChar>& otherString);
-        constexpr void Append(const DynamicArray<String_Base<TChar>>& strings, const TChar* separator = nullptr);
+        constexpr void Append(const String_Base& otherString);
+        constexpr void Append(const DynamicArray<String_Base>& strings, const TChar* separator = nullptr);
         constexpr void Append(TChar c);
         constexpr String_Base& operator+=(const TChar* CString);
-        constexpr String_Base& operator+=(const String_Base<TChar>& otherString);
+        constexpr String_Base& operator+=(const String_Base& otherString);
         constexpr String_Base& operator+=(TChar c);
 
         /** Pre allocate buffer with capacity's size. Preventing oftenly dynamic heap allocation */
@@ -145,12 +146,12 @@ export namespace jpt
         /* Copy the content of string. Will assign the current m_pBuffer with the copied data in memory */
         constexpr void CopyString(const TChar* inCString, Index size);
         constexpr void CopyString(const TChar* inCString);
-        constexpr void CopyString(const String_Base<TChar>& otherString);
+        constexpr void CopyString(const String_Base& otherString);
 
         /* Move the content of string. Will take ownership of the passed in string */
         constexpr void MoveString(TChar* inCString, Index size);
         constexpr void MoveString(TChar* inCString);
-        constexpr void MoveString(String_Base<TChar>&& otherString);
+        constexpr void MoveString(String_Base&& otherString);
 
         void Serialize(Serializer& serializer) const;
         void Deserialize(Serializer& serializer);
@@ -168,7 +169,7 @@ export namespace jpt
     template<StringLiteral TChar, class TAllocator>
     [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(const String_Base<TChar, TAllocator>& string, const TChar* CString) noexcept
     {
-        String_Base<TChar> str = string;
+        String_Base<TChar, TAllocator> str = string;
         str.Append(CString);
         return str;
     }
@@ -176,23 +177,23 @@ export namespace jpt
     template<StringLiteral TChar, class TAllocator>
     [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(String_Base<TChar, TAllocator>&& string, const TChar* CString) noexcept
     {
-        String_Base<TChar> str = Move(string);
+        String_Base<TChar, TAllocator> str = Move(string);
         str.Append(CString);
         return str;
     }
 
     template<StringLiteral TChar, class TAllocator>
-    [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(const String_Base<TChar, TAllocator>& string, const String_Base<TChar>& otherString) noexcept
+    [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(const String_Base<TChar, TAllocator>& string, const String_Base<TChar, TAllocator>& otherString) noexcept
     {
-        String_Base<TChar> str = string;
+        String_Base<TChar, TAllocator> str = string;
         str.Append(otherString);
         return str;
     }
 
     template<StringLiteral TChar, class TAllocator>
-    [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(String_Base<TChar, TAllocator>&& string, const String_Base<TChar>& otherString) noexcept
+    [[nodiscard]] constexpr String_Base<TChar, TAllocator> operator+(String_Base<TChar, TAllocator>&& string, const String_Base<TChar, TAllocator>& otherString) noexcept
     {
-        String_Base<TChar> str = Move(string);
+        String_Base<TChar, TAllocator> str = Move(string);
         str.Append(otherString);
         return str;
     }
@@ -245,7 +246,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    [[nodiscard]] constexpr bool operator==(const String_Base<TChar, TAllocator>& lhs, const String_Base<TChar>& rhs)
+    [[nodiscard]] constexpr bool operator==(const String_Base<TChar, TAllocator>& lhs, const String_Base<TChar, TAllocator>& rhs)
     {
         return AreStringsSame(lhs.ConstBuffer(), rhs.ConstBuffer(), lhs.Count(), rhs.Count());
     }
@@ -253,7 +254,7 @@ export namespace jpt
     template<StringLiteral TChar, class TAllocator>
     [[nodiscard]] constexpr uint64 Hash(const String_Base<TChar, TAllocator>& str)
     {
-        return StringHash64(str.ConstBuffer());
+        return HashString(str.ConstBuffer(), str.Count());
     }
 
     // ------------------------------------------------------------------------------------------------
@@ -281,13 +282,13 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr String_Base<TChar, TAllocator>::String_Base(const String_Base<TChar>& otherString)
+    constexpr String_Base<TChar, TAllocator>::String_Base(const String_Base& otherString)
     {
         CopyString(otherString);
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr String_Base<TChar, TAllocator>::String_Base(String_Base<TChar>&& otherString) noexcept
+    constexpr String_Base<TChar, TAllocator>::String_Base(String_Base&& otherString) noexcept
     {
         MoveString(Move(otherString));
     }
@@ -300,7 +301,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator=(const String_Base<TChar>& otherString)
+    String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator=(const String_Base& otherString)
     {
         if (this != &otherString)
         {
@@ -311,7 +312,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator=(String_Base<TChar>&& otherString) noexcept
+    String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator=(String_Base&& otherString) noexcept
     {
         if (this != &otherString)
         {
@@ -423,18 +424,12 @@ export namespace jpt
     constexpr Index String_Base<TChar, TAllocator>::Count(TChar c, Index startIndex /* = 0*/, Index endIndex /* = kInvalidIndex*/) const noexcept
     {
         endIndex = Clamp(endIndex, Index(0), m_count);
-        Index count = 0;
-
-        for (Index i = startIndex; i < endIndex; ++i)
+        if (startIndex >= endIndex)
         {
-            const TChar ch = m_pBuffer[i];
-            if (ch == c)
-            {
-                ++count;
-            }
+            return 0;
         }
 
-        return count;
+        return CountChar(m_pBuffer + startIndex, endIndex - startIndex, c);
     }
 
     template<StringLiteral TChar, class TAllocator>
@@ -443,23 +438,22 @@ export namespace jpt
         endIndex = Clamp(endIndex, Index(0), m_count);
         Index count = 0;
         const Index stringToFindSize = FindCharsCount(pString);
+        if (stringToFindSize == 0)
+        {
+            return 0;
+        }
 
+        // Non-overlapping
         for (Index i = startIndex; i < endIndex;)
         {
-            if ((i + stringToFindSize) > endIndex)
+            const Index found = FindString(m_pBuffer + i, endIndex - i, pString, stringToFindSize);
+            if (found == kInvalidIndex)
             {
                 break;
             }
 
-            if (AreStringsSame(m_pBuffer + i, pString, stringToFindSize))
-            {
-                ++count;
-                i += stringToFindSize;
-            }
-            else
-            {
-                ++i;
-            }
+            ++count;
+            i += found + stringToFindSize;
         }
 
         return count;
@@ -487,16 +481,13 @@ export namespace jpt
     constexpr Index String_Base<TChar, TAllocator>::Find(TChar charToFind, Index startIndex /* = 0*/, Index endIndex /* = kInvalidIndex*/) const noexcept
     {
         endIndex = Clamp(endIndex, Index(0), m_count);
-
-        for (Index i = startIndex; i < endIndex; ++i)
+        if (startIndex >= endIndex)
         {
-            if (m_pBuffer[i] == charToFind)
-            {
-                return i;
-            }
+            return kInvalidIndex;
         }
 
-        return kInvalidIndex;
+        const Index found = FindChar(m_pBuffer + startIndex, endIndex - startIndex, charToFind);
+        return found == kInvalidIndex ? kInvalidIndex : startIndex + found;
     }
 
     template<StringLiteral TChar, class TAllocator>
@@ -504,21 +495,13 @@ export namespace jpt
     {
         const Index stringToFindSize = FindCharsCount(pStringToFind);
         endIndex = Clamp(endIndex, static_cast<Index>(0), m_count);
-
-        for (Index i = startIndex; i < endIndex; ++i)
+        if (startIndex >= endIndex)
         {
-            if ((i + stringToFindSize) > endIndex)
-            {
-                return kInvalidIndex;
-            }
-
-            if (AreStringsSame(m_pBuffer + i, pStringToFind, stringToFindSize))
-            {
-                return i;
-            }
+            return kInvalidIndex;
         }
 
-        return kInvalidIndex;
+        const Index found = FindString(m_pBuffer + startIndex, endIndex - startIndex, pStringToFind, stringToFindSize);
+        return found == kInvalidIndex ? kInvalidIndex : startIndex + found;
     }
 
     template<StringLiteral TChar, class TAllocator>
@@ -702,10 +685,10 @@ export namespace jpt
         
         if (count == 0)
         {
-            return String_Base<TChar>();
+            return String_Base();
         }
 
-        String_Base<TChar> result;
+        String_Base result;
 
         if (count < kSmallDataSize)
         {
@@ -831,7 +814,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr void String_Base<TChar, TAllocator>::Append(const String_Base<TChar>& otherString)
+    constexpr void String_Base<TChar, TAllocator>::Append(const String_Base& otherString)
     {
         if (otherString.IsEmpty())
         {
@@ -842,7 +825,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr void String_Base<TChar, TAllocator>::Append(const DynamicArray<String_Base<TChar>>& strings, const TChar* separator)
+    constexpr void String_Base<TChar, TAllocator>::Append(const DynamicArray<String_Base>& strings, const TChar* separator)
     {
         Index newCount = m_count;
         const Index separatorCount = FindCharsCount(separator);
@@ -883,7 +866,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator+=(const String_Base<TChar>& otherString)
+    constexpr String_Base<TChar, TAllocator>& String_Base<TChar, TAllocator>::operator+=(const String_Base& otherString)
     {
         Append(otherString);
         return *this;
@@ -1012,7 +995,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr void String_Base<TChar, TAllocator>::CopyString(const String_Base<TChar>& otherString)
+    constexpr void String_Base<TChar, TAllocator>::CopyString(const String_Base& otherString)
     {
         CopyString(otherString.ConstBuffer(), otherString.Count());
     }
@@ -1049,7 +1032,7 @@ export namespace jpt
     }
 
     template<StringLiteral TChar, class TAllocator>
-    constexpr void String_Base<TChar, TAllocator>::MoveString(String_Base<TChar>&& otherString)
+    constexpr void String_Base<TChar, TAllocator>::MoveString(String_Base&& otherString)
     {
         DeallocateBuffer();
 
@@ -7,7 +7,6 @@ module;
 #include "Core/Memory/Memory.h"
 
 #include <string.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <type_traits>
 
@@ -19,6 +18,8 @@ import jpt.Concepts;
 import jpt.Utilities;
 import jpt.Allocator;
 import jpt.Math;
+import jpt.NumberConversion;
+import jpt.StringSearch;
 
 export namespace jpt
 {
@@ -31,6 +32,11 @@ export namespace jpt
             return 0;
         }
 
+        if (!std::is_constant_evaluated())
+        {
+            return StringKernels::FindNull(string);
+        }
+
         Index count = 0;
         while (string[count] != '\0')
         {
@@ -145,15 +151,7 @@ export namespace jpt
             return 0;
         }
 
-        for (Index i = 0; i < string1Count; ++i)
-        {
-            if (pString1[i] != pString2[i])
-            {
-                return i;
-            }
-        }
-
-        return kInvalidIndex;
+        return FindMismatch(pString1, pString2, string1Count);
     }
     template<StringLiteral TChar>
     constexpr Index StrCmp(const TChar* pString1, const TChar* pString2, Index count)
@@ -359,92 +357,21 @@ export namespace jpt
     /** Convert from IntegerType to a char pointer holding the integer's value as string literal
         @param value:        The IntegerType value to convert to char*
         @param base:         The base of the value. Default to decimal as 10. Could be binary, oct, hex.
-        @return A char pointer pointing to the memory where we store the converted number's string literal */
+        @return A char pointer pointing to the memory where we store the converted number's string literal
+        @note   Allocates. WriteInteger() writes to a caller's buffer instead */
     template<StringLiteral TChar = char, Integral TInt = int32>
     constexpr TChar* IntegerToCStr(TInt value, EIntBase base = EIntBase::Decimal)
     {
-        // Prepare data
-        const bool isNegative = value < 0;    // Whether this value is negative or not
-        const TInt numBase = static_cast<TInt>(base);
-        TChar* result = nullptr;    // Final result string to return
-        Index index = 0;            // The index I'm using for char array, will be used as length of this value and string as well
-
-        // Process 0
-        if (value == 0)
-        {
-            result = JPT_NEW_ARRAY(TChar, 2);
-            result[0] = '0';
-            result[1] = '\0';
-            return result;
-        }
-        // Process negative if IntegerType can be signed
-        if constexpr (std::is_signed_v<TInt>)
-        {
-            if (isNegative)
-            {
-                value = -value;
-                ++index;
-            }
-        }
-
-        // Get Value's literal length
-        TInt valueCopy = value;
-        while (valueCopy > 0)
-        {
-            valueCopy /= numBase;
-            ++index;
-        }
-        // Hex prefix "0x"
-        if (numBase == static_cast<TInt>(0x10u))
-        {
-            index += 2;
-        }
-
-        // Allocate Result string, + 1 for the end terminater
-        result = JPT_NEW_ARRAY(TChar, index + 1);
-
-        // Append string terminator at the end
-        result[index] = '\0';
-        --index;
-
-        // Process each digit
-        while (value > 0)
-        {
-            const TInt digit = value % numBase;
-
-            // For different base, process differently
-            if (digit > 9)
-            {
-                result[index] = static_cast<char>(digit - 10) + 'A';
-            }
-            else
-            {
-                result[index] = static_cast<char>(digit + '0');
-            }
-
-            // Update index and cut last digit of value
-            --index;
-            value /= numBase;
-        }
-
-        // Hex
-        if (base == EIntBase::Hex)
-        {
-            result[index--] = 'x';
-            result[index] = '0';
-        }
+        TChar buffer[kMaxIntegerChars];
+        const Index count = WriteInteger(buffer, value, base);
 
-        // If value was negative, add '-' at the beginning
-        if constexpr (std::is_signed_v<TInt>)
+        TChar* result = JPT_NEW_ARRAY(TChar, count + 1);
+        for (Index i = 0; i < count; ++i)
         {
-            if (isNegative)
-            {
-                result[index] = '-';
-                --index;
-            }
+            result[i] = buffer[i];
         }
+        result[count] = '\0';
 
-        // Return result
         return result;
     }
 
@@ -461,90 +388,19 @@ export namespace jpt
         }
 
         TInt result = 0;
-        bool isNegative = false;
-        Index start = 0;
-        const TInt numBase = static_cast<TInt>(base);
-
-        // Negative
-        if constexpr (std::is_signed_v<TInt>)
-        {
-            if (pBuffer[0] == '-')
-            {
-                isNegative = true;
-                start = 1;
-            }
-        }
-
-        // Hex prefix
-        if (base == EIntBase::Hex)
-        {
-            start = 2;
-        }
-
-        for (Index i = start; i < count; ++i)
-        {
-            TChar c = pBuffer[i];
-
-            if (c >= 'a' && c <= 'f')
-            {
-                c -= static_cast<TChar>(32);
-            }
-
-            JPT_ASSERT(IsHexDigit<TChar>(c), "Invalid character for converting to hex %c", c);
-
-            TInt number = static_cast<TInt>(0);
-            if (c > static_cast<TChar>('9'))
-            {
-                number = c + static_cast<TChar>(10) - static_cast<TChar>('A');
-            }
-            else
-            {
-                number = c - static_cast<TChar>('0');
-            }
-
-            if (base == EIntBase::Hex)
-            {
-                result <<= 4;
-                result |= number;
-            }
-            else if (base == EIntBase::Decimal)
-            {
-                result *= numBase;
-                result += number;
-            }
-            else
-            {
-                JPT_ASSERT(false, "Unsupported base for converting to integer");
-            }
-        }
-
-        if constexpr (std::is_signed_v<TInt>)
-        {
-            if (isNegative)
-            {
-                result *= -1;
-            }
-        }
+        const ParseResult parsed = ParseInteger(pBuffer, count, result, base);
+        JPT_ASSERT(parsed.IsValid(), "Invalid integer for converting to number");
 
         return result;
     }
 
+    /** @note    Shortest text that reads back to the same value. Allocates, WriteFloat() writes to a caller's buffer instead */
     template<StringLiteral TChar = char, Floating TFloat = float>
     constexpr TChar* FloatToCStr(TFloat value)
     {
-        static constexpr Index kMaxSize = 32;
-
-        TChar* buffer = JPT_NEW_ARRAY(TChar, kMaxSize);
-        const TChar* format = JPT_GET_PROPER_STRING(TChar, %.3f);    // controls how many precision digits to keep
-
-        if constexpr (AreSameType<TChar, char>)
-        {
-            snprintf(buffer, kMaxSize, format, value);
-        }
-        else if (AreSameType<TChar, wchar_t>)
-        {
-            swprintf(buffer, kMaxSize, format, value);
-        }
+        TChar* buffer = JPT_NEW_ARRAY(TChar, kMaxFloatChars + 1);
+        const Index count = WriteFloat(buffer, value);
+        buffer[count] = '\0';
 
         return buffer;
     }
@@ -553,68 +409,14 @@ export namespace jpt
     template<StringLiteral TChar = char, Floating TFloat = float32>
     constexpr TFloat CStrToFloat(const TChar* pBuffer, Index count = kInvalidIndex)
     {
-        // Parse two integral parts of the precision dot, then combine them
-
         if (count == kInvalidIndex)
         {
             count = FindCharsCount(pBuffer);
         }
 
-        TFloat integer = 0;        // Left of precision
-        TFloat floatingNum = 0;    // Right of precision
-        Index precisionIndex = kInvalidValue<Index>;
-        bool isNegative = false;
-
-        for (Index i = 0; i < count; ++i)
-        {
-            const TChar c = pBuffer[i];
-
-            // Negative
-            if (c == '-')
-            {
-                isNegative = true;
-                continue;
-            }
-
-            // Precision dot
-            if (c == '.')
-            {
-                precisionIndex = i;
-                continue;
-            }
-
-            // Num
-            JPT_ASSERT(IsDigit<TChar>(c), "Invalid character for converting to number");
-            const int32 number = c - static_cast<TChar>('0');
-
-            if (precisionIndex == kInvalidIndex)
-            {
-                integer *= static_cast<TFloat>(10);
-                integer += number;
-            }
-            else
-            {
-                floatingNum *= static_cast<TFloat>(10);
-                floatingNum += number;
-            }
-        }
-
-        // Make floating number part eligible
-        uint32 floatCopy = static_cast<int32>(floatingNum);
-        uint32 divider = 1;
-        while (floatCopy > 0)
-        {
-            floatCopy /= 10;
-            divider *= 10;
-        }
-        floatingNum /= divider;
-
-        // Combine two parts and process negative if it is
-        TFloat result = integer + floatingNum;
-        if (isNegative)
-        {
-            result *= static_cast<TFloat>(-1);
-        }
+        TFloat result = 0;
+        const ParseResult parsed = ParseFloat(pBuffer, count, result);
+        JPT_ASSERT(parsed.IsValid(), "Invalid float for converting to number");
 
         return result;
     }
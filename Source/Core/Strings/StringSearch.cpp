@@ -0,0 +1,321 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <bit>
+#include <cstring>
+#include <cwchar>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define JPT_STRING_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define JPT_STRING_SSE2 0
+#endif
+
+// MSVC compiles AVX2 intrinsics without /arch:AVX2, so the kernels are built and picked at runtime. Elsewhere only when the whole build targets AVX2
+#if defined(_MSC_VER) && defined(_M_X64)
+    #define JPT_STRING_AVX2 1
+    #define JPT_STRING_AVX2_RUNTIME_CHECK 1
+    #include <immintrin.h>
+    #include <intrin.h>
+#elif defined(__AVX2__)
+    #define JPT_STRING_AVX2 1
+    #define JPT_STRING_AVX2_RUNTIME_CHECK 0
+    #include <immintrin.h>
+#else
+    #define JPT_STRING_AVX2 0
+    #define JPT_STRING_AVX2_RUNTIME_CHECK 0
+#endif
+
+module jpt.StringSearch;
+
+namespace jpt::StringKernels
+{
+    /** Scalar, for the tails and for targets without SSE2 */
+    struct Scalar
+    {
+        template<typename TChar>
+        static Index FindChar(const TChar* pBuffer, Index count, TChar c)
+        {
+            for (Index i = 0; i < count; ++i)
+            {
+                if (pBuffer[i] == c)
+                {
+                    return i;
+                }
+            }
+            return kInvalidIndex;
+        }
+
+        template<typename TChar>
+        static Index CountChar(const TChar* pBuffer, Index count, TChar c)
+        {
+            Index found = 0;
+            for (Index i = 0; i < count; ++i)
+            {
+                found += pBuffer[i] == c;
+            }
+            return found;
+        }
+
+        template<typename TChar>
+        static Index FindMismatch(const TChar* pString1, const TChar* pString2, Index count)
+        {
+            for (Index i = 0; i < count; ++i)
+            {
+                if (pString1[i] != pString2[i])
+                {
+                    return i;
+                }
+            }
+            return kInvalidIndex;
+        }
+    };
+
+#if JPT_STRING_SSE2
+    struct Sse2
+    {
+        using Vector = __m128i;
+        static constexpr Index kBytes = 16;
+
+        static Vector Load(const void* p)           { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+        static Vector And(Vector a, Vector b)       { return _mm_and_si128(a, b); }
+        static uint32 MoveMask(Vector v)            { return static_cast<uint32>(_mm_movemask_epi8(v)); }
+        static constexpr uint32 kFullMask = 0xFFFF;
+
+        template<typename TChar>
+        static Vector Splat(TChar c)
+        {
+            if constexpr (sizeof(TChar) == 1)      { return _mm_set1_epi8(static_cast<char>(c)); }
+            else if constexpr (sizeof(TChar) == 2) { return _mm_set1_epi16(static_cast<short>(c)); }
+            else                                   { return _mm_set1_epi32(static_cast<int>(c)); }
+        }
+
+        template<typename TChar>
+        static Vector Equal(Vector a, Vector b)
+        {
+            if constexpr (sizeof(TChar) == 1)      { return _mm_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(TChar) == 2) { return _mm_cmpeq_epi16(a, b); }
+            else                                   { return _mm_cmpeq_epi32(a, b); }
+        }
+    };
+#endif
+
+#if JPT_STRING_AVX2
+    struct Avx2
+    {
+        using Vector = __m256i;
+        static constexpr Index kBytes = 32;
+
+        static Vector Load(const void* p)           { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+        static Vector And(Vector a, Vector b)       { return _mm256_and_si256(a, b); }
+        static uint32 MoveMask(Vector v)            { return static_cast<uint32>(_mm256_movemask_epi8(v)); }
+        static constexpr uint32 kFullMask = 0xFFFFFFFF;
+
+        template<typename TChar>
+        static Vector Splat(TChar c)
+        {
+            if constexpr (sizeof(TChar) == 1)      { return _mm256_set1_epi8(static_cast<char>(c)); }
+            else if constexpr (sizeof(TChar) == 2) { return _mm256_set1_epi16(static_cast<short>(c)); }
+            else                                   { return _mm256_set1_epi32(static_cast<int>(c)); }
+        }
+
+        template<typename TChar>
+        static Vector Equal(Vector a, Vector b)
+        {
+            if constexpr (sizeof(TChar) == 1)      { return _mm256_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(TChar) == 2) { return _mm256_cmpeq_epi16(a, b); }
+            else                                   { return _mm256_cmpeq_epi32(a, b); }
+        }
+    };
+#endif
+
+    /** Kernels over one vector width. Masks have a bit per byte, so a char spans sizeof(TChar) bits */
+    template<typename TSimd>
+    struct Kernels
+    {
+        template<typename TChar>
+        static Index FindChar(const TChar* pBuffer, Index count, TChar c)
+        {
+            constexpr Index kLanes = TSimd::kBytes / sizeof(TChar);
+            const auto needle = TSimd::template Splat<TChar>(c);
+
+            Index i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                const uint32 mask = TSimd::MoveMask(TSimd::template Equal<TChar>(TSimd::Load(pBuffer + i), needle));
+                if (mask != 0)
+                {
+                    return i + std::countr_zero(mask) / sizeof(TChar);
+                }
+            }
+
+            const Index found = Scalar::FindChar(pBuffer + i, count - i, c);
+            return found == kInvalidIndex ? kInvalidIndex : i + found;
+        }
+
+        template<typename TChar>
+        static Index CountChar(const TChar* pBuffer, Index count, TChar c)
+        {
+            constexpr Index kLanes = TSimd::kBytes / sizeof(TChar);
+            const auto needle = TSimd::template Splat<TChar>(c);
+
+            Index foundBits = 0;
+            Index i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                foundBits += std::popcount(TSimd::MoveMask(TSimd::template Equal<TChar>(TSimd::Load(pBuffer + i), needle)));
+            }
+
+            return foundBits / sizeof(TChar) + Scalar::CountChar(pBuffer + i, count - i, c);
+        }
+
+        template<typename TChar>
+        static Index FindMismatch(const TChar* pString1, const TChar* pString2, Index count)
+        {
+            constexpr Index kLanes = TSimd::kBytes / sizeof(TChar);
+
+            Index i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                const uint32 mask = TSimd::MoveMask(TSimd::template Equal<TChar>(TSimd::Load(pString1 + i), TSimd::Load(pString2 + i)));
+                if (mask != TSimd::kFullMask)
+                {
+                    return i + std::countr_zero(~mask) / sizeof(TChar);
+                }
+            }
+
+            const Index found = Scalar::FindMismatch(pString1 + i, pString2 + i, count - i);
+            return found == kInvalidIndex ? kInvalidIndex : i + found;
+        }
+
+        /** Compares the first and last char of pToFind against kLanes candidate positions at once. Only positions where both match are verified */
+        template<typename TChar>
+        static Index FindString(const TChar* pBuffer, Index count, const TChar* pToFind, Index toFindCount)
+        {
+            if (toFindCount == 0)
+            {
+                return 0;
+            }
+            if (toFindCount > count)
+            {
+                return kInvalidIndex;
+            }
+            if (toFindCount == 1)
+            {
+                return FindChar(pBuffer, count, pToFind[0]);
+            }
+
+            constexpr Index kLanes = TSimd::kBytes / sizeof(TChar);
+            const auto first = TSimd::template Splat<TChar>(pToFind[0]);
+            const auto last  = TSimd::template Splat<TChar>(pToFind[toFindCount - 1]);
+            const Index lastOffset = toFindCount - 1;
+
+            Index i = 0;
+            for (; i + kLanes + lastOffset <= count; i += kLanes)
+            {
+                const auto firstMatches = TSimd::template Equal<TChar>(TSimd::Load(pBuffer + i), first);
+                const auto lastMatches  = TSimd::template Equal<TChar>(TSimd::Load(pBuffer + i + lastOffset), last);
+                uint32 mask = TSimd::MoveMask(TSimd::And(firstMatches, lastMatches));
+
+                while (mask != 0)
+                {
+                    const Index candidate = i + std::countr_zero(mask) / sizeof(TChar);
+                    if (std::memcmp(pBuffer + candidate + 1, pToFind + 1, (toFindCount - 2) * sizeof(TChar)) == 0)
+                    {
+                        return candidate;
+                    }
+
+                    // Clear this char's bits
+                    constexpr uint32 kCharBits = (1u << sizeof(TChar)) - 1;
+                    mask &= ~(kCharBits << std::countr_zero(mask));
+                }
+            }
+
+            for (; i + toFindCount <= count; ++i)
+            {
+                if (pBuffer[i] == pToFind[0] && std::memcmp(pBuffer + i + 1, pToFind + 1, lastOffset * sizeof(TChar)) == 0)
+                {
+                    return i;
+                }
+            }
+            return kInvalidIndex;
+        }
+    };
+
+    static bool locDetectAvx2()
+    {
+#if JPT_STRING_AVX2_RUNTIME_CHECK
+        int32 info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS must save the YMM registers too
+        __cpuid(info, 1);
+        const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+        if (!hasOsxsave || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return JPT_STRING_AVX2;
+#endif
+    }
+
+    bool IsAvx2Enabled()
+    {
+        static const bool s_isAvx2Enabled = locDetectAvx2();
+        return s_isAvx2Enabled;
+    }
+
+    /** Picks the widest kernel the CPU supports */
+#if JPT_STRING_AVX2 && JPT_STRING_SSE2
+    #define JPT_STRING_DISPATCH(function, ...) (IsAvx2Enabled() ? Kernels<Avx2>::function(__VA_ARGS__) : Kernels<Sse2>::function(__VA_ARGS__))
+#elif JPT_STRING_SSE2
+    #define JPT_STRING_DISPATCH(function, ...) Kernels<Sse2>::function(__VA_ARGS__)
+#else
+    #define JPT_STRING_DISPATCH(function, ...) Kernels<Scalar>::function(__VA_ARGS__)
+#endif
+
+#if !JPT_STRING_SSE2
+    template<>
+    struct Kernels<Scalar> : Scalar
+    {
+        template<typename TChar>
+        static Index FindString(const TChar* pBuffer, Index count, const TChar* pToFind, Index toFindCount)
+        {
+            for (Index i = 0; i + toFindCount <= count; ++i)
+            {
+                if (std::memcmp(pBuffer + i, pToFind, toFindCount * sizeof(TChar)) == 0)
+                {
+                    return i;
+                }
+            }
+            return kInvalidIndex;
+        }
+    };
+#endif
+
+    Index FindChar(const char*    pBuffer, Index count, char    c) { return JPT_STRING_DISPATCH(FindChar, pBuffer, count, c); }
+    Index FindChar(const wchar_t* pBuffer, Index count, wchar_t c) { return JPT_STRING_DISPATCH(FindChar, pBuffer, count, c); }
+
+    Index CountChar(const char*    pBuffer, Index count, char    c) { return JPT_STRING_DISPATCH(CountChar, pBuffer, count, c); }
+    Index CountChar(const wchar_t* pBuffer, Index count, wchar_t c) { return JPT_STRING_DISPATCH(CountChar, pBuffer, count, c); }
+
+    Index FindString(const char*    pBuffer, Index count, const char*    pToFind, Index toFindCount) { return JPT_STRING_DISPATCH(FindString, pBuffer, count, pToFind, toFindCount); }
+    Index FindString(const wchar_t* pBuffer, Index count, const wchar_t* pToFind, Index toFindCount) { return JPT_STRING_DISPATCH(FindString, pBuffer, count, pToFind, toFindCount); }
+
+    Index FindMismatch(const char*    pString1, const char*    pString2, Index count) { return JPT_STRING_DISPATCH(FindMismatch, pString1, pString2, count); }
+    Index FindMismatch(const wchar_t* pString1, const wchar_t* pString2, Index count) { return JPT_STRING_DISPATCH(FindMismatch, pString1, pString2, count); }
+
+    // The CRT's are already vectorized, and safe to read up to the terminator only
+    Index FindNull(const char*    pString) { return std::strlen(pString); }
+    Index FindNull(const wchar_t* pString) { return std::wcslen(pString); }
+}
\ No newline at end of file
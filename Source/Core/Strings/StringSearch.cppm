@@ -0,0 +1,117 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <type_traits>
+
+export module jpt.StringSearch;
+
+import jpt.Concepts;
+import jpt.Constants;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Vectorized search and compare over raw char ranges. AVX2 when the CPU has it, SSE2 otherwise, scalar on other targets.
+        Use the constexpr wrappers below, they fall back to plain loops at compile time */
+    namespace StringKernels
+    {
+        Index FindChar(const char*    pBuffer, Index count, char    c);
+        Index FindChar(const wchar_t* pBuffer, Index count, wchar_t c);
+
+        Index CountChar(const char*    pBuffer, Index count, char    c);
+        Index CountChar(const wchar_t* pBuffer, Index count, wchar_t c);
+
+        Index FindString(const char*    pBuffer, Index count, const char*    pToFind, Index toFindCount);
+        Index FindString(const wchar_t* pBuffer, Index count, const wchar_t* pToFind, Index toFindCount);
+
+        Index FindMismatch(const char*    pString1, const char*    pString2, Index count);
+        Index FindMismatch(const wchar_t* pString1, const wchar_t* pString2, Index count);
+
+        Index FindNull(const char*    pString);
+        Index FindNull(const wchar_t* pString);
+
+        /** @return     Whether the AVX2 kernels are in use */
+        bool IsAvx2Enabled();
+    }
+
+    /** @return     Index of the first c in [pBuffer, pBuffer + count), or kInvalidIndex */
+    template<StringLiteral TChar>
+    constexpr Index FindChar(const TChar* pBuffer, Index count, TChar c)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return StringKernels::FindChar(pBuffer, count, c);
+        }
+
+        for (Index i = 0; i < count; ++i)
+        {
+            if (pBuffer[i] == c)
+            {
+                return i;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    /** @return     How many times c appears in [pBuffer, pBuffer + count) */
+    template<StringLiteral TChar>
+    constexpr Index CountChar(const TChar* pBuffer, Index count, TChar c)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return StringKernels::CountChar(pBuffer, count, c);
+        }
+
+        Index found = 0;
+        for (Index i = 0; i < count; ++i)
+        {
+            found += pBuffer[i] == c;
+        }
+        return found;
+    }
+
+    /** @return     Index of the first occurrence of pToFind in [pBuffer, pBuffer + count), or kInvalidIndex. An empty pToFind is found at 0 */
+    template<StringLiteral TChar>
+    constexpr Index FindString(const TChar* pBuffer, Index count, const TChar* pToFind, Index toFindCount)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return StringKernels::FindString(pBuffer, count, pToFind, toFindCount);
+        }
+
+        for (Index i = 0; i + toFindCount <= count; ++i)
+        {
+            Index j = 0;
+            while (j < toFindCount && pBuffer[i + j] == pToFind[j])
+            {
+                ++j;
+            }
+
+            if (j == toFindCount)
+            {
+                return i;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    /** @return     Index of the first char that differs between the two ranges, or kInvalidIndex if they're identical */
+    template<StringLiteral TChar>
+    constexpr Index FindMismatch(const TChar* pString1, const TChar* pString2, Index count)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return StringKernels::FindMismatch(pString1, pString2, count);
+        }
+
+        for (Index i = 0; i < count; ++i)
+        {
+            if (pString1[i] != pString2[i])
+            {
+                return i;
+            }
+        }
+        return kInvalidIndex;
+    }
+}
\ No newline at end of file
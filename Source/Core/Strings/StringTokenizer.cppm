@@ -0,0 +1,258 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <type_traits>
+
+export module jpt.StringTokenizer;
+
+import jpt.Concepts;
+import jpt.Constants;
+import jpt.StringHelpers;
+import jpt.StringSearch;
+import jpt.StringView;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Where a delimiter was found in the remaining text, and how many chars it covers */
+    struct DelimiterMatch
+    {
+        Index index = kInvalidIndex;
+        Index count = 0;
+    };
+
+    /** Splits at every occurrence of a single char */
+    template<StringLiteral TChar>
+    struct CharDelimiter
+    {
+        static constexpr bool kIsTerminator = false;
+
+        TChar delimiter;
+
+        constexpr DelimiterMatch Find(const TChar* pBuffer, Index count) const
+        {
+            return { FindChar(pBuffer, count, delimiter), 1 };
+        }
+    };
+
+    /** Splits at every occurrence of a string. The delimiter must outlive the tokenizer */
+    template<StringLiteral TChar>
+    struct StringDelimiter
+    {
+        static constexpr bool kIsTerminator = false;
+
+        const TChar* pDelimiter;
+        Index delimiterCount;
+
+        constexpr DelimiterMatch Find(const TChar* pBuffer, Index count) const
+        {
+            return { FindString(pBuffer, count, pDelimiter, delimiterCount), delimiterCount };
+        }
+    };
+
+    /** Splits at "\n" or "\r\n". A newline ends a line rather than separating two, so text ending with one has no extra empty line */
+    template<StringLiteral TChar>
+    struct LineDelimiter
+    {
+        static constexpr bool kIsTerminator = true;
+
+        constexpr DelimiterMatch Find(const TChar* pBuffer, Index count) const
+        {
+            const Index index = FindChar(pBuffer, count, static_cast<TChar>('\n'));
+            if (index == kInvalidIndex)
+            {
+                // Last line without newline may still carry a '\r'
+                if (count > 0 && pBuffer[count - 1] == '\r')
+                {
+                    return { count - 1, 1 };
+                }
+                return {};
+            }
+
+            if (index > 0 && pBuffer[index - 1] == '\r')
+            {
+                return { index - 1, 2 };
+            }
+            return { index, 1 };
+        }
+    };
+
+    /** Splits at every char the predicate returns true for */
+    template<StringLiteral TChar, typename TPredicate>
+    struct PredicateDelimiter
+    {
+        static constexpr bool kIsTerminator = false;
+
+        TPredicate predicate;
+
+        constexpr DelimiterMatch Find(const TChar* pBuffer, Index count) const
+        {
+            for (Index i = 0; i < count; ++i)
+            {
+                if (predicate(pBuffer[i]))
+                {
+                    return { i, 1 };
+                }
+            }
+            return {};
+        }
+    };
+
+    /** Lazy range of tokens over a text. Never allocates nor copies, every token is a view into the original text,
+        which must outlive the tokenizer. Materialize a String only for the tokens worth keeping
+
+        @param skipEmpty        Whether tokens between two adjacent delimiters are skipped
+
+        @example
+            for (jpt::StringView line : jpt::SplitLines(text))
+            {
+                for (jpt::StringView cell : jpt::SplitView(line, ','))
+                {
+                    ...
+                }
+            } */
+    template<StringLiteral TChar, typename TDelimiter>
+    class StringTokenizer
+    {
+    public:
+        class Iterator
+        {
+        private:
+            const StringTokenizer* m_pTokenizer = nullptr;
+            const TChar* m_pNext = nullptr;     /**< Start of the text after the current token. nullptr once the last token was reached */
+            StringView_Base<TChar> m_token;
+            bool m_isEnd = true;
+
+        public:
+            constexpr Iterator() = default;
+            constexpr Iterator(const StringTokenizer* pTokenizer)
+                : m_pTokenizer(pTokenizer)
+                , m_pNext(pTokenizer->m_text.ConstBuffer())
+                , m_isEnd(false)
+            {
+                Advance();
+            }
+
+            constexpr Iterator& operator++() { Advance(); return *this; }
+            constexpr Iterator operator++(int) { Iterator iterator = *this; Advance(); return iterator; }
+
+            constexpr const StringView_Base<TChar>& operator*() const { return m_token; }
+            constexpr const StringView_Base<TChar>* operator->() const { return &m_token; }
+
+            constexpr bool operator==(const Iterator& other) const
+            {
+                if (m_isEnd || other.m_isEnd)
+                {
+                    return m_isEnd == other.m_isEnd;
+                }
+                return m_token.ConstBuffer() == other.m_token.ConstBuffer() && m_pNext == other.m_pNext;
+            }
+
+        private:
+            constexpr void Advance();
+        };
+
+    private:
+        StringView_Base<TChar> m_text;
+        TDelimiter m_delimiter;
+        bool m_skipEmpty = false;
+
+    public:
+        constexpr StringTokenizer(StringView_Base<TChar> text, const TDelimiter& delimiter, bool skipEmpty = false)
+            : m_text(text)
+            , m_delimiter(delimiter)
+            , m_skipEmpty(skipEmpty)
+        {
+        }
+
+        constexpr Iterator begin() const { return Iterator(this); }
+        constexpr Iterator end()   const { return Iterator(); }
+
+        /** @return     Number of tokens. Walks the whole text */
+        constexpr Index Count() const;
+    };
+
+    template<StringLiteral TChar, typename TDelimiter>
+    constexpr void StringTokenizer<TChar, TDelimiter>::Iterator::Advance()
+    {
+        const TChar* pEnd = m_pTokenizer->m_text.ConstBuffer() + m_pTokenizer->m_text.Count();
+
+        while (true)
+        {
+            if (m_pNext == nullptr || (TDelimiter::kIsTerminator && m_pNext == pEnd))
+            {
+                m_isEnd = true;
+                return;
+            }
+
+            const TChar* pStart = m_pNext;
+            const DelimiterMatch match = m_pTokenizer->m_delimiter.Find(pStart, pEnd - pStart);
+            if (match.index == kInvalidIndex)
+            {
+                m_token = StringView_Base<TChar>(pStart, pEnd - pStart);
+                m_pNext = nullptr;
+            }
+            else
+            {
+                m_token = StringView_Base<TChar>(pStart, match.index);
+                m_pNext = pStart + match.index + match.count;
+            }
+
+            if (!m_pTokenizer->m_skipEmpty || !m_token.IsEmpty())
+            {
+                return;
+            }
+        }
+    }
+
+    template<StringLiteral TChar, typename TDelimiter>
+    constexpr Index StringTokenizer<TChar, TDelimiter>::Count() const
+    {
+        Index count = 0;
+        for (Iterator it = begin(); it != end(); ++it)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    /** Splits text at every delimiter. Adjacent delimiters produce empty tokens unless skipEmpty
+        @example    jpt::SplitView(row, ',') over "a,,b" yields "a", "", "b" */
+    template<StringLiteral TChar>
+    [[nodiscard]] constexpr StringTokenizer<TChar, CharDelimiter<TChar>> SplitView(std::type_identity_t<StringView_Base<TChar>> text, TChar delimiter, bool skipEmpty = false)
+    {
+        return StringTokenizer<TChar, CharDelimiter<TChar>>(text, CharDelimiter<TChar>{ delimiter }, skipEmpty);
+    }
+
+    template<StringLiteral TChar>
+    [[nodiscard]] constexpr StringTokenizer<TChar, StringDelimiter<TChar>> SplitView(std::type_identity_t<StringView_Base<TChar>> text, const TChar* pDelimiter, bool skipEmpty = false)
+    {
+        return StringTokenizer<TChar, StringDelimiter<TChar>>(text, StringDelimiter<TChar>{ pDelimiter, FindCharsCount(pDelimiter) }, skipEmpty);
+    }
+
+    /** Splits text into lines without their "\n" or "\r\n" */
+    [[nodiscard]] constexpr StringTokenizer<char, LineDelimiter<char>> SplitLines(StringView text, bool skipEmpty = false)
+    {
+        return StringTokenizer<char, LineDelimiter<char>>(text, LineDelimiter<char>{}, skipEmpty);
+    }
+
+    [[nodiscard]] constexpr StringTokenizer<wchar_t, LineDelimiter<wchar_t>> SplitLines(WStringView text, bool skipEmpty = false)
+    {
+        return StringTokenizer<wchar_t, LineDelimiter<wchar_t>>(text, LineDelimiter<wchar_t>{}, skipEmpty);
+    }
+
+    /** Splits text at every char the predicate returns true for
+        @example    jpt::SplitViewIf(text, jpt::IsSpace<char>, true) yields the words of text */
+    template<typename TPredicate>
+    [[nodiscard]] constexpr StringTokenizer<char, PredicateDelimiter<char, TPredicate>> SplitViewIf(StringView text, TPredicate predicate, bool skipEmpty = false)
+    {
+        return StringTokenizer<char, PredicateDelimiter<char, TPredicate>>(text, PredicateDelimiter<char, TPredicate>{ predicate }, skipEmpty);
+    }
+
+    template<typename TPredicate>
+    [[nodiscard]] constexpr StringTokenizer<wchar_t, PredicateDelimiter<wchar_t, TPredicate>> SplitViewIf(WStringView text, TPredicate predicate, bool skipEmpty = false)
+    {
+        return StringTokenizer<wchar_t, PredicateDelimiter<wchar_t, TPredicate>>(text, PredicateDelimiter<wchar_t, TPredicate>{ predicate }, skipEmpty);
+    }
+}
\ No newline at end of file
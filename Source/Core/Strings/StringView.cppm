@@ -13,6 +13,7 @@ import jpt.Constants;
 import jpt.Math;
 import jpt.String;
 import jpt.StringHelpers;
+import jpt.StringSearch;
 import jpt.TypeDefs;
 
 export namespace jpt
@@ -108,6 +109,13 @@ export namespace jpt
         return String(stringView.ConstBuffer(), stringView.Count());
     }
 
+    /** @return        A view of the sub string within the given range at index and length. Unlike String::SubStr, nothing is copied */
+    template<StringLiteral TChar>
+    [[nodiscard]] constexpr StringView_Base<TChar> SubStrView(const String_Base<TChar>& string, Index index, Index count = kInvalidIndex)
+    {
+        return StringView_Base<TChar>(string).SubStr(index, count);
+    }
+
     // ------------------------------------------------------------------------------------------------
     // Member Functions Definitions
     // ------------------------------------------------------------------------------------------------
@@ -254,18 +262,17 @@ export namespace jpt
 
         for (Index i = startIndex; i < endIndex; ++i)
         {
-            if ((i + 1) > endIndex)
+            const Index found = FindChar(m_pBuffer + i, endIndex - i, charToFind);
+            if (found == kInvalidIndex)
             {
                 return kInvalidIndex;
             }
 
-            if (m_pBuffer[i] == charToFind)
+            i += found;
+            --count;
+            if (count == 0)
             {
-                --count;
-                if (count == 0)
-                {
-                    return i;
-                }
+                return i;
             }
         }
 
@@ -278,22 +285,20 @@ export namespace jpt
         const Index StringToFindSize = FindCharsCount(pStringToFind);
         endIndex = Clamp(endIndex, static_cast<Index>(0), m_count);
 
-        StringView_Base current;
+        // Occurrences may overlap
         for (Index i = startIndex; i < endIndex; ++i)
         {
-            if ((i + StringToFindSize) > endIndex)
+            const Index found = FindString(m_pBuffer + i, endIndex - i, pStringToFind, StringToFindSize);
+            if (found == kInvalidIndex)
             {
                 return kInvalidIndex;
             }
 
-            current = SubStr(i, StringToFindSize);
-            if (current == pStringToFind)
+            i += found;
+            --count;
+            if (count == 0)
             {
-                --count;
-                if (count == 0)
-                {
-                    return i;
-                }
+                return i;
             }
         }
 
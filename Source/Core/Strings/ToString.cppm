@@ -10,6 +10,7 @@ module;
 
 export module jpt.ToString;
 
+import jpt.NumberConversion;
 import jpt.Pair;
 import jpt.String;
 import jpt.StringHelpers;
@@ -26,22 +27,20 @@ export namespace jpt
     {
         using TChar = TString::TChar;
 
-        TChar* integerCString = IntegerToCStr<TChar>(integer);
-        TString integerString;
-        integerString.MoveString(integerCString);
-        return integerString;
+        TChar buffer[kMaxIntegerChars];
+        const Index count = WriteInteger(buffer, integer);
+        return TString(buffer, count);
     }
 
-    // floating
+    // floating. Shortest text that reads back to the same value
     template<StringType TString = jpt::String, Floating TFloat = float32>
     constexpr TString ToString(TFloat value)
     {
         using TChar = TString::TChar;
 
-        TChar* floatCString = FloatToCStr<TChar>(value);
-        TString floatString;
-        floatString.MoveString(floatCString);
-        return floatString;
+        TChar buffer[kMaxFloatChars];
+        const Index count = WriteFloat(buffer, value);
+        return TString(buffer, count);
     }
 
     // Boolean
@@ -2,31 +2,214 @@
 
 module;
 
+#include "Core/Memory/Memory.h"
 #include "Core/Validation/Assert.h"
 
+#include <atomic>
+#include <cstring>
+
 module jpt.UniqueString;
 
+import jpt.Allocator;
+import jpt.DynamicArray;
+import jpt.LockGuard;
+import jpt.Mutex;
+
 namespace jpt
 {
-    UniqueString::UniqueString(const char* str)
-        : m_hash(Hash(str))
+    /** Open-addressed index of interned entries. Readers probe without locking, writers serialize on a mutex.
+        Slots only ever go from empty to an entry, so a reader sees either a complete entry or an empty slot.
+        Growing publishes a new slot array. Old arrays stay alive until Clear(), a reader may still be probing one */
+    class UniqueStringTable
+    {
+    private:
+        struct Slots
+        {
+            std::atomic<UniqueStringEntry*>* pSlots = nullptr;
+            size_t capacity = 0;    /**< Power of two */
+        };
+
+        static constexpr size_t kInitialCapacity = 1024;
+
+    private:
+        std::atomic<Slots*> m_pSlots = nullptr;
+        DynamicArray<Slots*> m_retiredSlots;
+        size_t m_count = 0;
+        Mutex m_mutex;
+
+    public:
+        UniqueStringTable();
+        ~UniqueStringTable();
+
+        const UniqueStringEntry* Intern(const char* str, size_t count);
+        void Clear();
+        size_t Count();
+
+    private:
+        static Slots* CreateSlots(size_t capacity);
+        static void DestroySlots(Slots* pSlots);
+        static const UniqueStringEntry* Find(const Slots& slots, const char* str, size_t count, uint64 hash);
+        static void Insert(Slots& slots, UniqueStringEntry* pEntry);
+
+        void Grow(Slots& slots);
+    };
+
+    UniqueStringTable::UniqueStringTable()
+    {
+        m_pSlots.store(CreateSlots(kInitialCapacity), std::memory_order_relaxed);
+    }
+
+    UniqueStringTable::~UniqueStringTable()
+    {
+        Clear();
+        DestroySlots(m_pSlots.load(std::memory_order_relaxed));
+    }
+
+    const UniqueStringEntry* UniqueStringTable::Intern(const char* str, size_t count)
     {
-        if (!s_uniqueStrings.Has(m_hash))
+        const uint64 hash = HashString(str, count);
+
+        // Already interned. No lock
+        if (const UniqueStringEntry* pEntry = Find(*m_pSlots.load(std::memory_order_acquire), str, count, hash))
+        {
+            return pEntry;
+        }
+
+        LockGuard lock(m_mutex);
+
+        // Another thread may have added it, or grown the table, since
+        Slots* pSlots = m_pSlots.load(std::memory_order_relaxed);
+        if (const UniqueStringEntry* pEntry = Find(*pSlots, str, count, hash))
         {
-            s_uniqueStrings.Emplace(m_hash, str);
+            return pEntry;
         }
+
+        // Keep under 3/4 full so probes stay short and always reach an empty slot
+        if ((m_count + 1) * 4 > pSlots->capacity * 3)
+        {
+            Grow(*pSlots);
+            pSlots = m_pSlots.load(std::memory_order_relaxed);
+        }
+
+        UniqueStringEntry* pEntry = JPT_NEW(UniqueStringEntry);
+        pEntry->str = String(str, count);
+        pEntry->hash = hash;
+
+        Insert(*pSlots, pEntry);
+        ++m_count;
+
+        return pEntry;
     }
 
-    const String& UniqueString::operator*() const
+    void UniqueStringTable::Clear()
     {
-        JPT_ASSERT(s_uniqueStrings.Has(m_hash), "UniqueString not found in the map");
+        LockGuard lock(m_mutex);
+
+        Slots* pSlots = m_pSlots.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < pSlots->capacity; ++i)
+        {
+            UniqueStringEntry* pEntry = pSlots->pSlots[i].load(std::memory_order_relaxed);
+            if (pEntry)
+            {
+                JPT_DELETE(pEntry);
+                pSlots->pSlots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        for (Slots* pRetired : m_retiredSlots)
+        {
+            DestroySlots(pRetired);
+        }
+        m_retiredSlots.Clear();
+        m_count = 0;
+    }
 
-        return s_uniqueStrings[m_hash];
+    size_t UniqueStringTable::Count()
+    {
+        LockGuard lock(m_mutex);
+        return m_count;
+    }
+
+    UniqueStringTable::Slots* UniqueStringTable::CreateSlots(size_t capacity)
+    {
+        Slots* pSlots = JPT_NEW(Slots);
+        pSlots->pSlots = JPT_NEW_ARRAY(std::atomic<UniqueStringEntry*>, capacity);
+        pSlots->capacity = capacity;
+        return pSlots;
+    }
+
+    void UniqueStringTable::DestroySlots(Slots* pSlots)
+    {
+        JPT_DELETE_ARRAY(pSlots->pSlots);
+        JPT_DELETE(pSlots);
+    }
+
+    const UniqueStringEntry* UniqueStringTable::Find(const Slots& slots, const char* str, size_t count, uint64 hash)
+    {
+        const size_t mask = slots.capacity - 1;
+        for (size_t index = hash & mask; ; index = (index + 1) & mask)
+        {
+            const UniqueStringEntry* pEntry = slots.pSlots[index].load(std::memory_order_acquire);
+            if (!pEntry)
+            {
+                return nullptr;
+            }
+
+            // Equal hashes aren't enough, colliding strings each keep their own entry
+            if (pEntry->hash == hash && pEntry->str.Count() == count && std::memcmp(pEntry->str.ConstBuffer(), str, count) == 0)
+            {
+                return pEntry;
+            }
+        }
+    }
+
+    void UniqueStringTable::Insert(Slots& slots, UniqueStringEntry* pEntry)
+    {
+        const size_t mask = slots.capacity - 1;
+        size_t index = pEntry->hash & mask;
+        while (slots.pSlots[index].load(std::memory_order_relaxed))
+        {
+            index = (index + 1) & mask;
+        }
+
+        // Release: readers that see the pointer see the whole entry
+        slots.pSlots[index].store(pEntry, std::memory_order_release);
+    }
+
+    void UniqueStringTable::Grow(Slots& slots)
+    {
+        Slots* pGrown = CreateSlots(slots.capacity * 2);
+        for (size_t i = 0; i < slots.capacity; ++i)
+        {
+            if (UniqueStringEntry* pEntry = slots.pSlots[i].load(std::memory_order_relaxed))
+            {
+                Insert(*pGrown, pEntry);
+            }
+        }
+
+        m_retiredSlots.EmplaceBack(&slots);
+        m_pSlots.store(pGrown, std::memory_order_release);
+    }
+
+    static UniqueStringTable& locGetTable()
+    {
+        static UniqueStringTable s_table;
+        return s_table;
+    }
+
+    UniqueString::UniqueString(const char* str)
+        : UniqueString(str, std::strlen(str))
+    {
+    }
+
+    UniqueString::UniqueString(const char* str, size_t count)
+        : m_pEntry(locGetTable().Intern(str, count))
+    {
     }
 
-    uint64 UniqueString::GetHash() const
+    UniqueString::UniqueString(const String& str)
+        : UniqueString(str.ConstBuffer(), str.Count())
     {
-        return m_hash;
     }
 
     // ------------------------------------------------------------------------------------------------
@@ -34,11 +217,11 @@ namespace jpt
     // ------------------------------------------------------------------------------------------------
     void UniqueString::Clear()
     {
-        s_uniqueStrings.Clear();
+        locGetTable().Clear();
     }
 
-    void UniqueString::Erase(const char* str)
+    size_t UniqueString::Count()
     {
-        s_uniqueStrings.Erase(Hash(str));
+        return locGetTable().Count();
     }
 }
\ No newline at end of file
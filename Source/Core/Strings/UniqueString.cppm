@@ -3,44 +3,62 @@
 export module jpt.UniqueString;
 
 import jpt.Hash;
-import jpt.HashMap;
 import jpt.String;
 import jpt.TypeDefs;
 
 export namespace jpt
 {
+    /** Interned string, owned by the table until UniqueString::Clear() */
+    struct UniqueStringEntry
+    {
+        String str;
+        uint64 hash = 0;
+    };
+
     /** Unique string through out application. Unreal's FName equivalent.
+        Interning is safe from any thread. Strings already in the table are found without locking, new ones are added under a lock.
+        Each distinct string has exactly one entry, so two handles are equal iff they point to it. Strings with the same 64-bit hash still get separate entries
         @example:
             UniqueString uniqueStr("Hello");    // Heap-Allocate a string
             UniqueString uniqueStr2("Hello");   // Reuses the same string */
     class UniqueString
     {
     private:
-        static inline HashMap<uint64, String> s_uniqueStrings;  /**< Shared Hash map to store unique strings */
-
-        uint64 m_hash = 0;    /**< Unique Identifier, key in the map to retreive the unique string */
+        const UniqueStringEntry* m_pEntry = nullptr;
 
     public:
         UniqueString(const char* str);
+        UniqueString(const char* str, size_t count);
+        UniqueString(const String& str);
+
+        const String& operator*() const { return m_pEntry->str; }
+        const String* operator->() const { return &m_pEntry->str; }
+        uint64 GetHash() const { return m_pEntry->hash; }
 
-        const String& operator*() const;
-        uint64 GetHash() const;
+        bool operator==(const UniqueString& other) const { return m_pEntry == other.m_pEntry; }
 
     public:
+        /** Frees every entry. No UniqueString may be alive or being created on another thread */
         static void Clear();
-        static void Erase(const char* str);
+
+        /** @return     Number of distinct strings interned */
+        static size_t Count();
     };
 
     // ------------------------------------------------------------------------------------------------
     // Non-Member Functions
     // ------------------------------------------------------------------------------------------------
-    bool operator==(const UniqueString& lhs, const UniqueString& rhs)
-    {
-        return lhs.GetHash() == rhs.GetHash();
-    }
-
     String ToString(const UniqueString& uniqueStr)
     {
         return *uniqueStr;
     }
+
+    template<>
+    struct Hasher<UniqueString>
+    {
+        uint64 operator()(const UniqueString& uniqueStr) const
+        {
+            return uniqueStr.GetHash();
+        }
+    };
 }
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 module;
 
+#include <chrono>
 #include <condition_variable>
 
 export module jpt.ConditionVariable;
 
 import jpt.Mutex;
+import jpt.TypeDefs;
 
 export namespace jpt
 {
@@ -39,6 +41,10 @@ export namespace jpt
 
         template<typename Predicate>
         void Wait(std::unique_lock<std::mutex>& lock, Predicate predicate);
+
+        /** @return     predicate's result, false if it timed out */
+        template<typename Predicate>
+        bool WaitFor(std::unique_lock<std::mutex>& lock, int32 milliseconds, Predicate predicate);
     };
 
     template<typename Predicate>
@@ -46,4 +52,10 @@ export namespace jpt
     {
         m_conditionVariable.wait(lock, predicate);
     }
+
+    template<typename Predicate>
+    bool ConditionVariable::WaitFor(std::unique_lock<std::mutex>& lock, int32 milliseconds, Predicate predicate)
+    {
+        return m_conditionVariable.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
+    }
 }
\ No newline at end of file
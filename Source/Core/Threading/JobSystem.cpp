@@ -0,0 +1,322 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Memory/Memory.h"
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+module jpt.JobSystem;
+
+import jpt.LockGuard;
+import jpt.Optional;
+import jpt.String;
+import jpt.ToString;
+
+namespace jpt
+{
+    static thread_local uint32 locWorkerIndex = JobSystem::kInvalidWorkerIndex;
+    static thread_local uint32 locStealCursor = 0;
+
+    class JobWorker final : public Thread
+    {
+    private:
+        JobSystem& m_jobSystem;
+        uint32 m_index = 0;
+
+    public:
+        JobWorker(JobSystem& jobSystem, uint32 index)
+            : Thread("Job Worker")
+            , m_jobSystem(jobSystem)
+            , m_index(index)
+        {
+            m_name += ToString(index);
+        }
+
+    protected:
+        void Init() override
+        {
+            locWorkerIndex = m_index;
+            locStealCursor = m_index;
+        }
+
+        void Update() override
+        {
+            if (!m_jobSystem.TryExecuteOne(m_index))
+            {
+                m_jobSystem.Sleep();
+            }
+        }
+    };
+
+    void JobCounter::Decrement()
+    {
+        // Ordered before the release below. Whoever sees the value reach zero also sees this call in flight
+        m_decrementingCount.fetch_add(1, std::memory_order_relaxed);
+
+        // Only the last decrement takes the lock, and only to hand over the jobs waiting on this counter
+        if (m_value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            JobSystem::GetInstance().ReleaseWaiters(*this);
+        }
+
+        // Last access. A waiter may destroy the counter as soon as this lands
+        m_decrementingCount.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::Init(uint32 workersCount)
+    {
+        JPT_ASSERT(!m_isRunning, "JobSystem is already initialized");
+
+        MemoryPool_ThreadCached::Config config
+        {
+            .blockSize      = sizeof(Job),
+            .blocksPerChunk = 1024,
+            .initialChunks  = 1,
+            .maxChunks      = kMaxJobsInFlight / 1024,
+            .alignment      = Max(alignof(Job), alignof(void*))
+        };
+        m_pJobPool = JPT_NEW(MemoryPool_ThreadCached, config);
+
+        m_dequesCount = workersCount + 1;
+        m_pDeques = new Deque[m_dequesCount];
+        m_isRunning = true;
+
+        locWorkerIndex = 0;
+
+        m_workers.Reserve(workersCount);
+        for (uint32 i = 1; i <= workersCount; ++i)
+        {
+            m_workers.EmplaceBack(JPT_NEW(JobWorker, *this, i));
+            m_workers.Back()->Start();
+        }
+
+        JPT_INFO("JobSystem initialized with %u workers", workersCount);
+    }
+
+    void JobSystem::Terminate()
+    {
+        if (!m_isRunning)
+        {
+            return;
+        }
+
+        for (Thread* pWorker : m_workers)
+        {
+            pWorker->Stop();
+        }
+
+        {
+            LockGuard lock(m_sleepMutex);
+            m_isRunning = false;
+            m_sleepCondition.NotifyAll();
+        }
+
+        for (Thread* pWorker : m_workers)
+        {
+            pWorker->Join();
+            JPT_DELETE(pWorker);
+        }
+        m_workers.Clear();
+
+        // Nobody else can run them now. Execute them here so counters reach zero and captured resources are released
+        while (TryExecuteOne(0))
+        {
+        }
+
+        m_injectionQueue.Terminate();
+
+        delete[] m_pDeques;
+        m_pDeques = nullptr;
+        m_dequesCount = 0;
+
+        m_pJobPool->FlushThreadCache();
+        JPT_DELETE(m_pJobPool);
+
+        locWorkerIndex = kInvalidWorkerIndex;
+    }
+
+    void JobSystem::Run(JobFunction&& function, JobCounter* pCounter, const JobCounter* pDependency)
+    {
+        if (pCounter)
+        {
+            pCounter->Add();
+        }
+
+        void* pMemory = m_pJobPool ? m_pJobPool->New() : nullptr;
+        if (!pMemory)
+        {
+            // Not initialized, or too many jobs in flight. Degrade to synchronous instead of failing
+            if (pDependency)
+            {
+                WaitFor(*pDependency);
+            }
+
+            function();
+
+            if (pCounter)
+            {
+                pCounter->Decrement();
+            }
+            return;
+        }
+
+        Job* pJob = new (pMemory) Job{ {}, Move(function), pCounter };
+        if (!pDependency || !TryWaitOn(pJob, *pDependency))
+        {
+            Push(pJob);
+        }
+    }
+
+    void JobSystem::WaitFor(const JobCounter& counter)
+    {
+        const uint32 workerIndex = GetCurrentWorkerIndex();
+
+        while (!counter.IsDone())
+        {
+            if (!TryExecuteOne(workerIndex))
+            {
+                // The remaining jobs are running on other workers
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    uint32 JobSystem::GetCurrentWorkerIndex() const
+    {
+        return locWorkerIndex;
+    }
+
+    bool JobSystem::TryExecuteOne(uint32 workerIndex)
+    {
+        Job* pJob = FindJob(workerIndex);
+        if (!pJob)
+        {
+            return false;
+        }
+
+        m_pendingCount.fetch_sub(1, std::memory_order_relaxed);
+        Execute(pJob);
+        return true;
+    }
+
+    JobSystem::Job* JobSystem::FindJob(uint32 workerIndex)
+    {
+        if (m_dequesCount == 0)
+        {
+            return nullptr;
+        }
+
+        // Own deque first, newest job, its data is likely still in cache
+        Job* pJob = nullptr;
+        if (workerIndex < m_dequesCount && m_pDeques[workerIndex].Pop(pJob))
+        {
+            return pJob;
+        }
+
+        if (Optional<Job*> injected = m_injectionQueue.TryPop())
+        {
+            return injected.Value();
+        }
+
+        return StealJob(workerIndex);
+    }
+
+    JobSystem::Job* JobSystem::StealJob(uint32 workerIndex)
+    {
+        // Oldest job of another worker, starting at a different victim each time
+        Job* pJob = nullptr;
+        const uint32 start = locStealCursor++;
+        for (uint32 i = 0; i < m_dequesCount; ++i)
+        {
+            const uint32 victim = (start + i) % m_dequesCount;
+            if (victim != workerIndex && m_pDeques[victim].Steal(pJob))
+            {
+                return pJob;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::Execute(Job* pJob)
+    {
+        pJob->function();
+
+        JobCounter* pCounter = pJob->pCounter;
+
+        pJob->~Job();
+        m_pJobPool->Delete(pJob);
+
+        if (pCounter)
+        {
+            pCounter->Decrement();
+        }
+    }
+
+    void JobSystem::Push(Job* pJob)
+    {
+        const uint32 workerIndex = GetCurrentWorkerIndex();
+        if (workerIndex >= m_dequesCount || !m_pDeques[workerIndex].Push(pJob))
+        {
+            m_injectionQueue.Push(pJob);
+        }
+
+        // Pairs with Sleep(): either this sees the sleeper, or the sleeper sees the pending job
+        m_pendingCount.fetch_add(1, std::memory_order_seq_cst);
+        if (m_sleepingCount.load(std::memory_order_seq_cst) > 0)
+        {
+            LockGuard lock(m_sleepMutex);
+            m_sleepCondition.NotifyOne();
+        }
+    }
+
+    bool JobSystem::TryWaitOn(Job* pJob, const JobCounter& dependency)
+    {
+        // Checked under the lock the last Decrement() takes, so the job is either parked before it releases the waiters, or sees it done
+        // Value only. A decrement still in flight may have taken the list already, a job parked now would never be released
+        LockGuard lock(dependency.m_waitersMutex);
+        if (dependency.m_value.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        pJob->pNextWaiter = dependency.m_pWaiters;
+        dependency.m_pWaiters = pJob;
+        return true;
+    }
+
+    void JobSystem::ReleaseWaiters(const JobCounter& counter)
+    {
+        JobCounter::Waiter* pWaiter = nullptr;
+        {
+            LockGuard lock(counter.m_waitersMutex);
+            pWaiter = counter.m_pWaiters;
+            counter.m_pWaiters = nullptr;
+        }
+
+        while (pWaiter)
+        {
+            Job* pJob = static_cast<Job*>(pWaiter);
+            pWaiter = pWaiter->pNextWaiter;
+            Push(pJob);
+        }
+    }
+
+    void JobSystem::Sleep()
+    {
+        m_sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+        {
+            auto lock = m_sleepMutex.CreateUniqueLock();
+            m_sleepCondition.Wait(lock, [this]()
+                {
+                    return m_pendingCount.load(std::memory_order_seq_cst) > 0 || !m_isRunning;
+                });
+        }
+        m_sleepingCount.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/Utilities.h"
+#include "Core/Validation/Assert.h"
+
+#include <atomic>
+
+export module jpt.JobSystem;
+
+import jpt.ConditionVariable;
+import jpt.DynamicArray;
+import jpt.Function;
+import jpt.Math;
+import jpt.MemoryPool_ThreadCached;
+import jpt.Mutex;
+import jpt.Thread;
+import jpt.ThreadSafeQueue;
+import jpt.TypeDefs;
+import jpt.Utilities;
+import jpt.WorkStealingDeque;
+
+export namespace jpt
+{
+    class JobSystem;
+
+    /** Counts jobs in flight. JobSystem::Run() increments it, the job decrements it once it has finished
+        @note   Must outlive every job it counts, and every job that depends on it */
+    class JobCounter
+    {
+        friend class JobSystem;
+
+    private:
+        /** Intrusive link of a job parked on this counter until it reaches zero */
+        struct Waiter
+        {
+            Waiter* pNextWaiter = nullptr;
+        };
+
+    private:
+        std::atomic<int32> m_value = 0;
+        std::atomic<int32> m_decrementingCount = 0;   /**< Decrement() calls still touching this counter. IsDone() waits them out, so it can be destroyed right after */
+
+        mutable Mutex m_waitersMutex;
+        mutable Waiter* m_pWaiters = nullptr;    /**< Jobs depending on this counter. Queued by the Decrement() that reaches zero */
+
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        void Add(int32 count = 1) { m_value.fetch_add(count, std::memory_order_relaxed); }
+        void Decrement();
+
+        /** Acquire: everything the counted jobs wrote is visible once this returns true, and the counter may be destroyed */
+        bool IsDone() const { return m_value.load(std::memory_order_acquire) == 0 && m_decrementingCount.load(std::memory_order_acquire) == 0; }
+        int32 GetValue() const { return m_value.load(std::memory_order_relaxed); }
+    };
+
+    /** Fixed pool of worker threads. Each worker owns a Chase-Lev deque, pushes and pops its own jobs LIFO and steals FIFO from the others when it runs dry.
+        The thread that calls Init() (main) owns a deque too and is worker 0. Any other thread submits through a shared injection queue.
+
+        @example
+            jpt::JobCounter counter;
+            for (Chunk& chunk : chunks)
+            {
+                jpt::JobSystem::GetInstance().Run([&chunk]() { chunk.Update(); }, &counter);
+            }
+            jpt::JobSystem::GetInstance().WaitFor(counter);   // Runs jobs on this thread until the chunks are done
+
+            jpt::JobSystem::GetInstance().ParallelFor(particles.Count(), 256, [&particles](size_t i) { particles[i].Integrate(); }); */
+    class JobSystem
+    {
+        JPT_DECLARE_SINGLETON(JobSystem);
+
+    public:
+        using JobFunction = MoveOnlyFunction<void()>;
+
+        static constexpr uint32 kInvalidWorkerIndex = 0xFFFFFFFF;
+        static constexpr uint32 kMaxJobsInFlight    = 64 * 1024;
+
+    private:
+        struct Job : JobCounter::Waiter
+        {
+            JobFunction function;
+            JobCounter* pCounter = nullptr;
+        };
+
+        using Deque = WorkStealingDeque<Job*>;
+
+        friend class JobWorker;
+
+    private:
+        DynamicArray<Thread*> m_workers;
+        Deque* m_pDeques = nullptr;                    /**< [0] main thread, [i] m_workers[i - 1] */
+        ThreadSafeQueue<Job*> m_injectionQueue;        /**< Submissions from non-worker threads, and overflow of full deques */
+        MemoryPool_ThreadCached* m_pJobPool = nullptr;
+
+        Mutex m_sleepMutex;
+        ConditionVariable m_sleepCondition;
+        std::atomic<int32> m_pendingCount  = 0;       /**< Jobs queued and not picked up yet */
+        std::atomic<int32> m_sleepingCount = 0;
+        std::atomic<bool> m_isRunning      = false;
+        uint32 m_dequesCount = 0;
+
+    public:
+        /** @param workersCount     Background threads to spawn. The calling thread is an extra worker on top of these */
+        void Init(uint32 workersCount);
+
+        /** Joins the workers. Jobs still queued are run on the calling thread first */
+        void Terminate();
+
+        /** Queues a job. Runs it right away on the calling thread if the job pool is exhausted
+            @param pCounter         Optional. Incremented now, decremented when the job has finished
+            @param pDependency      Optional. The job is parked on this counter, and only queued once it's done */
+        void Run(JobFunction&& function, JobCounter* pCounter = nullptr, const JobCounter* pDependency = nullptr);
+
+        /** Runs other jobs on the calling thread until counter is done, never blocks on a lock */
+        void WaitFor(const JobCounter& counter);
+
+        /** Splits [0, count) into jobs of batchSize indices, calls function(index) for each, and waits for all of them
+            @param function     void(size_t index) */
+        template<typename TFunction>
+        void ParallelFor(size_t count, size_t batchSize, TFunction&& function);
+
+        /** @return     Background threads count. Excludes the main thread */
+        uint32 GetWorkersCount() const { return m_dequesCount > 0 ? m_dequesCount - 1 : 0; }
+
+        /** @return     Index of the calling thread's deque, or kInvalidWorkerIndex if it's not a worker */
+        uint32 GetCurrentWorkerIndex() const;
+
+    private:
+        /** Pops, or steals, and runs one job
+            @return     false if no job was found */
+        bool TryExecuteOne(uint32 workerIndex);
+
+        Job* FindJob(uint32 workerIndex);
+        Job* StealJob(uint32 workerIndex);
+        void Execute(Job* pJob);
+        void Push(Job* pJob);
+
+        /** Parks pJob on dependency's waiters
+            @return     false if dependency is already done. The caller queues the job itself */
+        bool TryWaitOn(Job* pJob, const JobCounter& dependency);
+
+        /** Queues every job parked on counter. Called once it reaches zero */
+        void ReleaseWaiters(const JobCounter& counter);
+
+        /** Blocks a worker until a job is queued or the system terminates */
+        void Sleep();
+    };
+
+    template<typename TFunction>
+    void JobSystem::ParallelFor(size_t count, size_t batchSize, TFunction&& function)
+    {
+        JPT_ASSERT(batchSize > 0);
+
+        JobCounter counter;
+        for (size_t begin = 0; begin < count; begin += batchSize)
+        {
+            const size_t end = Min(begin + batchSize, count);
+            Run([&function, begin, end]()
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        function(i);
+                    }
+                }, &counter);
+        }
+
+        WaitFor(counter);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,409 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+export module jpt.LockFreeQueue_MPMC;
+
+import jpt.Math;
+import jpt.Optional;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+export namespace jpt
+{
+    /** Bounded lock-free multi-producer multi-consumer queue. Lock-free counterpart of ThreadSafeQueue.
+        Each cell carries a sequence number telling whose turn it is, so producers and consumers only contend on their own index with a CAS (Vyukov's bounded MPMC).
+
+        @note   Capacity is fixed and must be a power of two. Push() spins while full, TryPush() fails instead
+        @note   WaitPop() spins briefly, then sleeps on an atomic wait. Producers only pay for a notify when a consumer is actually sleeping
+
+        @example
+            jpt::LockFreeQueue_MPMC<Job*> queue(1024);
+            queue.Push(pJob);                                   // Any thread
+            if (jpt::Optional<Job*> job = queue.TryPop()) {}    // Any thread */
+    template<typename T>
+    class LockFreeQueue_MPMC
+    {
+    private:
+        static constexpr size_t kCacheLineSize = 64;
+        static constexpr uint32 kSpinCount     = 64;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) uint8 storage[sizeof(T)];
+
+            T* GetData() { return reinterpret_cast<T*>(storage); }
+        };
+
+    private:
+        alignas(kCacheLineSize) std::atomic<size_t> m_enqueuePos = 0;
+        alignas(kCacheLineSize) std::atomic<size_t> m_dequeuePos = 0;
+
+        alignas(kCacheLineSize) Cell* m_pCells = nullptr;
+        size_t m_mask = 0;
+
+        alignas(kCacheLineSize) std::atomic<uint32> m_wakeEpoch     = 0;
+        std::atomic<uint32>                         m_waitersCount  = 0;
+        std::atomic<bool>                           m_shouldTerminate = false;
+
+    public:
+        explicit LockFreeQueue_MPMC(size_t capacity = 1024);
+        ~LockFreeQueue_MPMC();
+
+        LockFreeQueue_MPMC(const LockFreeQueue_MPMC&) = delete;
+        LockFreeQueue_MPMC& operator=(const LockFreeQueue_MPMC&) = delete;
+
+        /** @return     false if the queue is full */
+        bool TryPush(const T& value);
+        bool TryPush(T&& value);
+
+        /** Spins until there is room */
+        void Push(const T& value);
+        void Push(T&& value);
+
+        Optional<T> TryPop();
+
+        /** Blocks until a value is available
+            @return     Empty Optional once Terminate() was called and the queue is drained */
+        Optional<T> WaitPop();
+
+        /** Claims up to count consecutive cells with a single CAS
+            @return     How many values from the front of pValues were pushed */
+        size_t TryPushBatch(const T* pValues, size_t count);
+
+        /** Claims up to maxCount consecutive values with a single CAS, moves them into pOutValues
+            @return     How many values were popped */
+        size_t TryPopBatch(T* pOutValues, size_t maxCount);
+
+        /** Wakes every thread blocked in WaitPop() */
+        void Terminate();
+
+        /** Snapshot, may be stale by the time it returns */
+        bool IsEmpty() const;
+        size_t Count() const;
+        size_t Capacity() const { return m_mask + 1; }
+
+    private:
+        template<typename TValue>
+        bool TryPushImpl(TValue&& value);
+
+        /** @param count    Values just published. Wakes one waiter per value at most */
+        void NotifyWaiters(size_t count);
+    };
+
+    template<typename T>
+    LockFreeQueue_MPMC<T>::LockFreeQueue_MPMC(size_t capacity)
+        : m_mask(capacity - 1)
+    {
+        JPT_ASSERT(capacity >= 2 && IsPowerOfTwo(capacity), "Capacity must be a power of two");
+
+        m_pCells = static_cast<Cell*>(::operator new(capacity * sizeof(Cell), std::align_val_t{ alignof(Cell) }));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&m_pCells[i].sequence) std::atomic<size_t>(i);
+        }
+    }
+
+    template<typename T>
+    LockFreeQueue_MPMC<T>::~LockFreeQueue_MPMC()
+    {
+        while (TryPop())
+        {
+        }
+
+        ::operator delete(m_pCells, std::align_val_t{ alignof(Cell) });
+    }
+
+    template<typename T>
+    bool LockFreeQueue_MPMC<T>::TryPush(const T& value)
+    {
+        return TryPushImpl(value);
+    }
+
+    template<typename T>
+    bool LockFreeQueue_MPMC<T>::TryPush(T&& value)
+    {
+        return TryPushImpl(Move(value));
+    }
+
+    template<typename T>
+    void LockFreeQueue_MPMC<T>::Push(const T& value)
+    {
+        while (!TryPushImpl(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    void LockFreeQueue_MPMC<T>::Push(T&& value)
+    {
+        while (!TryPushImpl(Move(value)))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    Optional<T> LockFreeQueue_MPMC<T>::TryPop()
+    {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* pCell = nullptr;
+
+        while (true)
+        {
+            pCell = &m_pCells[pos & m_mask];
+            const size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return {};
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Optional<T> result(Move(*pCell->GetData()));
+        pCell->GetData()->~T();
+
+        // Free for the producer one lap ahead
+        pCell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return result;
+    }
+
+    template<typename T>
+    Optional<T> LockFreeQueue_MPMC<T>::WaitPop()
+    {
+        while (true)
+        {
+            for (uint32 i = 0; i < kSpinCount; ++i)
+            {
+                if (Optional<T> value = TryPop())
+                {
+                    return value;
+                }
+            }
+
+            if (m_shouldTerminate.load(std::memory_order_acquire))
+            {
+                return TryPop();
+            }
+
+            // Register before the last check. Pairs with the fence in NotifyWaiters()
+            const uint32 epoch = m_wakeEpoch.load(std::memory_order_acquire);
+            m_waitersCount.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (IsEmpty() && !m_shouldTerminate.load(std::memory_order_seq_cst))
+            {
+                m_wakeEpoch.wait(epoch, std::memory_order_acquire);
+            }
+            m_waitersCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_MPMC<T>::TryPushBatch(const T* pValues, size_t count)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        size_t claimed = 0;
+
+        while (true)
+        {
+            // Count free cells from pos. Consumers can't take a free cell back, so they stay free until the CAS
+            claimed = 0;
+            while (claimed < count)
+            {
+                const size_t sequence = m_pCells[(pos + claimed) & m_mask].sequence.load(std::memory_order_acquire);
+                if (sequence != pos + claimed)
+                {
+                    break;
+                }
+                ++claimed;
+            }
+
+            if (claimed == 0)
+            {
+                const size_t sequence = m_pCells[pos & m_mask].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos) < 0)
+                {
+                    return 0;
+                }
+
+                // Another producer moved on
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            Cell& cell = m_pCells[(pos + i) & m_mask];
+            new (cell.storage) T(pValues[i]);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+
+        NotifyWaiters(claimed);
+        return claimed;
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_MPMC<T>::TryPopBatch(T* pOutValues, size_t maxCount)
+    {
+        if (maxCount == 0)
+        {
+            return 0;
+        }
+
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        size_t claimed = 0;
+
+        while (true)
+        {
+            // Count ready cells from pos. Only the claimer can consume them, so they stay ready until the CAS
+            claimed = 0;
+            while (claimed < maxCount)
+            {
+                const size_t sequence = m_pCells[(pos + claimed) & m_mask].sequence.load(std::memory_order_acquire);
+                if (sequence != pos + claimed + 1)
+                {
+                    break;
+                }
+                ++claimed;
+            }
+
+            if (claimed == 0)
+            {
+                const size_t sequence = m_pCells[pos & m_mask].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0)
+                {
+                    return 0;
+                }
+
+                // Another consumer moved on
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (m_dequeuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            Cell& cell = m_pCells[(pos + i) & m_mask];
+            pOutValues[i] = Move(*cell.GetData());
+            cell.GetData()->~T();
+            cell.sequence.store(pos + i + m_mask + 1, std::memory_order_release);
+        }
+
+        return claimed;
+    }
+
+    template<typename T>
+    void LockFreeQueue_MPMC<T>::Terminate()
+    {
+        m_shouldTerminate.store(true, std::memory_order_seq_cst);
+        m_wakeEpoch.fetch_add(1, std::memory_order_release);
+        m_wakeEpoch.notify_all();
+    }
+
+    template<typename T>
+    bool LockFreeQueue_MPMC<T>::IsEmpty() const
+    {
+        const size_t pos = m_dequeuePos.load(std::memory_order_acquire);
+        return m_pCells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_MPMC<T>::Count() const
+    {
+        const size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+        const size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    template<typename T>
+    template<typename TValue>
+    bool LockFreeQueue_MPMC<T>::TryPushImpl(TValue&& value)
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* pCell = nullptr;
+
+        while (true)
+        {
+            pCell = &m_pCells[pos & m_mask];
+            const size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (pCell->storage) T(Forward<TValue>(value));
+        pCell->sequence.store(pos + 1, std::memory_order_release);
+
+        NotifyWaiters(1);
+        return true;
+    }
+
+    template<typename T>
+    void LockFreeQueue_MPMC<T>::NotifyWaiters(size_t count)
+    {
+        // Either this sees the registered waiter, or the waiter's IsEmpty() sees the published value
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waitersCount.load(std::memory_order_relaxed) > 0)
+        {
+            m_wakeEpoch.fetch_add(1, std::memory_order_release);
+            if (count > 1)
+            {
+                m_wakeEpoch.notify_all();
+            }
+            else
+            {
+                m_wakeEpoch.notify_one();
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,323 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+export module jpt.LockFreeQueue_SPSC;
+
+import jpt.Math;
+import jpt.Optional;
+import jpt.TypeDefs;
+import jpt.Utilities;
+
+export namespace jpt
+{
+    /** Bounded lock-free single-producer single-consumer ring buffer. Lock-free counterpart of ThreadSafeQueue for one-to-one pipelines.
+        No CAS at all: the producer owns the tail, the consumer owns the head. Each side caches the other's index and only re-reads it when the cached one says full/empty
+
+        @note   Exactly one thread may push and exactly one thread may pop
+        @note   Capacity is fixed and must be a power of two. Push() spins while full, TryPush() fails instead
+
+        @example
+            jpt::LockFreeQueue_SPSC<LogEntry> queue(4096);
+            queue.Push(entry);                                          // Producer thread
+            while (jpt::Optional<LogEntry> entry = queue.WaitPop()) {}  // Consumer thread */
+    template<typename T>
+    class LockFreeQueue_SPSC
+    {
+    private:
+        static constexpr size_t kCacheLineSize = 64;
+        static constexpr uint32 kSpinCount     = 64;
+
+    private:
+        // Producer side
+        alignas(kCacheLineSize) std::atomic<size_t> m_tail = 0;
+        size_t m_cachedHead = 0;
+
+        // Consumer side
+        alignas(kCacheLineSize) std::atomic<size_t> m_head = 0;
+        size_t m_cachedTail = 0;
+
+        // Shared, read-only after construction
+        alignas(kCacheLineSize) T* m_pSlots = nullptr;
+        size_t m_mask = 0;
+
+        alignas(kCacheLineSize) std::atomic<uint32> m_wakeEpoch       = 0;
+        std::atomic<uint32>                         m_waitersCount    = 0;
+        std::atomic<bool>                           m_shouldTerminate = false;
+
+    public:
+        explicit LockFreeQueue_SPSC(size_t capacity = 1024);
+        ~LockFreeQueue_SPSC();
+
+        LockFreeQueue_SPSC(const LockFreeQueue_SPSC&) = delete;
+        LockFreeQueue_SPSC& operator=(const LockFreeQueue_SPSC&) = delete;
+
+        /** Producer thread only
+            @return     false if the queue is full */
+        bool TryPush(const T& value);
+        bool TryPush(T&& value);
+
+        /** Producer thread only. Spins until there is room */
+        void Push(const T& value);
+        void Push(T&& value);
+
+        /** Consumer thread only */
+        Optional<T> TryPop();
+
+        /** Consumer thread only. Blocks until a value is available
+            @return     Empty Optional once Terminate() was called and the queue is drained */
+        Optional<T> WaitPop();
+
+        /** Producer thread only. Publishes all pushed values with a single store
+            @return     How many values from the front of pValues were pushed */
+        size_t TryPushBatch(const T* pValues, size_t count);
+
+        /** Consumer thread only. Releases all popped slots with a single store
+            @return     How many values were moved into pOutValues */
+        size_t TryPopBatch(T* pOutValues, size_t maxCount);
+
+        /** Wakes the consumer if it's blocked in WaitPop() */
+        void Terminate();
+
+        /** Snapshot, may be stale by the time it returns */
+        bool IsEmpty() const;
+        size_t Count() const;
+        size_t Capacity() const { return m_mask + 1; }
+
+    private:
+        template<typename TValue>
+        bool TryPushImpl(TValue&& value);
+
+        /** @return     How many slots the producer may write from tail, refreshing the cached head if needed */
+        size_t GetFreeSlots(size_t tail, size_t wanted);
+
+        /** @return     How many values the consumer may read from head, refreshing the cached tail if needed */
+        size_t GetReadySlots(size_t head, size_t wanted);
+
+        void NotifyWaiter();
+    };
+
+    template<typename T>
+    LockFreeQueue_SPSC<T>::LockFreeQueue_SPSC(size_t capacity)
+        : m_mask(capacity - 1)
+    {
+        JPT_ASSERT(capacity >= 2 && IsPowerOfTwo(capacity), "Capacity must be a power of two");
+
+        m_pSlots = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t{ alignof(T) }));
+    }
+
+    template<typename T>
+    LockFreeQueue_SPSC<T>::~LockFreeQueue_SPSC()
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        for (size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+        {
+            m_pSlots[head & m_mask].~T();
+        }
+
+        ::operator delete(m_pSlots, std::align_val_t{ alignof(T) });
+    }
+
+    template<typename T>
+    bool LockFreeQueue_SPSC<T>::TryPush(const T& value)
+    {
+        return TryPushImpl(value);
+    }
+
+    template<typename T>
+    bool LockFreeQueue_SPSC<T>::TryPush(T&& value)
+    {
+        return TryPushImpl(Move(value));
+    }
+
+    template<typename T>
+    void LockFreeQueue_SPSC<T>::Push(const T& value)
+    {
+        while (!TryPushImpl(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    void LockFreeQueue_SPSC<T>::Push(T&& value)
+    {
+        while (!TryPushImpl(Move(value)))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    Optional<T> LockFreeQueue_SPSC<T>::TryPop()
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (GetReadySlots(head, 1) == 0)
+        {
+            return {};
+        }
+
+        T& slot = m_pSlots[head & m_mask];
+        Optional<T> result(Move(slot));
+        slot.~T();
+
+        m_head.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    template<typename T>
+    Optional<T> LockFreeQueue_SPSC<T>::WaitPop()
+    {
+        while (true)
+        {
+            for (uint32 i = 0; i < kSpinCount; ++i)
+            {
+                if (Optional<T> value = TryPop())
+                {
+                    return value;
+                }
+            }
+
+            if (m_shouldTerminate.load(std::memory_order_acquire))
+            {
+                return TryPop();
+            }
+
+            // Register before the last check. Pairs with the fence in NotifyWaiter()
+            const uint32 epoch = m_wakeEpoch.load(std::memory_order_acquire);
+            m_waitersCount.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (IsEmpty() && !m_shouldTerminate.load(std::memory_order_seq_cst))
+            {
+                m_wakeEpoch.wait(epoch, std::memory_order_acquire);
+            }
+            m_waitersCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_SPSC<T>::TryPushBatch(const T* pValues, size_t count)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t pushCount = GetFreeSlots(tail, count);
+        if (pushCount == 0)
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < pushCount; ++i)
+        {
+            new (&m_pSlots[(tail + i) & m_mask]) T(pValues[i]);
+        }
+
+        m_tail.store(tail + pushCount, std::memory_order_release);
+        NotifyWaiter();
+        return pushCount;
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_SPSC<T>::TryPopBatch(T* pOutValues, size_t maxCount)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t popCount = GetReadySlots(head, maxCount);
+        if (popCount == 0)
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < popCount; ++i)
+        {
+            T& slot = m_pSlots[(head + i) & m_mask];
+            pOutValues[i] = Move(slot);
+            slot.~T();
+        }
+
+        m_head.store(head + popCount, std::memory_order_release);
+        return popCount;
+    }
+
+    template<typename T>
+    void LockFreeQueue_SPSC<T>::Terminate()
+    {
+        m_shouldTerminate.store(true, std::memory_order_seq_cst);
+        m_wakeEpoch.fetch_add(1, std::memory_order_release);
+        m_wakeEpoch.notify_all();
+    }
+
+    template<typename T>
+    bool LockFreeQueue_SPSC<T>::IsEmpty() const
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_SPSC<T>::Count() const
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        return tail - head;
+    }
+
+    template<typename T>
+    template<typename TValue>
+    bool LockFreeQueue_SPSC<T>::TryPushImpl(TValue&& value)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (GetFreeSlots(tail, 1) == 0)
+        {
+            return false;
+        }
+
+        new (&m_pSlots[tail & m_mask]) T(Forward<TValue>(value));
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        NotifyWaiter();
+        return true;
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_SPSC<T>::GetFreeSlots(size_t tail, size_t wanted)
+    {
+        const size_t capacity = m_mask + 1;
+
+        size_t freeSlots = capacity - (tail - m_cachedHead);
+        if (freeSlots < wanted)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            freeSlots = capacity - (tail - m_cachedHead);
+        }
+
+        return Min(freeSlots, wanted);
+    }
+
+    template<typename T>
+    size_t LockFreeQueue_SPSC<T>::GetReadySlots(size_t head, size_t wanted)
+    {
+        size_t readySlots = m_cachedTail - head;
+        if (readySlots < wanted)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            readySlots = m_cachedTail - head;
+        }
+
+        return Min(readySlots, wanted);
+    }
+
+    template<typename T>
+    void LockFreeQueue_SPSC<T>::NotifyWaiter()
+    {
+        // Either this sees the registered waiter, or the waiter's IsEmpty() sees the published value
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waitersCount.load(std::memory_order_relaxed) > 0)
+        {
+            m_wakeEpoch.fetch_add(1, std::memory_order_release);
+            m_wakeEpoch.notify_one();
+        }
+    }
+}
\ No newline at end of file
@@ -18,11 +18,7 @@ namespace jpt
     Thread::~Thread() noexcept
     {
         Stop();
-
-        if (m_thread && m_thread->joinable())
-        {
-            m_thread->join();
-        }
+        Join();
     }
 
     Thread::Thread(Thread&& other) noexcept
@@ -75,6 +71,14 @@ namespace jpt
         m_isActive = false;
     }
 
+    void Thread::Join()
+    {
+        if (m_thread && m_thread->joinable())
+        {
+            m_thread->join();
+        }
+    }
+
     const String& Thread::GetName() const noexcept
     {
         return m_name;
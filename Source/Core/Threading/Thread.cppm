@@ -58,6 +58,10 @@ export namespace jpt
         void Start();
         void Stop();
 
+        /** Blocks until the thread has exited. Call Stop() first unless the thread stops itself
+            @note   Derived classes should Join() before their own members are destroyed, the thread may still be inside Update() */
+        void Join();
+
         const String& GetName() const noexcept;
 
     protected:
@@ -0,0 +1,128 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <atomic>
+
+export module jpt.WorkStealingDeque;
+
+import jpt.Math;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Chase-Lev work stealing deque with a fixed capacity.
+        The owner thread pushes and pops at the bottom (LIFO, cache friendly), any other thread steals from the top (FIFO, oldest work first).
+        Only Pop() and Steal() racing for the last element touch the same atomic with a CAS
+
+        @param T            Trivially copyable, pointer sized. Typically a pointer to the work item
+        @param kCapacity    Power of two. Push() fails when full, the caller decides where the overflow goes */
+    template<typename T, int64 kCapacity = 4096>
+    class WorkStealingDeque
+    {
+        static_assert(IsPowerOfTwo(kCapacity));
+
+    private:
+        static constexpr int64 kMask = kCapacity - 1;
+
+    private:
+        alignas(64) std::atomic<int64> m_top    = 0;   /**< Next index to steal. Written by thieves and the owner's last-element pop */
+        alignas(64) std::atomic<int64> m_bottom = 0;   /**< Next index to push. Written by the owner only */
+        alignas(64) std::atomic<T> m_buffer[kCapacity];
+
+    public:
+        /** Owner thread only
+            @return     false if the deque is full */
+        bool Push(T item);
+
+        /** Owner thread only
+            @return     false if the deque is empty, or a thief won the last element */
+        bool Pop(T& outItem);
+
+        /** Any thread
+            @return     false if the deque is empty, or another thread won the race */
+        bool Steal(T& outItem);
+
+        /** Approximation when called from another thread */
+        bool IsEmpty() const;
+    };
+
+    template<typename T, int64 kCapacity>
+    bool WorkStealingDeque<T, kCapacity>::Push(T item)
+    {
+        const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64 top    = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top >= kCapacity)
+        {
+            return false;
+        }
+
+        m_buffer[bottom & kMask].store(item, std::memory_order_relaxed);
+
+        // Item must be visible before a thief can see the new bottom
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    template<typename T, int64 kCapacity>
+    bool WorkStealingDeque<T, kCapacity>::Pop(T& outItem)
+    {
+        // Reserve the bottom element first, then look at top. The full fence orders the two against Steal()'s loads
+        const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            // Was empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        outItem = m_buffer[bottom & kMask].load(std::memory_order_relaxed);
+
+        if (top != bottom)
+        {
+            // More than one element left, no thief can reach this one
+            return true;
+        }
+
+        // Last element. Race thieves for it through top
+        const bool isWon = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return isWon;
+    }
+
+    template<typename T, int64 kCapacity>
+    bool WorkStealingDeque<T, kCapacity>::Steal(T& outItem)
+    {
+        int64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        // Read before the CAS. Once top moves, the owner may overwrite the slot
+        const T item = m_buffer[top & kMask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        outItem = item;
+        return true;
+    }
+
+    template<typename T, int64 kCapacity>
+    bool WorkStealingDeque<T, kCapacity>::IsEmpty() const
+    {
+        return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
@@ -4,39 +4,586 @@
 
 #include "Core/Validation/Assert.h"
 
+#include <bit>
+#include <type_traits>
+
 import jpt.TypeDefs;
 import jpt.Concepts;
 import jpt.Constants;
 import jpt.String;
 import jpt.StringHelpers;
+import jpt.StringView;
 import jpt.Hash;
 import jpt.HashMap;
 import jpt.DynamicArray;
 
-/** Has shared enum data across all instances and public */
-template<jpt::Integral TInt>
-struct EnumData
+namespace jpt_private
 {
-    TInt min = jpt::kMax<TInt>;    /**< The min value of this enum */
-    TInt max = jpt::kMin<TInt>;    /**< The max value of this enum */
-    jpt::HashMap<TInt, jpt::String> names;    /**< Key by Enum Value, Value is the value's associated string name */
-};
+    /** Not constexpr on purpose: reaching it while parsing a JPT_ENUM stops the compilation with the message */
+    inline void EnumError(const char*) {}
+
+    /** One enumerator. Structured bindings give [value, name] */
+    template<jpt::Integral TInt>
+    struct EnumEntry
+    {
+        TInt value = 0;
+        jpt::StringView name;
+    };
+
+    constexpr bool IsEnumSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    constexpr bool IsEnumNameChar(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    /** @return     Enumerators in the stringized values of a JPT_ENUM. A trailing comma doesn't count */
+    constexpr size_t CountEnumerators(const char* pSource)
+    {
+        size_t count = 0;
+        int32 depth = 0;
+        bool hasName = false;
+
+        for (const char* pChar = pSource; ; ++pChar)
+        {
+            const char c = *pChar;
+            if (c == '\0' || (c == ',' && depth == 0))
+            {
+                count += hasName;
+                hasName = false;
+
+                if (c == '\0')
+                {
+                    return count;
+                }
+                continue;
+            }
+
+            depth += (c == '(') - (c == ')');
+            hasName |= !IsEnumSpace(c);
+        }
+    }
+
+    /** splitmix64 finalizer. The lookup hashes are cheap so hundreds of enums build at compile time */
+    constexpr uint64 MixEnumHash(uint64 hash)
+    {
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+        return hash ^ (hash >> 31);
+    }
+
+    /** FNV-1a, mixed */
+    constexpr uint64 HashEnumName(const char* pName, size_t count)
+    {
+        uint64 hash = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < count; ++i)
+        {
+            hash = (hash ^ static_cast<uint8>(pName[i])) * 0x100000001B3ull;
+        }
+        return MixEnumHash(hash);
+    }
+
+    constexpr uint64 HashEnumValue(uint64 value)
+    {
+        return MixEnumHash(value);
+    }
+
+    /** Perfect hash from kCount keys to their index, built at compile time (hash and displace).
+        Keys are split in buckets by hash, and each bucket searches for a seed sending all its keys to free slots.
+        Find is one seed read and one slot read. Any hash gives an index, the caller compares the key */
+    template<size_t kCount>
+    class EnumLookup
+    {
+    public:
+        static constexpr size_t kSlotsCount   = std::bit_ceil(kCount * 2);
+        static constexpr size_t kBucketsCount = kSlotsCount >= 8 ? kSlotsCount / 4 : 1;
+
+    private:
+        uint16 m_seeds[kBucketsCount] = {};
+        uint16 m_slots[kSlotsCount]   = {};    /**< Key index + 1. 0 is empty */
+
+    public:
+        /** @param pHashes  Hash of each key
+            @param pIsKeys  false skips the key. Duplicate values can't have distinct slots */
+        constexpr void Build(const uint64* pHashes, const bool* pIsKeys);
+
+        /** @return     Index of the only key that may have this hash. kInvalidIndex if none */
+        constexpr size_t Find(uint64 hash) const
+        {
+            const uint16 slot = m_slots[GetSlot(hash, m_seeds[hash & (kBucketsCount - 1)])];
+            return slot != 0 ? slot - 1 : jpt::kInvalidIndex;
+        }
+
+    private:
+        static constexpr size_t GetSlot(uint64 hash, uint64 seed)
+        {
+            return MixEnumHash(hash ^ (seed * 0x9E3779B97F4A7C15ull)) & (kSlotsCount - 1);
+        }
+    };
+
+    template<size_t kCount>
+    constexpr void EnumLookup<kCount>::Build(const uint64* pHashes, const bool* pIsKeys)
+    {
+        // Group the keys by bucket
+        size_t bucketOffsets[kBucketsCount + 1] = {};
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            if (pIsKeys[i])
+            {
+                ++bucketOffsets[(pHashes[i] & (kBucketsCount - 1)) + 1];
+            }
+        }
+
+        size_t maxBucketSize = 0;
+        for (size_t bucket = 0; bucket < kBucketsCount; ++bucket)
+        {
+            maxBucketSize = bucketOffsets[bucket + 1] > maxBucketSize ? bucketOffsets[bucket + 1] : maxBucketSize;
+            bucketOffsets[bucket + 1] += bucketOffsets[bucket];
+        }
+
+        size_t bucketKeys[kCount] = {};
+        size_t bucketFills[kBucketsCount] = {};
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            if (pIsKeys[i])
+            {
+                const size_t bucket = pHashes[i] & (kBucketsCount - 1);
+                bucketKeys[bucketOffsets[bucket] + bucketFills[bucket]++] = i;
+            }
+        }
+
+        // Biggest buckets first, while most slots are free
+        for (size_t bucketSize = maxBucketSize; bucketSize > 0; --bucketSize)
+        {
+            for (size_t bucket = 0; bucket < kBucketsCount; ++bucket)
+            {
+                const size_t begin = bucketOffsets[bucket];
+                if (bucketOffsets[bucket + 1] - begin != bucketSize)
+                {
+                    continue;
+                }
+
+                bool isPlaced = false;
+                for (uint64 seed = 0; seed <= jpt::kMax<uint16> && !isPlaced; ++seed)
+                {
+                    size_t placedCount = 0;
+                    for (; placedCount < bucketSize; ++placedCount)
+                    {
+                        const size_t key = bucketKeys[begin + placedCount];
+                        uint16& slot = m_slots[GetSlot(pHashes[key], seed)];
+                        if (slot != 0)
+                        {
+                            break;
+                        }
+                        slot = static_cast<uint16>(key + 1);
+                    }
+
+                    isPlaced = placedCount == bucketSize;
+                    if (isPlaced)
+                    {
+                        m_seeds[bucket] = static_cast<uint16>(seed);
+                        continue;
+                    }
+
+                    // Collided, free this attempt's slots
+                    for (size_t i = 0; i < placedCount; ++i)
+                    {
+                        m_slots[GetSlot(pHashes[bucketKeys[begin + i]], seed)] = 0;
+                    }
+                }
+
+                if (!isPlaced)
+                {
+                    EnumError("No seed places every key of the bucket");
+                }
+            }
+        }
+    }
+
+    /** Names and values of a JPT_ENUM, parsed at compile time from its stringized values.
+        Value expressions support integer literals, earlier enumerators, parentheses and the C integer operators
+        @param kCount       Enumerators count
+        @param kSourceSize  Size of the stringized values. Bounds the names */
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    class EnumSource
+    {
+        static_assert(kCount > 0 && kCount < jpt::kMax<uint16>, "Unsupported enumerators count");
+        static_assert(kSourceSize < jpt::kMax<uint16>, "Enum values are too long");
+
+    public:
+        class Iterator
+        {
+        private:
+            const EnumSource* m_pData = nullptr;
+            size_t m_index = 0;
+
+        public:
+            constexpr Iterator(const EnumSource* pData, size_t index) : m_pData(pData), m_index(index) {}
+
+            constexpr EnumEntry<TInt> operator*() const { return { m_pData->GetValue(m_index), m_pData->GetName(m_index) }; }
+            constexpr Iterator& operator++() { ++m_index; return *this; }
+            constexpr bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        };
+
+    public:
+        TInt min = jpt::kMax<TInt>;    /**< The min value of this enum */
+        TInt max = jpt::kMin<TInt>;    /**< The max value of this enum */
+        bool isSequential = true;      /**< Values are min, min + 1, ... in declaration order. Finding a value is a subtraction */
+
+    private:
+        TInt m_values[kCount] = {};                 /**< In declaration order */
+        uint16 m_nameOffsets[kCount + 1] = {};      /**< Start of each name in m_names, and the end */
+        char m_names[kSourceSize] = {};             /**< Every name, null-terminated */
+
+    public:
+        constexpr EnumSource(const char* pSource);
+
+        constexpr size_t Count() const { return kCount; }
+        constexpr TInt GetValue(size_t index) const { return m_values[index]; }
+        constexpr jpt::StringView GetName(size_t index) const
+        {
+            return jpt::StringView(m_names + m_nameOffsets[index], m_nameOffsets[index + 1] - m_nameOffsets[index] - 1);
+        }
+
+        constexpr Iterator begin() const { return Iterator(this, 0); }
+        constexpr Iterator end()   const { return Iterator(this, kCount); }
+
+    private:
+        /** Precedence climbing over | ^ & << >> + - * / %, tightest last.
+            Evaluated in uint64, which wraps like int64 for the rest, but / % >> of a signed TInt need the signed operation */
+        constexpr uint64 ParseBinary(const char*& pChar, size_t parsedCount, int32 minPrecedence) const;
+        constexpr uint64 ParseUnary(const char*& pChar, size_t parsedCount) const;
+        constexpr uint64 ParseInteger(const char*& pChar) const;
+    };
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr EnumSource<TInt, kCount, kSourceSize>::EnumSource(const char* pSource)
+    {
+        const char* pChar = pSource;
+        size_t nameOffset = 0;
+
+        for (size_t index = 0; index < kCount; ++index)
+        {
+            while (IsEnumSpace(*pChar))
+            {
+                ++pChar;
+            }
+
+            // Name
+            const char* pName = pChar;
+            while (IsEnumNameChar(*pChar))
+            {
+                m_names[nameOffset++] = *pChar++;
+            }
+            if (pChar == pName)
+            {
+                EnumError("Expected an enumerator name");
+            }
+            m_names[nameOffset++] = '\0';
+            m_nameOffsets[index + 1] = static_cast<uint16>(nameOffset);
+
+            while (IsEnumSpace(*pChar))
+            {
+                ++pChar;
+            }
 
-/** Generate the shared enum data 
-    @param pSource        A string Has all the enum values, separated by ',' accepts value assignment too */
-template<jpt::Integral TInt>
-EnumData<TInt> GenerateData(const char* pSource);
+            // Value. Assigned, or the previous one + 1 like the compiler does
+            uint64 value = index > 0 ? static_cast<uint64>(m_values[index - 1]) + 1 : 0;
+            if (*pChar == '=')
+            {
+                ++pChar;
+                value = ParseBinary(pChar, index, 1);
+            }
+
+            if (*pChar == ',')
+            {
+                ++pChar;
+            }
+            else if (*pChar != '\0')
+            {
+                EnumError("Unsupported value expression");
+            }
+
+            m_values[index] = static_cast<TInt>(value);
+            min = m_values[index] < min ? m_values[index] : min;
+            max = m_values[index] > max ? m_values[index] : max;
+            isSequential &= index == 0 || m_values[index] == static_cast<TInt>(m_values[index - 1] + 1);
+        }
+    }
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr uint64 EnumSource<TInt, kCount, kSourceSize>::ParseBinary(const char*& pChar, size_t parsedCount, int32 minPrecedence) const
+    {
+        uint64 lhs = ParseUnary(pChar, parsedCount);
+
+        while (true)
+        {
+            while (IsEnumSpace(*pChar))
+            {
+                ++pChar;
+            }
+
+            const char op = *pChar;
+            const bool isShift = (op == '<' || op == '>') && pChar[1] == op;
+            int32 precedence = 0;
+            switch (op)
+            {
+                case '|': precedence = 1; break;
+                case '^': precedence = 2; break;
+                case '&': precedence = 3; break;
+                case '<':
+                case '>': precedence = isShift ? 4 : 0; break;
+                case '+':
+                case '-': precedence = 5; break;
+                case '*':
+                case '/':
+                case '%': precedence = 6; break;
+                default: break;
+            }
+
+            if (precedence == 0 || precedence < minPrecedence)
+            {
+                return lhs;
+            }
+
+            pChar += isShift ? 2 : 1;
+            const uint64 rhs = ParseBinary(pChar, parsedCount, precedence + 1);
+
+            if ((op == '/' || op == '%') && rhs == 0)
+            {
+                EnumError("Division by zero");
+            }
+
+            if constexpr (std::is_signed_v<TInt>)
+            {
+                const int64 signedLhs = static_cast<int64>(lhs);
+                const int64 signedRhs = static_cast<int64>(rhs);
+                switch (op)
+                {
+                    case '>': lhs = static_cast<uint64>(signedLhs >> signedRhs); continue;
+                    case '/': lhs = static_cast<uint64>(signedLhs / signedRhs); continue;
+                    case '%': lhs = static_cast<uint64>(signedLhs % signedRhs); continue;
+                    default: break;
+                }
+            }
+
+            switch (op)
+            {
+                case '|': lhs |= rhs; break;
+                case '^': lhs ^= rhs; break;
+                case '&': lhs &= rhs; break;
+                case '<': lhs <<= rhs; break;
+                case '>': lhs >>= rhs; break;
+                case '+': lhs += rhs; break;
+                case '-': lhs -= rhs; break;
+                case '*': lhs *= rhs; break;
+                case '/': lhs /= rhs; break;
+                case '%': lhs %= rhs; break;
+                default: break;
+            }
+        }
+    }
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr uint64 EnumSource<TInt, kCount, kSourceSize>::ParseUnary(const char*& pChar, size_t parsedCount) const
+    {
+        while (IsEnumSpace(*pChar))
+        {
+            ++pChar;
+        }
+
+        switch (*pChar)
+        {
+            case '~': ++pChar; return ~ParseUnary(pChar, parsedCount);
+            case '-': ++pChar; return 0 - ParseUnary(pChar, parsedCount);
+            case '+': ++pChar; return ParseUnary(pChar, parsedCount);
+            case '(':
+            {
+                ++pChar;
+                const uint64 value = ParseBinary(pChar, parsedCount, 1);
+
+                while (IsEnumSpace(*pChar))
+                {
+                    ++pChar;
+                }
+                if (*pChar != ')')
+                {
+                    EnumError("Expected ')'");
+                }
+                ++pChar;
+                return value;
+            }
+            default: break;
+        }
+
+        if (*pChar >= '0' && *pChar <= '9')
+        {
+            return ParseInteger(pChar);
+        }
+
+        // Earlier enumerator. Qualified names use their last part
+        const char* pName = pChar;
+        while (IsEnumNameChar(*pChar) || (pChar[0] == ':' && pChar[1] == ':'))
+        {
+            if (*pChar == ':')
+            {
+                pName = pChar + 2;
+                ++pChar;
+            }
+            ++pChar;
+        }
+
+        const jpt::StringView name(pName, static_cast<size_t>(pChar - pName));
+        for (size_t i = 0; i < parsedCount; ++i)
+        {
+            if (GetName(i) == name)
+            {
+                return static_cast<uint64>(m_values[i]);
+            }
+        }
+
+        EnumError("Unknown name in value expression");
+        return 0;
+    }
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr uint64 EnumSource<TInt, kCount, kSourceSize>::ParseInteger(const char*& pChar) const
+    {
+        uint64 base = 10;
+        if (pChar[0] == '0' && (pChar[1] == 'x' || pChar[1] == 'X'))
+        {
+            base = 16;
+            pChar += 2;
+        }
+        else if (pChar[0] == '0' && (pChar[1] == 'b' || pChar[1] == 'B'))
+        {
+            base = 2;
+            pChar += 2;
+        }
+        else if (pChar[0] == '0')
+        {
+            base = 8;
+        }
+
+        uint64 value = 0;
+        for (;; ++pChar)
+        {
+            const char c = *pChar;
+            uint64 digit = base;
+
+            if (c >= '0' && c <= '9')      { digit = c - '0'; }
+            else if (c >= 'a' && c <= 'f') { digit = c - 'a' + 10; }
+            else if (c >= 'A' && c <= 'F') { digit = c - 'A' + 10; }
+            else if (c == '\'')            { continue; }
+
+            if (digit >= base)
+            {
+                break;
+            }
+            value = value * base + digit;
+        }
+
+        // Suffixes
+        while (*pChar == 'u' || *pChar == 'U' || *pChar == 'l' || *pChar == 'L')
+        {
+            ++pChar;
+        }
+
+        return value;
+    }
+
+    /** EnumSource with its O(1) lookups. Built in its own constant evaluation, apart from the parsing */
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    class EnumData : public EnumSource<TInt, kCount, kSourceSize>
+    {
+    private:
+        using Super = EnumSource<TInt, kCount, kSourceSize>;
+
+    public:
+        using Super::min;
+        using Super::max;
+        using Super::isSequential;
+        using Super::GetValue;
+        using Super::GetName;
+
+    private:
+        EnumLookup<kCount> m_nameLookup;
+        EnumLookup<kCount> m_valueLookup;    /**< Unused if sequential */
+
+    public:
+        constexpr EnumData(const EnumSource<TInt, kCount, kSourceSize>& source);
+
+        /** @return     Index of the first enumerator with value. kInvalidIndex if none */
+        constexpr size_t Find(TInt value) const;
+
+        /** @return     Index of the enumerator named name. kInvalidIndex if none */
+        constexpr size_t Find(jpt::StringView name) const;
+    };
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr EnumData<TInt, kCount, kSourceSize>::EnumData(const EnumSource<TInt, kCount, kSourceSize>& source)
+        : Super(source)
+    {
+        uint64 hashes[kCount] = {};
+        bool isKeys[kCount] = {};
+
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            const jpt::StringView name = GetName(i);
+            hashes[i] = HashEnumName(name.ConstBuffer(), name.Count());
+            isKeys[i] = true;
+        }
+        m_nameLookup.Build(hashes, isKeys);
+
+        if (!isSequential)
+        {
+            for (size_t i = 0; i < kCount; ++i)
+            {
+                hashes[i] = HashEnumValue(static_cast<uint64>(GetValue(i)));
+
+                // Aliases find the first enumerator of their value
+                for (size_t j = 0; j < i && isKeys[i]; ++j)
+                {
+                    isKeys[i] = GetValue(j) != GetValue(i);
+                }
+            }
+            m_valueLookup.Build(hashes, isKeys);
+        }
+    }
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr size_t EnumData<TInt, kCount, kSourceSize>::Find(TInt value) const
+    {
+        if (isSequential)
+        {
+            return value >= min && value <= max ? static_cast<size_t>(value - min) : jpt::kInvalidIndex;
+        }
+
+        const size_t index = m_valueLookup.Find(HashEnumValue(static_cast<uint64>(value)));
+        return index != jpt::kInvalidIndex && GetValue(index) == value ? index : jpt::kInvalidIndex;
+    }
+
+    template<jpt::Integral TInt, size_t kCount, size_t kSourceSize>
+    constexpr size_t EnumData<TInt, kCount, kSourceSize>::Find(jpt::StringView name) const
+    {
+        const size_t index = m_nameLookup.Find(HashEnumName(name.ConstBuffer(), name.Count()));
+        return index != jpt::kInvalidIndex && GetName(index) == name ? index : jpt::kInvalidIndex;
+    }
+}
 
 /** Enum wrapper supports the followings:
-    - Static global API for shared EnumData
+    - Static global API, parsed at compile time. Name and value lookups are O(1)
     - Comparing with numeric and string
     - Conversion to numeric and string
     - Common Math operators
-    - Iteration through all values. Range-based is also supported
+    - Iteration through all values in declaration order. Range-based is also supported
 
     @param EnumName        The name of the enum. Like Fruit, Weapon, etc
     @param TSize        The size of the enum. uint8, uint16, uint32, uint64. 
-                        Make sure you choose the right size for optimization and Explicit template instantiations at the bottom Enum.cpp
+                        Make sure you choose the right size for optimization
     @examples:     
         // Local Enum for current file
         JPT_ENUM_UINT8(Local, 
@@ -75,7 +622,10 @@ public:
     };                                                                                                                       \
                                                                                                                              \
 private:                                                                                                                     \
-    inline static const EnumData<TSize> s_data = GenerateData<TSize>(#__VA_ARGS__);                                          \
+    static constexpr jpt_private::EnumSource<TSize, jpt_private::CountEnumerators(#__VA_ARGS__), sizeof(#__VA_ARGS__)>       \
+        s_source{ #__VA_ARGS__ };                           /**< Parsed at compile time */                                   \
+    static constexpr jpt_private::EnumData<TSize, jpt_private::CountEnumerators(#__VA_ARGS__), sizeof(#__VA_ARGS__)>         \
+        s_data{ s_source };                                 /**< Indexed at compile time, in a separate evaluation */        \
     TSize m_value = 0;    /**< The actual enum value of one instance */                                                      \
                                                                                                                              \
 public:                                                                                                                      \
@@ -92,28 +642,24 @@ public:
     }                                                                                                                        \
     constexpr static TSize Count()                                                                                           \
     {                                                                                                                        \
-        return static_cast<TSize>(s_data.names.Count());                                                                     \
+        return static_cast<TSize>(s_data.Count());                                                                           \
     }                                                                                                                        \
-    constexpr static const jpt::HashMap<TSize, jpt::String>& Names()                                                         \
+    constexpr static bool IsValid(TSize value)                                                                               \
     {                                                                                                                        \
-        return s_data.names;                                                                                                 \
+        return s_data.Find(value) != jpt::kInvalidIndex;                                                                     \
     }                                                                                                                        \
-    constexpr static const jpt::String& Name(TSize index)                                                                    \
+    constexpr static jpt::StringView Name(TSize value)                                                                       \
     {                                                                                                                        \
-        JPT_ASSERT(s_data.names.Has(index), "Couldn't find associated enum name with given index \"%d\"", index);            \
-        return s_data.names[index];                                                                                          \
+        const size_t index = s_data.Find(value);                                                                             \
+        JPT_ASSERT(index != jpt::kInvalidIndex, "Couldn't find associated enum name with given value \"%d\"", value);        \
+        return index != jpt::kInvalidIndex ? s_data.GetName(index) : jpt::StringView();                                      \
     }                                                                                                                        \
-    constexpr static TSize FromName(const jpt::String& name)                                                                 \
+    constexpr static TSize FromName(jpt::StringView name)                                                                    \
     {                                                                                                                        \
-        for (const auto& [key, value] : s_data.names)                                                                        \
-        {                                                                                                                    \
-            if (value == name)                                                                                               \
-            {                                                                                                                \
-                return key;                                                                                                  \
-            }                                                                                                                \
-        }                                                                                                                    \
-        JPT_ASSERT(false, "Couldn't find associated enum value with given name \"%s\"", name.ConstBuffer());                 \
-        return 0;                                                                                                            \
+        const size_t index = s_data.Find(name);                                                                              \
+        JPT_ASSERT(index != jpt::kInvalidIndex, "Couldn't find associated enum value with given name \"%.*s\"",              \
+                   static_cast<int32>(name.Count()), name.ConstBuffer());                                                    \
+        return index != jpt::kInvalidIndex ? s_data.GetValue(index) : 0;                                                     \
     }                                                                                                                        \
                                                                                                                              \
 public:                                                                                                                      \
@@ -148,12 +694,12 @@ public:
                                                                                                                              \
     /** String ctor & operator= */                                                                                           \
                                                                                                                              \
-    constexpr EnumName(const jpt::String& name)                                                                              \
+    constexpr EnumName(jpt::StringView name)                                                                                 \
     {                                                                                                                        \
         m_value = FromName(name);                                                                                            \
     }                                                                                                                        \
                                                                                                                              \
-    constexpr EnumName& operator=(const jpt::String& name)                                                                   \
+    constexpr EnumName& operator=(jpt::StringView name)                                                                      \
     {                                                                                                                        \
         m_value = FromName(name);                                                                                            \
         return *this;                                                                                                        \
@@ -168,14 +714,14 @@ public:
     constexpr EnumName& operator+=(TInt offset)                                                                              \
     {                                                                                                                        \
         m_value += static_cast<TSize>(offset);                                                                               \
-        JPT_ASSERT(s_data.names.Has(m_value));                                                                               \
+        JPT_ASSERT(IsValid(m_value));                                                                                        \
         return *this;                                                                                                        \
     }                                                                                                                        \
     template<jpt::Integral TInt = TSize>                                                                                     \
     constexpr EnumName& operator-=(TInt offset)                                                                              \
     {                                                                                                                        \
         m_value -= static_cast<TSize>(offset);                                                                               \
-        JPT_ASSERT(s_data.names.Has(m_value));                                                                               \
+        JPT_ASSERT(IsValid(m_value));                                                                                        \
         return *this;                                                                                                        \
     }                                                                                                                        \
                                                                                                                              \
@@ -226,16 +772,16 @@ public:
                                                                                                                              \
     /** Iteration */                                                                                                         \
     /** Supports range-based, iterated, and numeric if items are linear and contigous */                                     \
-    constexpr auto begin()  const { return s_data.names.begin();  }                                                          \
-    constexpr auto end()    const { return s_data.names.end();    }                                                          \
-    constexpr auto cbegin() const { return s_data.names.cbegin(); }                                                          \
-    constexpr auto cend()   const { return s_data.names.cend();   }                                                          \
+    constexpr auto begin()  const { return s_data.begin(); }                                                                 \
+    constexpr auto end()    const { return s_data.end();   }                                                                 \
+    constexpr auto cbegin() const { return s_data.begin(); }                                                                 \
+    constexpr auto cend()   const { return s_data.end();   }                                                                 \
                                                                                                                              \
     /** Comparison */                                                                                                        \
     /** == */                                                                                                                \
     template<jpt::Integral TInt = TSize>                                                                                     \
     constexpr bool operator==(TInt value)            const { return m_value == static_cast<TSize>(value); }                  \
-    constexpr bool operator==(const char* str)       const { return s_data.names[m_value] == str; }                          \
+    constexpr bool operator==(const char* str)       const { return IsValid(m_value) && Name(m_value) == str; }              \
     constexpr bool operator==(const EnumName& other) const { return m_value == other.m_value; }                              \
                                                                                                                              \
     /** Other Enum class instance */                                                                                         \
@@ -263,9 +809,10 @@ struct jpt::Hasher<EnumName>                                  \
 #define JPT_ENUM_TO_STRING(EnumName)                          \
 namespace jpt                                                 \
 {                                                             \
-    const String& ToString(const EnumName& e)                 \
+    String ToString(const EnumName& e)                        \
     {                                                         \
-        return EnumName::Name(e.Value());                     \
+        const StringView name = EnumName::Name(e.Value());    \
+        return String(name.ConstBuffer(), name.Count());      \
     }                                                         \
 }
 
@@ -7,77 +7,79 @@ module;
 
 module jpt.CSV;
 
+import jpt.StringTokenizer;
+import jpt.StringView;
 import jpt.TypeDefs;
+import jpt.Utilities;
 
 import jpt.FileIO;
+import jpt.MappedFile;
 
 namespace jpt
 {
     using namespace File;
 
-    Optional<CSVData> ReadCSV(const Path& path)
+    /** Adds the cells of a single line to row. Quoted cells may contain commas */
+    static void locParseRow(StringView line, CSVData::Row& row)
     {
-        Optional<String> csvContent = ReadTextFile(path);
-        JPT_ASSERT(csvContent, "Failed to read CSV file as text at %ls", path.ConstBuffer());
-
-        const String& content = csvContent.Value();
-        if (content.IsEmpty())
+        if (line.IsEmpty())
         {
-            return {};
+            return;
         }
 
-        CSVData csvData;
-
-        // Get each line
-        DynamicArray<String> rows = content.Split('\n');
-        csvData.Reserve(rows.Count());
-
-        for (String& row : rows)
+        Index cellStart = 0;
+        while (true)
         {
-            // For each line, parse each cell and add to current row. 
-            CSVData::Row currentRow;
-            while (true)
+            if (cellStart < line.Count() && line[cellStart] == '\"')
             {
-                // Break if the row is empty
-                if (row.IsEmpty())
-                {
-                    break;
-                }
+                const Index quoteEndIndex = line.Find('\"', cellStart + 1);
+                JPT_ASSERT(quoteEndIndex != kInvalidIndex, "Failed to find closing quote in CSV row");
 
-                const Index quoteStartIndex = row.Find('\"');
+                row.EmplaceBack(line.ConstBuffer() + cellStart + 1, quoteEndIndex - cellStart - 1);
 
-                // If there's no quote, split this row by comma and break
-                if (quoteStartIndex == kInvalidIndex)
+                // Skip the closing quote and the comma
+                cellStart = quoteEndIndex + 2;
+                if (cellStart > line.Count())
                 {
-                    currentRow += row.Split(',');
                     break;
                 }
+                continue;
+            }
 
-                // If there's a quote
-                const Index commaIndex = row.Find(',');
-                if (quoteStartIndex != kInvalidIndex)
-                {
-                    // Quoted cell is at the start of the row
-                    if (quoteStartIndex < commaIndex)
-                    {
-                        const Index quoteEndIndex = row.Find('\"', quoteStartIndex + 1);
-                        JPT_ASSERT(quoteEndIndex != kInvalidIndex, "Failed to find closing quote in CSV row");
-
-                        const String cell = row.SubStr(quoteStartIndex + 1, quoteEndIndex - quoteStartIndex - 1);
-                        currentRow.EmplaceBack(cell);
-
-                        row = row.SubStr(quoteEndIndex + 2);    // +2 for the comma and the space
-                    }
-                    // Quoted cell is not current cell
-                    else
-                    {
-                        currentRow.EmplaceBack(row.SubStr(0, commaIndex));
-                        row = row.SubStr(commaIndex + 1);
-                    }
-                }
+            const Index commaIndex = line.Find(',', cellStart);
+            if (commaIndex == kInvalidIndex)
+            {
+                row.EmplaceBack(line.ConstBuffer() + cellStart, line.Count() - cellStart);
+                break;
             }
 
-            csvData.AddRow(currentRow);
+            row.EmplaceBack(line.ConstBuffer() + cellStart, commaIndex - cellStart);
+            cellStart = commaIndex + 1;
+        }
+    }
+
+    Optional<CSVData> ReadCSV(const Path& path)
+    {
+        const MappedFile file(path);
+        JPT_ASSERT(file.IsOpen(), "Failed to map CSV file at %ls", path.ConstBuffer());
+
+        if (file.Size() == 0)
+        {
+            return {};
+        }
+
+        // Lines and cells are views into the mapped bytes. Only the cells themselves are copied
+        const StringView content(file.ConstBuffer(), file.Size());
+        const auto lines = SplitLines(content);
+
+        CSVData csvData;
+        csvData.Reserve(lines.Count());
+
+        for (const StringView line : lines)
+        {
+            CSVData::Row row;
+            locParseRow(line, row);
+            csvData.AddRow(Move(row));
         }
 
         return csvData;
@@ -4,6 +4,10 @@ module;
 
 module jpt.CSVData;
 
+import jpt.StringTokenizer;
+import jpt.StringView;
+import jpt.Utilities;
+
 namespace jpt
 {
     void CSVData::AddRow(const Row& row)
@@ -11,9 +15,18 @@ namespace jpt
         m_rows.EmplaceBack(row);
     }
 
+    void CSVData::AddRow(Row&& row)
+    {
+        m_rows.EmplaceBack(Move(row));
+    }
+
     void CSVData::AddRow(const String& row)
     {
-        m_rows.EmplaceBack(row.Split(','));
+        Row& cells = m_rows.EmplaceBack();
+        for (const StringView cell : SplitView(row, ','))
+        {
+            cells.EmplaceBack(cell.ConstBuffer(), cell.Count());
+        }
     }
 
     void CSVData::Reserve(Index rowsCount)
@@ -21,6 +21,7 @@ export namespace jpt
         CSVData() = default;
 
         void AddRow(const Row& row);
+        void AddRow(Row&& row);
 
         /** @param row        Already comma separated formatted string */
         void AddRow(const String& row);
@@ -5,245 +5,203 @@ module;
 #include "Core/Validation/Assert.h"
 #include "Debugging/Logger.h"
 
-#include <fstream>
-#include <string>
+#include <limits>
 
 module jpt.Json;
 
-import jpt.Constants;
-import jpt.DynamicArray;
-import jpt.StringHelpers;
-import jpt.Pair;
-import jpt.Stack;
+import jpt.JsonTokenizer;
+import jpt.TypeDefs;
 import jpt.Utilities;
 
 import jpt.FileIO;
+import jpt.MappedFile;
 
 namespace jpt
 {
     using namespace File;
 
-    constexpr String ParseKeyStr(const String& line)
-    {
-        const size_t keyStart = line.Find("\"") + 1;
-        const size_t keyEnd = line.Find("\"", keyStart);
-        return line.SubStr(keyStart, keyEnd - keyStart);
-    }
+    static bool locParseValue(JsonTokenizer& tokenizer, JsonToken token, JsonData& outData);
 
-    constexpr String ParseValueStr(const String& line)
+    /** Called after '{'. Values are parsed in place into their slot of outMap, nothing is copied */
+    static bool locParseObject(JsonTokenizer& tokenizer, JsonMap& outMap)
     {
-        const size_t colonIndex = line.Find(":");
-        const size_t valueStart = [&line, colonIndex]()
-            {
-                // Find the first non-space character
-                size_t i = colonIndex + 1;
-
-                while (i < line.Count() &&
-                    line[i] == ' ')
-                {
-                    ++i;
-                }
-
-                return i;
-            }();
-
-        size_t valueEnd = kInvalidIndex;
-
-        // Is empty. Could be start of map
-        if (valueStart == line.Count())
-        {
-            return String();
-        }
-        // Is array
-        else if (line[valueStart] == '[')
+        JsonToken token = tokenizer.Next();
+        if (token == JsonToken::EndObject)
         {
-            valueEnd = line.Find("]", valueStart) + 1;
+            return true;
         }
-        // single data
-        else
+
+        while (true)
         {
-            valueEnd = line.Find(",", valueStart);
-            if (valueEnd == kInvalidIndex)    // Last element. No comma
+            if (token != JsonToken::String || tokenizer.Next() != JsonToken::Colon)
             {
-                valueEnd = line.Count();
+                return false;
+            }
+
+            // Duplicated keys: the last one wins
+            JsonData& value = outMap.Add(Move(tokenizer.GetString()), JsonData());
+            if (!locParseValue(tokenizer, tokenizer.Next(), value))
+            {
+                return false;
             }
-        }
 
-        return line.SubStr(valueStart, valueEnd - valueStart);
+            token = tokenizer.Next();
+            if (token == JsonToken::EndObject)
+            {
+                return true;
+            }
+            if (token != JsonToken::Comma)
+            {
+                return false;
+            }
+            token = tokenizer.Next();
+        }
     }
 
-    constexpr JsonData ParseValueData(const String& valueStr)
+    /** Called after '[' */
+    static bool locParseArray(JsonTokenizer& tokenizer, JsonArray& outArray)
     {
-        // Boolean
-        if (valueStr == "true")
+        JsonToken token = tokenizer.Next();
+        if (token == JsonToken::EndArray)
         {
             return true;
         }
-        else if (valueStr == "false")
-        {
-            return false;
-        }
 
-        // String
-        else if (valueStr.Front() == '\"' && valueStr.Back() == '\"')
+        while (true)
         {
-            return valueStr.SubStr(1, valueStr.Count() - 2);
-        }
+            if (!locParseValue(tokenizer, token, outArray.EmplaceBack()))
+            {
+                return false;
+            }
 
-        // Null
-        else if (valueStr == "null")
-        {
-            return String("null");
+            token = tokenizer.Next();
+            if (token == JsonToken::EndArray)
+            {
+                return true;
+            }
+            if (token != JsonToken::Comma)
+            {
+                return false;
+            }
+            token = tokenizer.Next();
         }
+    }
 
-        // Array
-        else if (valueStr.Front() == '[' && valueStr.Back() == ']')
+    static bool locParseValue(JsonTokenizer& tokenizer, JsonToken token, JsonData& outData)
+    {
+        switch (token)
         {
-            DynamicArray<JsonData> arr;
-            String copy = valueStr.SubStr(1, valueStr.Count() - 2);
-
-            while (true)
+            case JsonToken::String:
             {
-                const size_t valueStart = [&copy]()
-                    {
-                        // Find the first non-space character
-                        size_t i = 0;
-
-                        while (copy[i] == ' ')
-                        {
-                            ++i;
-                        }
-
-                        return i;
-                    }();
-
-                size_t valueEnd = copy.Find(",", valueStart);
-                if (valueEnd == kInvalidIndex)
+                outData = Move(tokenizer.GetString());
+                return true;
+            }
+            case JsonToken::Integer:
+            {
+                const int64 integer = tokenizer.GetInteger();
+                if (integer >= std::numeric_limits<int32>::min() && integer <= std::numeric_limits<int32>::max())
                 {
-                    // Last element
-                    arr.Add(ParseValueData(copy.SubStr(valueStart, copy.Count() - valueStart)));
-                    break;
+                    outData = static_cast<int32>(integer);
                 }
-
-                String value = copy.SubStr(valueStart, valueEnd - valueStart);
-                arr.Add(ParseValueData(value));
-                copy = copy.SubStr(valueEnd + 1);
+                else
+                {
+                    outData = integer;
+                }
+                return true;
             }
-
-            return arr;
-        }
-
-        // Map
-        else if (valueStr.Front() == '{' && valueStr.Back() == '}')
-        {
-            JsonMap map;
-            String copy = valueStr.SubStr(1, valueStr.Count() - 2);
-            copy.Replace(" ", "");
-
-            while (true)
+            case JsonToken::Float:
             {
-                const size_t keyStart = copy.Find("\"") + 1;
-                const size_t keyEnd = copy.Find("\"", keyStart);
-                const String keyStr = copy.SubStr(keyStart, keyEnd - keyStart);
-
-                const size_t valueStart = copy.Find(":", keyEnd) + 1;
-                size_t valueEnd = copy.Find(",", valueStart);
-                if (valueEnd == kInvalidIndex)
+                if (tokenizer.NeedsDoublePrecision())
                 {
-                    valueEnd = copy.Count();
+                    outData = tokenizer.GetFloat();
                 }
-
-                const String value = copy.SubStr(valueStart, valueEnd - valueStart);
-                map.Add(keyStr, ParseValueData(value));
-
-                if (valueEnd == copy.Count())
+                else
                 {
-                    break;
+                    outData = static_cast<float32>(tokenizer.GetFloat());
                 }
-                copy = copy.SubStr(valueEnd + 1);
+                return true;
             }
-
-            return map;
-        }
-
-        // Number
-        else
-        {
-            // Integer
-            if (valueStr.Find('.') == kInvalidIndex)
+            case JsonToken::True:
+            {
+                outData = true;
+                return true;
+            }
+            case JsonToken::False:
+            {
+                outData = false;
+                return true;
+            }
+            case JsonToken::Null:
+            {
+                outData = JsonData();
+                return true;
+            }
+            case JsonToken::BeginObject:
             {
-                const int32 integer = CStrToInteger(valueStr.ConstBuffer(), valueStr.Count());
-                return integer;
+                outData = JsonMap();
+                return locParseObject(tokenizer, outData.As<JsonMap>());
             }
-            // Float
-            else
+            case JsonToken::BeginArray:
             {
-                const float32 floating = CStrToFloat(valueStr.ConstBuffer(), valueStr.Count());
-                return floating;
+                outData = JsonArray();
+                return locParseArray(tokenizer, outData.As<JsonArray>());
+            }
+            default:
+            {
+                return false;
             }
         }
     }
 
-    Optional<JsonMap> ReadJsonFile(const Path& path)
+    JsonData ParseValueData(const String& valueStr)
     {
-        std::ifstream file(path.ConstBuffer(), std::ios::in);
-        if (!file.is_open()) [[unlikely]]
+        JsonTokenizer tokenizer(valueStr.ConstBuffer(), valueStr.Count());
+
+        JsonData data;
+        if (!locParseValue(tokenizer, tokenizer.Next(), data) || tokenizer.Next() != JsonToken::End)
         {
-            JPT_INFO("Couldn't find Json File: %ls", path.ConstBuffer());
-            return {};
+            return valueStr;
         }
 
-        Stack<JsonMap> jsonMaps;
-        Stack<String> mapNames;
+        return data;
+    }
+
+    Optional<JsonMap> ParseJson(const char* pText, size_t count)
+    {
+        JsonTokenizer tokenizer(pText, count);
 
-        std::string stdLine;
-        while (std::getline(file, stdLine))
+        JsonToken token = tokenizer.Next();
+        if (token == JsonToken::End)
         {
-            const String line = stdLine.c_str();
+            return {};
+        }
 
-            if (const size_t colonIndex = line.Find(":"); colonIndex != kInvalidIndex)
-            {
-                const String keyStr = ParseKeyStr(line);
-                const String valueStr = ParseValueStr(line);
+        JsonMap root;
+        if (token != JsonToken::BeginObject || !locParseObject(tokenizer, root) || tokenizer.Next() != JsonToken::End) [[unlikely]]
+        {
+            JPT_ERROR("Failed parsing json at line %u: %s", static_cast<uint32>(tokenizer.GetLine()), tokenizer.GetError() ? tokenizer.GetError() : "Unexpected token");
+            return {};
+        }
 
-                if (!valueStr.IsEmpty())
-                {
-                    JsonData valueData = ParseValueData(valueStr);
-                    jsonMaps.Peek().Add(keyStr, valueData);
-                }
-                // Start of map next line
-                else
-                {
-                    mapNames.Push(Move(keyStr));
-                }
-            }
-            // Start of map
-            else if (line.Has("{"))
-            {
-                jsonMaps.Emplace();
-            }
-            // End of map
-            else if (line.Has("}"))
-            {
-                // If this is the end of root map
-                if (jsonMaps.Count() == 1)
-                {
-                    file.close();
-                    return jsonMaps.Peek();
-                }
+        return Move(root);
+    }
 
-                JsonMap map = jsonMaps.Peek();
-                jsonMaps.Pop();
+    Optional<JsonMap> ReadJsonFile(const Path& path)
+    {
+        if (!Exists(path)) [[unlikely]]
+        {
+            JPT_INFO("Couldn't find Json File: %ls", path.ConstBuffer());
+            return {};
+        }
 
-                String mapName = mapNames.Peek();
-                jsonMaps.Peek().Add(mapName, map);
-                mapNames.Pop();
-            }
+        // Parsed straight from the mapped pages, in a single pass
+        const MappedFile file(path);
+        if (!file.IsOpen()) [[unlikely]]
+        {
+            return {};
         }
 
-        // Empty file
-        file.close();
-        return {};
+        return ParseJson(file.ConstBuffer(), file.Size());
     }
 
     void WriteJsonFile(const File::Path& path, const JsonMap& jsonRoot)
@@ -10,9 +10,13 @@ import jpt.FilePath;
 
 export namespace jpt
 {
-    constexpr String ParseKeyStr(const String& line);
-    constexpr String ParseValueStr(const String& line);
-    constexpr JsonData ParseValueData(const String& valueStr);
+    /** Parses a single json value, e.g. 42, "text", [1, 2] or { "key": true }
+        @return     The text itself as a String if it isn't valid json. Lets command line values skip the quotes */
+    JsonData ParseValueData(const String& valueStr);
+
+    /** Parses a whole json document held in memory. Root must be an object
+        @return     Empty if the text is malformed. The error is logged with its line */
+    Optional<JsonMap> ParseJson(const char* pText, size_t count);
 
     /** Reads a json file from disk. Initialize all the data to memory and assign to root json object then return it */
     Optional<JsonMap> ReadJsonFile(const File::Path& path);
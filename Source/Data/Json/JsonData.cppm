@@ -9,6 +9,7 @@ export module jpt.JsonData;
 import jpt.Concepts;
 import jpt.DynamicArray;
 import jpt.HashMap;
+import jpt.NumberConversion;
 
 import jpt.String;
 import jpt.StringHelpers;
@@ -16,6 +17,7 @@ import jpt.ToString;
 
 import jpt.TypeDefs;
 import jpt.TypeTraits;
+import jpt.Utilities;
 import jpt.Variant;
 
 export namespace jpt
@@ -25,13 +27,17 @@ export namespace jpt
     using JsonMap   = HashMap<String, JsonData>;
 
     template<typename T>
-    concept ValidJsonType = IsAnyOf<T, int32, float32, bool, String, JsonArray, JsonMap>;
+    concept ValidJsonType = IsAnyOf<T, int32, int64, float32, float64, bool, String, JsonArray, JsonMap>;
 
-    /** Represents a single data in Json file */
+    /** Represents a single data in Json file
+        @note   Parsed numbers take the narrowest type holding them: int32 then int64 for integers,
+                float32 for literals of up to 6 significant digits (FLT_DIG), which float32 gives back unchanged, float64 past that */
     class JsonData
     {
         using TData = Variant<int32,
+                              int64,
                               float32,
+                              float64,
                               bool,
                               String,
                               JsonArray,
@@ -46,9 +52,15 @@ export namespace jpt
         template<ValidJsonType T>
         constexpr JsonData(const T& value);
 
+        template<ValidJsonType T>
+        constexpr JsonData(T&& value);
+
         template<ValidJsonType T>
         constexpr JsonData& operator=(const T& value);
 
+        template<ValidJsonType T>
+        constexpr JsonData& operator=(T&& value);
+
         template<ValidJsonType T> constexpr              bool Is() const { return m_data.Is<T>(); }
         template<ValidJsonType T> constexpr                T& As()       { return m_data.As<T>(); }
         template<ValidJsonType T> constexpr          const T& As() const { return m_data.As<T>(); }
@@ -60,6 +72,77 @@ export namespace jpt
     // Non-Member functions
     // ------------------------------------------------------------------------------------------------
     String ToString(const JsonArray& array);
+    String ToString(const JsonMap& map);
+
+    /** @return     str quoted, with the characters json requires escaped */
+    String ToJsonString(const String& str)
+    {
+        String content;
+        content.Reserve(str.Count() + 2);
+        content.Append('"');
+
+        const char* pRunStart = str.ConstBuffer();
+        const char* pEnd = pRunStart + str.Count();
+        for (const char* pChar = pRunStart; pChar != pEnd; ++pChar)
+        {
+            const char c = *pChar;
+            if (c != '"' && c != '\\' && static_cast<uint8>(c) >= 0x20)
+            {
+                continue;
+            }
+
+            if (pChar != pRunStart)
+            {
+                content.Append(String(pRunStart, pChar - pRunStart));
+            }
+
+            switch (c)
+            {
+                case '"':  content.Append("\\\""); break;
+                case '\\': content.Append("\\\\"); break;
+                case '\n': content.Append("\\n");  break;
+                case '\r': content.Append("\\r");  break;
+                case '\t': content.Append("\\t");  break;
+                case '\b': content.Append("\\b");  break;
+                case '\f': content.Append("\\f");  break;
+                default:
+                {
+                    constexpr const char* kHexDigits = "0123456789abcdef";
+                    const char escaped[] = { '\\', 'u', '0', '0', kHexDigits[c >> 4], kHexDigits[c & 0xF], '\0' };
+                    content.Append(escaped);
+                }
+            }
+            pRunStart = pChar + 1;
+        }
+
+        if (pEnd != pRunStart)
+        {
+            content.Append(String(pRunStart, pEnd - pRunStart));
+        }
+        content.Append('"');
+        return content;
+    }
+
+    /** Shortest text that reads back to the same value, and still reads back as a float */
+    template<Floating TFloat>
+    String ToJsonNumber(TFloat value)
+    {
+        char buffer[kMaxFloatChars + 2];
+        Index count = WriteFloat(buffer, value);
+
+        bool isIntegral = true;
+        for (Index i = 0; i < count && isIntegral; ++i)
+        {
+            isIntegral = buffer[i] == '-' || (buffer[i] >= '0' && buffer[i] <= '9');
+        }
+        if (isIntegral)
+        {
+            buffer[count++] = '.';
+            buffer[count++] = '0';
+        }
+
+        return String(buffer, count);
+    }
 
     String ToString(const JsonData& jsonData)
     {
@@ -67,9 +150,17 @@ export namespace jpt
         {
             return jpt::ToString<String, int32>(jsonData.As<int32>());
         }
+        else if (jsonData.Is<int64>())
+        {
+            return jpt::ToString<String, int64>(jsonData.As<int64>());
+        }
         else if (jsonData.Is<float32>())
         {
-            return jpt::ToString<String, float32>(jsonData.As<float32>());
+            return ToJsonNumber(jsonData.As<float32>());
+        }
+        else if (jsonData.Is<float64>())
+        {
+            return ToJsonNumber(jsonData.As<float64>());
         }
         else if (jsonData.Is<bool>())
         {
@@ -84,13 +175,17 @@ export namespace jpt
             }
             else
             {
-                return "\"" + str + "\"";
+                return ToJsonString(str);
             }
         }
         else if (jsonData.Is<JsonArray>())
         {
             return ToString(jsonData.As<JsonArray>());
         }
+        else if (jsonData.Is<JsonMap>())
+        {
+            return ToString(jsonData.As<JsonMap>());
+        }
 
         JPT_ASSERT(false, "Unsupported data type in json file");
         return String();
@@ -135,9 +230,8 @@ export namespace jpt
             addTabs();
 
             // Add key
-            content.Append("\"");
-            content.Append(key);
-            content.Append("\": ");
+            content.Append(ToJsonString(key));
+            content.Append(": ");
 
             // If the value is a map, append a line and recurse to next depth
             if (value.Is<JsonMap>())
@@ -190,10 +284,18 @@ export namespace jpt
         {
             return lhs.As<int32>() == rhs.As<int32>();
         }
+        else if (lhs.Is<int64>())
+        {
+            return lhs.As<int64>() == rhs.As<int64>();
+        }
         else if (lhs.Is<float32>())
         {
             return lhs.As<float32>() == rhs.As<float32>();
         }
+        else if (lhs.Is<float64>())
+        {
+            return lhs.As<float64>() == rhs.As<float64>();
+        }
         else if (lhs.Is<bool>())
         {
             return lhs.As<bool>() == rhs.As<bool>();
@@ -229,10 +331,23 @@ export namespace jpt
     {
     }
 
+    template<ValidJsonType T>
+    constexpr JsonData::JsonData(T&& value)
+        : m_data(Move(value))
+    {
+    }
+
     template<ValidJsonType T>
     constexpr JsonData& JsonData::operator=(const T& value)
     {
         m_data = value;
         return *this;
     }
+
+    template<ValidJsonType T>
+    constexpr JsonData& JsonData::operator=(T&& value)
+    {
+        m_data = Move(value);
+        return *this;
+    }
 }
\ No newline at end of file
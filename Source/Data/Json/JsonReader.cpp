@@ -0,0 +1,175 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Debugging/Logger.h"
+
+module jpt.JsonReader;
+
+import jpt.DynamicArray;
+import jpt.JsonTokenizer;
+
+import jpt.FileIO;
+import jpt.MappedFile;
+
+namespace jpt
+{
+    using namespace File;
+
+    /** What the next token may be */
+    enum class ExpectedToken : uint8
+    {
+        Value,
+        ValueOrEndArray,    /**< Right after '[' */
+        Key,
+        KeyOrEndObject,     /**< Right after '{' */
+        SeparatorOrEnd,     /**< After a value: ',' or the closing bracket of current scope, End at root */
+    };
+
+    static JsonReadResult locFail(const JsonTokenizer& tokenizer)
+    {
+        JPT_ERROR("Failed reading json at line %u: %s", static_cast<uint32>(tokenizer.GetLine()), tokenizer.GetError() ? tokenizer.GetError() : "Unexpected token");
+        return JsonReadResult::Error;
+    }
+
+    JsonReadResult ReadJson(const char* pText, size_t count, JsonHandler& handler)
+    {
+        JsonTokenizer tokenizer(pText, count);
+
+        // Open scopes, true for objects. Iterative so nesting depth doesn't grow the call stack
+        DynamicArray<bool> scopes;
+        ExpectedToken expected = ExpectedToken::Value;
+
+        while (true)
+        {
+            const JsonToken token = tokenizer.Next();
+            bool shouldContinue = true;
+
+            switch (expected)
+            {
+                case ExpectedToken::Key:
+                case ExpectedToken::KeyOrEndObject:
+                {
+                    if (token == JsonToken::EndObject && expected == ExpectedToken::KeyOrEndObject)
+                    {
+                        scopes.Pop();
+                        shouldContinue = handler.OnEndObject();
+                        expected = ExpectedToken::SeparatorOrEnd;
+                        break;
+                    }
+
+                    if (token != JsonToken::String)
+                    {
+                        return locFail(tokenizer);
+                    }
+                    // Stop before reading on. Whatever follows the key is never looked at
+                    if (!handler.OnKey(tokenizer.GetString()))
+                    {
+                        return JsonReadResult::Stopped;
+                    }
+
+                    if (tokenizer.Next() != JsonToken::Colon)
+                    {
+                        return locFail(tokenizer);
+                    }
+                    expected = ExpectedToken::Value;
+                    break;
+                }
+
+                case ExpectedToken::Value:
+                case ExpectedToken::ValueOrEndArray:
+                {
+                    if (token == JsonToken::EndArray && expected == ExpectedToken::ValueOrEndArray)
+                    {
+                        scopes.Pop();
+                        shouldContinue = handler.OnEndArray();
+                        expected = ExpectedToken::SeparatorOrEnd;
+                        break;
+                    }
+
+                    expected = ExpectedToken::SeparatorOrEnd;
+
+                    switch (token)
+                    {
+                        case JsonToken::String:  shouldContinue = handler.OnString(tokenizer.GetString()); break;
+                        case JsonToken::Integer: shouldContinue = handler.OnInteger(tokenizer.GetInteger()); break;
+                        case JsonToken::Float:   shouldContinue = handler.OnFloat(tokenizer.GetFloat());     break;
+                        case JsonToken::True:    shouldContinue = handler.OnBool(true);                      break;
+                        case JsonToken::False:   shouldContinue = handler.OnBool(false);                     break;
+                        case JsonToken::Null:    shouldContinue = handler.OnNull();                          break;
+                        case JsonToken::BeginObject:
+                        {
+                            scopes.EmplaceBack(true);
+                            shouldContinue = handler.OnBeginObject();
+                            expected = ExpectedToken::KeyOrEndObject;
+                            break;
+                        }
+                        case JsonToken::BeginArray:
+                        {
+                            scopes.EmplaceBack(false);
+                            shouldContinue = handler.OnBeginArray();
+                            expected = ExpectedToken::ValueOrEndArray;
+                            break;
+                        }
+                        default:
+                        {
+                            return locFail(tokenizer);
+                        }
+                    }
+                    break;
+                }
+
+                case ExpectedToken::SeparatorOrEnd:
+                {
+                    if (scopes.IsEmpty())
+                    {
+                        return token == JsonToken::End ? JsonReadResult::Completed : locFail(tokenizer);
+                    }
+
+                    const bool isObject = scopes.Back();
+                    if (token == JsonToken::Comma)
+                    {
+                        expected = isObject ? ExpectedToken::Key : ExpectedToken::Value;
+                    }
+                    else if (token == JsonToken::EndObject && isObject)
+                    {
+                        scopes.Pop();
+                        shouldContinue = handler.OnEndObject();
+                    }
+                    else if (token == JsonToken::EndArray && !isObject)
+                    {
+                        scopes.Pop();
+                        shouldContinue = handler.OnEndArray();
+                    }
+                    else
+                    {
+                        return locFail(tokenizer);
+                    }
+                    break;
+                }
+            }
+
+            if (!shouldContinue)
+            {
+                return JsonReadResult::Stopped;
+            }
+        }
+    }
+
+    JsonReadResult ReadJsonFile(const Path& path, JsonHandler& handler)
+    {
+        if (!Exists(path)) [[unlikely]]
+        {
+            JPT_INFO("Couldn't find Json File: %ls", path.ConstBuffer());
+            return JsonReadResult::Error;
+        }
+
+        const MappedFile file(path);
+        if (!file.IsOpen()) [[unlikely]]
+        {
+            return JsonReadResult::Error;
+        }
+
+        return ReadJson(file.ConstBuffer(), file.Size(), handler);
+    }
+}
\ No newline at end of file
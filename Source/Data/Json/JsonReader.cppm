@@ -0,0 +1,65 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.JsonReader;
+
+import jpt.String;
+import jpt.TypeDefs;
+
+import jpt.FilePath;
+
+export namespace jpt
+{
+    /** Receives a json document as a stream of events, without building any JsonData.
+        Override what's needed. Every callback returns false to stop reading right away
+
+        @example
+            // Finds a single value in a large manifest and stops there
+            class FindVersion final : public jpt::JsonHandler
+            {
+            public:
+                int64 m_version = -1;
+                bool m_isVersionKey = false;
+
+                bool OnKey(jpt::String& key) override { m_isVersionKey = key == "version"; return true; }
+                bool OnInteger(int64 value) override
+                {
+                    if (m_isVersionKey)
+                    {
+                        m_version = value;
+                        return false;
+                    }
+                    return true;
+                }
+            }; */
+    class JsonHandler
+    {
+    public:
+        virtual ~JsonHandler() = default;
+
+        virtual bool OnBeginObject() { return true; }
+        virtual bool OnEndObject()   { return true; }
+        virtual bool OnBeginArray()  { return true; }
+        virtual bool OnEndArray()    { return true; }
+
+        /** key and string values are safe to move from */
+        virtual bool OnKey(String&)     { return true; }
+        virtual bool OnString(String&)  { return true; }
+        virtual bool OnInteger(int64)   { return true; }
+        virtual bool OnFloat(float64)   { return true; }
+        virtual bool OnBool(bool)       { return true; }
+        virtual bool OnNull()           { return true; }
+    };
+
+    enum class JsonReadResult : uint8
+    {
+        Completed,  /**< Whole document was read */
+        Stopped,    /**< A handler callback returned false */
+        Error,      /**< Malformed json or missing file. Logged */
+    };
+
+    /** Reads a json document held in memory in a single pass and forwards it to handler. Grammar is validated on the way */
+    JsonReadResult ReadJson(const char* pText, size_t count, JsonHandler& handler);
+
+    /** Reads a json file from disk into handler */
+    JsonReadResult ReadJsonFile(const File::Path& path, JsonHandler& handler);
+}
\ No newline at end of file
@@ -0,0 +1,360 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <cstring>
+#include <limits>
+
+module jpt.JsonTokenizer;
+
+import jpt.Allocator;
+import jpt.NumberConversion;
+
+namespace jpt
+{
+    /** Decimals with at most this many significant digits survive decimal -> float32 -> decimal (FLT_DIG).
+        FLT_DECIMAL_DIG (9) is the other direction, float32 -> decimal -> float32, and would truncate 7 to 9 digit literals */
+    static constexpr int32 kFloat32SignificantDigits = 6;
+
+    static bool locIsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /** @return     Value of 4 hex digits at pBuffer, or -1 if any of them isn't hex */
+    static int32 locParseHex4(const char* pBuffer)
+    {
+        int32 value = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            const char c = pBuffer[i];
+            value <<= 4;
+
+            if (locIsDigit(c))
+            {
+                value |= c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                value |= c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                value |= c - 'A' + 10;
+            }
+            else
+            {
+                return -1;
+            }
+        }
+        return value;
+    }
+
+    /** @return     Bytes written to pDestination */
+    static size_t locEncodeUtf8(uint32 codePoint, char* pDestination)
+    {
+        if (codePoint < 0x80)
+        {
+            pDestination[0] = static_cast<char>(codePoint);
+            return 1;
+        }
+        if (codePoint < 0x800)
+        {
+            pDestination[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+            pDestination[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 2;
+        }
+        if (codePoint < 0x10000)
+        {
+            pDestination[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+            pDestination[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            pDestination[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 3;
+        }
+
+        pDestination[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+        pDestination[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        pDestination[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        pDestination[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 4;
+    }
+
+    JsonTokenizer::JsonTokenizer(const char* pBuffer, size_t count)
+        : m_pBegin(pBuffer)
+        , m_pCurrent(pBuffer)
+        , m_pEnd(pBuffer + count)
+    {
+        // Skip UTF-8 BOM
+        if (count >= 3 && static_cast<uint8>(pBuffer[0]) == 0xEF && static_cast<uint8>(pBuffer[1]) == 0xBB && static_cast<uint8>(pBuffer[2]) == 0xBF)
+        {
+            m_pCurrent += 3;
+        }
+    }
+
+    JsonToken JsonTokenizer::Next()
+    {
+        while (m_pCurrent < m_pEnd && (*m_pCurrent == ' ' || *m_pCurrent == '\n' || *m_pCurrent == '\r' || *m_pCurrent == '\t'))
+        {
+            ++m_pCurrent;
+        }
+
+        if (m_pCurrent == m_pEnd)
+        {
+            return JsonToken::End;
+        }
+
+        switch (*m_pCurrent)
+        {
+            case '{': ++m_pCurrent; return JsonToken::BeginObject;
+            case '}': ++m_pCurrent; return JsonToken::EndObject;
+            case '[': ++m_pCurrent; return JsonToken::BeginArray;
+            case ']': ++m_pCurrent; return JsonToken::EndArray;
+            case ':': ++m_pCurrent; return JsonToken::Colon;
+            case ',': ++m_pCurrent; return JsonToken::Comma;
+            case '"': return ReadString();
+            case 't': return ReadLiteral("true",  4, JsonToken::True);
+            case 'f': return ReadLiteral("false", 5, JsonToken::False);
+            case 'n': return ReadLiteral("null",  4, JsonToken::Null);
+            default:
+            {
+                if (*m_pCurrent == '-' || locIsDigit(*m_pCurrent))
+                {
+                    return ReadNumber();
+                }
+                return Fail("Unexpected character");
+            }
+        }
+    }
+
+    size_t JsonTokenizer::GetLine() const
+    {
+        size_t line = 1;
+        for (const char* pChar = m_pBegin; pChar < m_pCurrent; ++pChar)
+        {
+            line += *pChar == '\n';
+        }
+        return line;
+    }
+
+    JsonToken JsonTokenizer::ReadString()
+    {
+        const char* pStart = ++m_pCurrent;
+
+        // Fast path, no escapes: copy the whole run at once
+        const char* pChar = pStart;
+        while (pChar < m_pEnd && *pChar != '"' && *pChar != '\\')
+        {
+            ++pChar;
+        }
+
+        if (pChar == m_pEnd)
+        {
+            return Fail("Unterminated string");
+        }
+
+        if (*pChar == '"')
+        {
+            m_string = String(pStart, pChar - pStart);
+            m_pCurrent = pChar + 1;
+            return JsonToken::String;
+        }
+
+        // Find the closing quote. Escapes only shrink, so the raw length bounds the decoded one
+        const char* pClosing = pChar;
+        while (pClosing < m_pEnd && *pClosing != '"')
+        {
+            pClosing += *pClosing == '\\' ? 2 : 1;
+        }
+
+        if (pClosing >= m_pEnd)
+        {
+            return Fail("Unterminated string");
+        }
+
+        char* pBuffer = Allocator<char>::NewArray(pClosing - pStart + 1);
+        char* pOut = pBuffer;
+
+        const size_t runSize = pChar - pStart;
+        std::memcpy(pOut, pStart, runSize);
+        pOut += runSize;
+
+        while (pChar < pClosing)
+        {
+            if (*pChar != '\\')
+            {
+                *pOut++ = *pChar++;
+                continue;
+            }
+
+            ++pChar;
+            switch (*pChar++)
+            {
+                case '"':  *pOut++ = '"';  break;
+                case '\\': *pOut++ = '\\'; break;
+                case '/':  *pOut++ = '/';  break;
+                case 'b':  *pOut++ = '\b'; break;
+                case 'f':  *pOut++ = '\f'; break;
+                case 'n':  *pOut++ = '\n'; break;
+                case 'r':  *pOut++ = '\r'; break;
+                case 't':  *pOut++ = '\t'; break;
+                case 'u':
+                {
+                    // Truncated escapes fail here, before pChar could step past the closing quote
+                    int32 codePoint = pClosing - pChar >= 4 ? locParseHex4(pChar) : -1;
+                    if (codePoint >= 0)
+                    {
+                        pChar += 4;
+                    }
+
+                    // Surrogate pair
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        const int32 low = pClosing - pChar >= 6 && pChar[0] == '\\' && pChar[1] == 'u' ? locParseHex4(pChar + 2) : -1;
+                        if (low >= 0xDC00 && low <= 0xDFFF)
+                        {
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                            pChar += 6;
+                        }
+                        else
+                        {
+                            codePoint = -1;
+                        }
+                    }
+
+                    if (codePoint < 0)
+                    {
+                        Allocator<char>::DeleteArray(pBuffer);
+                        m_pCurrent = pChar;
+                        return Fail("Invalid unicode escape");
+                    }
+
+                    pOut += locEncodeUtf8(static_cast<uint32>(codePoint), pOut);
+                    break;
+                }
+                default:
+                {
+                    Allocator<char>::DeleteArray(pBuffer);
+                    m_pCurrent = pChar;
+                    return Fail("Invalid escape character");
+                }
+            }
+        }
+
+        *pOut = '\0';
+        m_string.MoveString(pBuffer, pOut - pBuffer);
+        m_pCurrent = pClosing + 1;
+        return JsonToken::String;
+    }
+
+    JsonToken JsonTokenizer::ReadNumber()
+    {
+        const char* pStart = m_pCurrent;
+        const char* pChar = pStart;
+        bool isFloat = false;
+
+        // Significant digits of the mantissa, ignoring leading and trailing zeros
+        int32 digitsCount = 0;
+        int32 significantEnd = 0;
+        bool isLeadingZero = true;
+
+        auto readDigits = [&]()
+            {
+                const char* pDigitsStart = pChar;
+                while (pChar < m_pEnd && locIsDigit(*pChar))
+                {
+                    if (*pChar != '0' || !isLeadingZero)
+                    {
+                        isLeadingZero = false;
+                        ++digitsCount;
+                        if (*pChar != '0')
+                        {
+                            significantEnd = digitsCount;
+                        }
+                    }
+                    ++pChar;
+                }
+                return pChar != pDigitsStart;
+            };
+
+        if (*pChar == '-')
+        {
+            ++pChar;
+        }
+
+        if (!readDigits())
+        {
+            return Fail("Invalid number");
+        }
+
+        if (pChar < m_pEnd && *pChar == '.')
+        {
+            isFloat = true;
+            ++pChar;
+            if (!readDigits())
+            {
+                return Fail("Invalid number");
+            }
+        }
+
+        if (pChar < m_pEnd && (*pChar == 'e' || *pChar == 'E'))
+        {
+            isFloat = true;
+            ++pChar;
+            if (pChar < m_pEnd && (*pChar == '+' || *pChar == '-'))
+            {
+                ++pChar;
+            }
+
+            const char* pExponentStart = pChar;
+            while (pChar < m_pEnd && locIsDigit(*pChar))
+            {
+                ++pChar;
+            }
+
+            if (pChar == pExponentStart)
+            {
+                return Fail("Invalid number");
+            }
+        }
+
+        m_pCurrent = pChar;
+
+        if (!isFloat)
+        {
+            if (ParseInteger(pStart, pChar - pStart, m_integer).IsValid())
+            {
+                return JsonToken::Integer;
+            }
+            // Too big for int64, keep it as float64
+        }
+
+        if (!ParseFloat(pStart, pChar - pStart, m_float).IsValid())
+        {
+            return Fail("Number out of range");
+        }
+
+        const float64 magnitude = m_float < 0 ? -m_float : m_float;
+        m_needsDoublePrecision = significantEnd > kFloat32SignificantDigits ||
+                                 magnitude > std::numeric_limits<float32>::max() ||
+                                 (magnitude != 0.0 && magnitude < std::numeric_limits<float32>::min());
+
+        return JsonToken::Float;
+    }
+
+    JsonToken JsonTokenizer::ReadLiteral(const char* pLiteral, size_t count, JsonToken token)
+    {
+        if (static_cast<size_t>(m_pEnd - m_pCurrent) < count || std::memcmp(m_pCurrent, pLiteral, count) != 0)
+        {
+            return Fail("Unexpected character");
+        }
+
+        m_pCurrent += count;
+        return token;
+    }
+
+    JsonToken JsonTokenizer::Fail(const char* pError)
+    {
+        m_pError = pError;
+        return JsonToken::Error;
+    }
+}
\ No newline at end of file
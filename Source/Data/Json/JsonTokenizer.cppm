@@ -0,0 +1,78 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.JsonTokenizer;
+
+import jpt.String;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    enum class JsonToken : uint8
+    {
+        BeginObject,    // {
+        EndObject,      // }
+        BeginArray,     // [
+        EndArray,       // ]
+        Colon,
+        Comma,
+        String,
+        Integer,
+        Float,
+        True,
+        False,
+        Null,
+        End,            /**< Reached the end of buffer */
+        Error,
+    };
+
+    /** Splits a contiguous json text into tokens in a single forward pass.
+        Strings are unescaped and numbers converted while scanning. The buffer is never modified nor copied, it must outlive the tokenizer.
+        Grammar (matching brackets, commas between elements) is left to the caller
+
+        @example
+            jpt::JsonTokenizer tokenizer(text.ConstBuffer(), text.Count());
+            for (jpt::JsonToken token = tokenizer.Next(); token != jpt::JsonToken::End; token = tokenizer.Next())
+            {
+                if (token == jpt::JsonToken::String)
+                {
+                    jpt::String str = Move(tokenizer.GetString());
+                }
+            } */
+    class JsonTokenizer
+    {
+    private:
+        const char* m_pBegin   = nullptr;
+        const char* m_pCurrent = nullptr;
+        const char* m_pEnd     = nullptr;
+
+        String m_string;                        /**< Value of the last String token */
+        int64 m_integer = 0;                    /**< Value of the last Integer token */
+        float64 m_float = 0.0;                  /**< Value of the last Float token */
+        bool m_needsDoublePrecision = false;    /**< Whether the last Float token doesn't fit in float32 */
+        const char* m_pError = nullptr;         /**< Reason of the last Error token */
+
+    public:
+        JsonTokenizer(const char* pBuffer, size_t count);
+
+        JsonToken Next();
+
+        /** Value of the last String token. Safe to move from, the next String token overwrites it */
+        String& GetString() { return m_string; }
+        int64 GetInteger() const { return m_integer; }
+        float64 GetFloat() const { return m_float; }
+
+        /** @return     true if the last Float token has more significant digits than a float32 keeps (FLT_DIG), or is out of float32 range */
+        bool NeedsDoublePrecision() const { return m_needsDoublePrecision; }
+
+        const char* GetError() const { return m_pError; }
+
+        /** @return     1-based line of the current position. Counts from the beginning, meant for error reports only */
+        size_t GetLine() const;
+
+    private:
+        JsonToken ReadString();
+        JsonToken ReadNumber();
+        JsonToken ReadLiteral(const char* pLiteral, size_t count, JsonToken token);
+        JsonToken Fail(const char* pError);
+    };
+}
\ No newline at end of file
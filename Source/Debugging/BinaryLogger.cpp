@@ -0,0 +1,542 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+#include "Debugging/BinaryLogger.h"
+
+#include "Core/Validation/Assert.h"
+
+#include <stdio.h>
+
+import jpt.FileIO;
+import jpt.FilePathUtils;
+import jpt.LockGuard;
+import jpt.Serializer;
+import jpt.Sort;
+import jpt.SystemPaths;
+
+namespace jpt
+{
+    static constexpr size_t kSiteHeaderSize = sizeof(BinaryLogger::RecordType) + sizeof(uint32) + sizeof(uint8) + sizeof(int32);
+    static constexpr size_t kSessionSize = sizeof(BinaryLogger::RecordType) + sizeof(int64);
+    static constexpr int64 kNanosecondsPerSecond = 1'000'000'000;
+
+    /** Upper bound of file and format each in a site record, so a site always fits in kMaxRecordSize */
+    static constexpr size_t kMaxSiteStringSize = (BinaryLogger::kMaxRecordSize - kSiteHeaderSize) / 2 - sizeof(uint16);
+
+    struct DecodedArg
+    {
+        BinaryLogger::ArgType type = BinaryLogger::ArgType::Unsupported;
+        uint64 bits = 0;
+        const char* pChars = nullptr;   /**< String args, not null-terminated */
+        size_t charsCount = 0;
+    };
+
+    struct DecodedSite
+    {
+        Logger::Type type = Logger::Type::Info;
+        int32 line = 0;
+        String file;
+        String format;
+    };
+
+    struct DecodedEvent
+    {
+        int64 nanoseconds = 0;
+        size_t order = 0;               /**< Position in file. Keeps the sort stable for equal timestamps */
+        uint32 siteId = 0;
+        const char* pArgs = nullptr;
+        size_t argsSize = 0;
+    };
+
+    template<typename T>
+    static T locRead(const char* pData)
+    {
+        T value;
+        std::memcpy(&value, pData, sizeof(T));
+        return value;
+    }
+
+    /** @return     Args found in pArgs. Stops at the first malformed one */
+    static DynamicArray<DecodedArg> locDecodeArgs(const char* pArgs, size_t argsSize)
+    {
+        DynamicArray<DecodedArg> args;
+
+        size_t offset = 0;
+        while (offset < argsSize)
+        {
+            DecodedArg arg;
+            arg.type = static_cast<BinaryLogger::ArgType>(pArgs[offset++]);
+
+            switch (arg.type)
+            {
+                case BinaryLogger::ArgType::Int32:
+                case BinaryLogger::ArgType::UInt32:
+                {
+                    if (argsSize - offset < sizeof(uint32))
+                    {
+                        return args;
+                    }
+                    arg.bits = locRead<uint32>(pArgs + offset);
+                    offset += sizeof(uint32);
+                    break;
+                }
+                case BinaryLogger::ArgType::Int64:
+                case BinaryLogger::ArgType::UInt64:
+                case BinaryLogger::ArgType::Float64:
+                case BinaryLogger::ArgType::Pointer:
+                {
+                    if (argsSize - offset < sizeof(uint64))
+                    {
+                        return args;
+                    }
+                    arg.bits = locRead<uint64>(pArgs + offset);
+                    offset += sizeof(uint64);
+                    break;
+                }
+                case BinaryLogger::ArgType::String:
+                case BinaryLogger::ArgType::WString:
+                {
+                    if (argsSize - offset < sizeof(uint16))
+                    {
+                        return args;
+                    }
+                    const size_t charSize = arg.type == BinaryLogger::ArgType::String ? sizeof(char) : sizeof(wchar_t);
+                    arg.charsCount = locRead<uint16>(pArgs + offset);
+                    offset += sizeof(uint16);
+
+                    // The encoder never writes more than kMaxStringSize, and locFormatArg() copies into a buffer of that size
+                    if (arg.charsCount > BinaryLogger::kMaxStringSize || argsSize - offset < arg.charsCount * charSize)
+                    {
+                        return args;
+                    }
+                    arg.pChars = pArgs + offset;
+                    offset += arg.charsCount * charSize;
+                    break;
+                }
+                case BinaryLogger::ArgType::Unsupported:
+                {
+                    break;
+                }
+                default:
+                {
+                    return args;
+                }
+            }
+
+            args.EmplaceBack(arg);
+        }
+
+        return args;
+    }
+
+    /** Appends one printf conversion. spec holds the flags, width and precision without length modifier */
+    static void locFormatArg(String& message, const String& spec, char conversion, const DecodedArg& arg)
+    {
+        char buffer[BinaryLogger::kMaxStringSize * 2];
+        int32 count = -1;
+
+        const bool isInteger = arg.type == BinaryLogger::ArgType::Int32 || arg.type == BinaryLogger::ArgType::UInt32 ||
+                               arg.type == BinaryLogger::ArgType::Int64 || arg.type == BinaryLogger::ArgType::UInt64;
+        const bool is64Bits  = (arg.type == BinaryLogger::ArgType::Int64 || arg.type == BinaryLogger::ArgType::UInt64) && conversion != 'c';
+
+        switch (conversion)
+        {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            {
+                if (isInteger)
+                {
+                    const String format = "%" + spec + (is64Bits ? "ll" : "") + String(&conversion, 1);
+                    count = is64Bits ? snprintf(buffer, sizeof(buffer), format.ConstBuffer(), arg.bits) :
+                                       snprintf(buffer, sizeof(buffer), format.ConstBuffer(), static_cast<uint32>(arg.bits));
+                }
+                break;
+            }
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            {
+                if (arg.type == BinaryLogger::ArgType::Float64)
+                {
+                    const String format = "%" + spec + String(&conversion, 1);
+                    count = snprintf(buffer, sizeof(buffer), format.ConstBuffer(), locRead<float64>(reinterpret_cast<const char*>(&arg.bits)));
+                }
+                break;
+            }
+            case 's':
+            {
+                if (arg.type == BinaryLogger::ArgType::String)
+                {
+                    const String value(arg.pChars, arg.charsCount);
+                    const String format = "%" + spec + "s";
+                    count = snprintf(buffer, sizeof(buffer), format.ConstBuffer(), value.ConstBuffer());
+                }
+                else if (arg.type == BinaryLogger::ArgType::WString)
+                {
+                    wchar_t value[BinaryLogger::kMaxStringSize + 1];
+                    std::memcpy(value, arg.pChars, arg.charsCount * sizeof(wchar_t));
+                    value[arg.charsCount] = L'\0';
+
+                    const String format = "%" + spec + "ls";
+                    count = snprintf(buffer, sizeof(buffer), format.ConstBuffer(), value);
+                }
+                break;
+            }
+            case 'p':
+            {
+                if (arg.type == BinaryLogger::ArgType::Pointer)
+                {
+                    count = snprintf(buffer, sizeof(buffer), "%p", reinterpret_cast<void*>(static_cast<uintptr>(arg.bits)));
+                }
+                break;
+            }
+        }
+
+        if (count < 0)
+        {
+            message += "<?>";
+            return;
+        }
+
+        const size_t formattedCount = static_cast<size_t>(count) < sizeof(buffer) ? static_cast<size_t>(count) : sizeof(buffer) - 1;
+        message += String(buffer, formattedCount);
+    }
+
+    /** printf of a recorded event. Length modifiers in format are ignored, the recorded arg types decide.
+        A missing or mismatching arg prints <?> instead of reading garbage */
+    static String locFormatMessage(const char* format, const char* pArgs, size_t argsSize)
+    {
+        const DynamicArray<DecodedArg> args = locDecodeArgs(pArgs, argsSize);
+        size_t argIndex = 0;
+
+        String message;
+        const char* pChar = format;
+        while (*pChar != '\0')
+        {
+            if (*pChar != '%')
+            {
+                const char* pRunStart = pChar;
+                while (*pChar != '\0' && *pChar != '%')
+                {
+                    ++pChar;
+                }
+                message += String(pRunStart, pChar - pRunStart);
+                continue;
+            }
+
+            ++pChar;
+            if (*pChar == '%')
+            {
+                message += "%";
+                ++pChar;
+                continue;
+            }
+
+            // Flags, width and precision. '*' takes its value from the next arg
+            String spec;
+            while (*pChar != '\0' && std::strchr("-+ #0123456789.*", *pChar))
+            {
+                if (*pChar == '*')
+                {
+                    const bool hasArg = argIndex < args.Count() && args[argIndex].type == BinaryLogger::ArgType::Int32;
+                    spec += hasArg ? ToString(static_cast<int32>(args[argIndex].bits)) : String("0");
+                    ++argIndex;
+                }
+                else
+                {
+                    spec += String(pChar, 1);
+                }
+                ++pChar;
+            }
+
+            // Length modifiers
+            while (*pChar != '\0' && std::strchr("hljztLI0123456789", *pChar))
+            {
+                ++pChar;
+            }
+
+            if (*pChar == '\0')
+            {
+                break;
+            }
+
+            const char conversion = *pChar++;
+            if (argIndex < args.Count())
+            {
+                locFormatArg(message, spec, conversion, args[argIndex]);
+            }
+            else
+            {
+                message += "<?>";
+            }
+            ++argIndex;
+        }
+
+        return message;
+    }
+
+    BinaryLogger& BinaryLogger::GetInstance()
+    {
+        static BinaryLogger s_binaryLogger;
+        return s_binaryLogger;
+    }
+
+    void BinaryLogger::Init()
+    {
+        JPT_ASSERT(System::Paths::GetInstance().IsInitialized());
+
+        LockGuard lock(m_sitesMutex);
+
+        if (!m_writer.Open(File::Combine(File::Source::Saved, "Log.bin"), SerializerMode::AppendBinary))
+        {
+            return;
+        }
+
+        char record[kMaxRecordSize];
+        m_writer.Push(record, EncodeSession(record, GetNanoseconds()));
+
+        // Sites registered before Init logged through the fallback, but may be hit again
+        for (size_t i = 0; i < m_sites.Count(); ++i)
+        {
+            const Site& site = m_sites[i];
+            m_writer.Push(record, EncodeSite(record, static_cast<uint32>(i), site.type, site.line, site.file, site.format));
+        }
+    }
+
+    void BinaryLogger::Terminate()
+    {
+        m_writer.Close();
+    }
+
+    void BinaryLogger::Flush()
+    {
+        m_writer.Flush();
+    }
+
+    uint32 BinaryLogger::RegisterSite(Logger::Type type, int32 line, const char* file, const char* format)
+    {
+        LockGuard lock(m_sitesMutex);
+
+        const uint32 siteId = static_cast<uint32>(m_sites.Count());
+        m_sites.EmplaceBack(Site{ type, line, file, format });
+
+        if (m_writer.IsRunning())
+        {
+            char record[kMaxRecordSize];
+            m_writer.Push(record, EncodeSite(record, siteId, type, line, file, format));
+        }
+
+        return siteId;
+    }
+
+    size_t BinaryLogger::EncodeSite(char* pRecord, uint32 siteId, Logger::Type type, int32 line, const char* file, const char* format)
+    {
+        pRecord[0] = static_cast<char>(RecordType::Site);
+        std::memcpy(pRecord + 1, &siteId, sizeof(siteId));
+        pRecord[5] = static_cast<char>(type);
+        std::memcpy(pRecord + 6, &line, sizeof(line));
+
+        size_t size = kSiteHeaderSize;
+        for (const char* pString : { file, format })
+        {
+            const size_t length = std::strlen(pString);
+            const uint16 count = static_cast<uint16>(length < kMaxSiteStringSize ? length : kMaxSiteStringSize);
+
+            std::memcpy(pRecord + size, &count, sizeof(count));
+            std::memcpy(pRecord + size + sizeof(count), pString, count);
+            size += sizeof(count) + count;
+        }
+
+        return size;
+    }
+
+    size_t BinaryLogger::EncodeSession(char* pRecord, int64 nanoseconds)
+    {
+        pRecord[0] = static_cast<char>(RecordType::Session);
+        std::memcpy(pRecord + 1, &nanoseconds, sizeof(nanoseconds));
+        return kSessionSize;
+    }
+
+    String BinaryLogger::Decode(const char* pData, size_t size)
+    {
+        String text;
+
+        DynamicArray<DecodedSite> sites;
+        DynamicArray<DecodedEvent> events;
+
+        auto flushSession = [&]()
+            {
+                if (!events.IsEmpty())
+                {
+                    Sort(events, [](const DecodedEvent& a, const DecodedEvent& b)
+                        {
+                            return a.nanoseconds != b.nanoseconds ? a.nanoseconds < b.nanoseconds : a.order < b.order;
+                        });
+                }
+
+                for (const DecodedEvent& event : events)
+                {
+                    if (event.siteId >= sites.Count() || sites[event.siteId].format.IsEmpty())
+                    {
+                        continue;
+                    }
+
+                    const DecodedSite& site = sites[event.siteId];
+                    text += Logger::GetInstance().GetTimeStamp(event.nanoseconds / kNanosecondsPerSecond);
+                    text += Logger::GetInstance().GetInfoStamp(site.type, site.line, site.file.ConstBuffer());
+                    text += locFormatMessage(site.format.ConstBuffer(), event.pArgs, event.argsSize);
+                    text += "\n";
+                }
+
+                sites.Clear();
+                events.Clear();
+            };
+
+        size_t offset = 0;
+        while (offset < size)
+        {
+            const RecordType recordType = static_cast<RecordType>(pData[offset]);
+            const char* pRecord = pData + offset;
+            const size_t remaining = size - offset;
+
+            if (recordType == RecordType::Session)
+            {
+                if (remaining < kSessionSize)
+                {
+                    break;
+                }
+                flushSession();
+                offset += kSessionSize;
+            }
+            else if (recordType == RecordType::Site)
+            {
+                if (remaining < kSiteHeaderSize + sizeof(uint16))
+                {
+                    break;
+                }
+
+                const uint32 siteId = locRead<uint32>(pRecord + 1);
+                DecodedSite site;
+                site.type = static_cast<Logger::Type>(pRecord[5]);
+                site.line = locRead<int32>(pRecord + 6);
+
+                size_t recordSize = kSiteHeaderSize;
+                const uint16 fileCount = locRead<uint16>(pRecord + recordSize);
+                recordSize += sizeof(uint16);
+                if (remaining < recordSize + fileCount + sizeof(uint16))
+                {
+                    break;
+                }
+                site.file = String(pRecord + recordSize, fileCount);
+                recordSize += fileCount;
+
+                const uint16 formatCount = locRead<uint16>(pRecord + recordSize);
+                recordSize += sizeof(uint16);
+                if (remaining < recordSize + formatCount)
+                {
+                    break;
+                }
+                site.format = String(pRecord + recordSize, formatCount);
+                recordSize += formatCount;
+
+                while (sites.Count() <= siteId)
+                {
+                    sites.EmplaceBack();
+                }
+                sites[siteId] = Move(site);
+                offset += recordSize;
+            }
+            else if (recordType == RecordType::Event)
+            {
+                if (remaining < kEventHeaderSize)
+                {
+                    break;
+                }
+
+                DecodedEvent event;
+                event.siteId = locRead<uint32>(pRecord + 1);
+                event.nanoseconds = locRead<int64>(pRecord + 5);
+                event.argsSize = locRead<uint16>(pRecord + 13);
+                event.pArgs = pRecord + kEventHeaderSize;
+                event.order = events.Count();
+
+                if (remaining < kEventHeaderSize + event.argsSize)
+                {
+                    break;
+                }
+                events.EmplaceBack(event);
+                offset += kEventHeaderSize + event.argsSize;
+            }
+            else
+            {
+                // Corrupted, nothing after this can be trusted
+                break;
+            }
+        }
+
+        flushSession();
+        return text;
+    }
+
+    bool BinaryLogger::DecodeFile(const File::Path& binaryPath, const File::Path& textPath)
+    {
+        const DynamicArray<char> data = File::ReadBinaryFileArray(binaryPath);
+        if (data.IsEmpty())
+        {
+            return false;
+        }
+
+        return File::WriteTextFile(textPath, Decode(data.ConstBuffer(), data.Count()));
+    }
+
+    int64 BinaryLogger::GetNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    void BinaryLogger::LogFallback(const char* pRecord, size_t size)
+    {
+        const uint32 siteId = locRead<uint32>(pRecord + 1);
+
+        Site site;
+        {
+            LockGuard lock(m_sitesMutex);
+            JPT_ASSERT(siteId < m_sites.Count());
+            site = m_sites[siteId];
+        }
+
+        const String message = locFormatMessage(site.format, pRecord + kEventHeaderSize, size - kEventHeaderSize);
+        Logger::GetInstance().ProcessMessage(site.type, site.line, site.file, message.ConstBuffer());
+    }
+
+    void BinaryLogger::EncodeValue(char* pRecord, size_t& size, ArgType type, const void* pValue, size_t valueSize)
+    {
+        if (size + sizeof(ArgType) + valueSize > kMaxRecordSize)
+        {
+            return;
+        }
+
+        pRecord[size] = static_cast<char>(type);
+        std::memcpy(pRecord + size + sizeof(ArgType), pValue, valueSize);
+        size += sizeof(ArgType) + valueSize;
+    }
+
+    void BinaryLogger::EncodeString(char* pRecord, size_t& size, ArgType type, const void* pChars, size_t charsCount, size_t charSize)
+    {
+        const size_t headerSize = sizeof(ArgType) + sizeof(uint16);
+        if (size + headerSize > kMaxRecordSize)
+        {
+            return;
+        }
+
+        // Truncate to what's left in the record
+        const size_t fittingCount = (kMaxRecordSize - size - headerSize) / charSize;
+        size_t count = charsCount < kMaxStringSize ? charsCount : kMaxStringSize;
+        count = count < fittingCount ? count : fittingCount;
+
+        const uint16 count16 = static_cast<uint16>(count);
+        pRecord[size] = static_cast<char>(type);
+        std::memcpy(pRecord + size + sizeof(ArgType), &count16, sizeof(count16));
+        if (count > 0)
+        {
+            std::memcpy(pRecord + size + headerSize, pChars, count * charSize);
+        }
+        size += headerSize + count * charSize;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Debugging/Logger.h"
+
+#include <chrono>
+#include <cstring>
+#include <cwchar>
+#include <type_traits>
+
+import jpt.DynamicArray;
+import jpt.FilePath;
+import jpt.LogWriter;
+import jpt.Mutex;
+
+namespace jpt
+{
+    /** Logs without formatting on the calling thread. Replaces text logging when built with JPT_BINARY_LOGGING
+        A call site registers its format, file, line and type once. Every log call then only copies the site id, a timestamp and the raw arguments into the LogWriter ring.
+        Decode() turns Log.bin back into today's text format, launch any application with -decode_log="path/to/Log.bin"
+
+        @note   Only string literal formats go binary. Strings passed as arguments are copied, up to kMaxStringSize */
+    class BinaryLogger
+    {
+    public:
+        enum class ArgType : uint8
+        {
+            Int32,
+            UInt32,
+            Int64,
+            UInt64,
+            Float64,
+            String,
+            WString,
+            Pointer,
+            Unsupported,
+        };
+
+        enum class RecordType : uint8
+        {
+            Session,    /**< Site ids restart every run. [int64 nanoseconds] */
+            Site,       /**< [uint32 id][uint8 Logger::Type][int32 line][uint16 size][file][uint16 size][format] */
+            Event,      /**< [uint32 site id][int64 nanoseconds][uint16 size][args: uint8 ArgType + value, strings as uint16 size + chars] */
+        };
+
+        static constexpr size_t kMaxRecordSize = 1024;
+        static constexpr size_t kMaxStringSize = 256;
+        static constexpr size_t kEventHeaderSize = sizeof(RecordType) + sizeof(uint32) + sizeof(int64) + sizeof(uint16);
+
+    private:
+        struct Site
+        {
+            Logger::Type type;
+            int32 line;
+            const char* file;
+            const char* format;
+        };
+
+    private:
+        LogWriter m_writer;
+        DynamicArray<Site> m_sites;     /**< Literals, indexed by site id */
+        Mutex m_sitesMutex;
+
+    public:
+        static BinaryLogger& GetInstance();
+
+        /** Opens Saved/Log.bin. Requires System::Paths */
+        void Init();
+        void Terminate();
+        void Flush();
+
+        /** Called once per call site */
+        uint32 RegisterSite(Logger::Type type, int32 line, const char* file, const char* format);
+
+        template<typename T>
+        uint32 RegisterSite(Logger::Type, int32, const char*, const T&)
+        {
+            JPT_ASSERT(false, "Binary logging needs a string literal format");
+            return 0;
+        }
+
+        template<typename... TArgs>
+        void Log(uint32 siteId, const TArgs&... args);
+
+        /** Writes an event record to pRecord, which must hold kMaxRecordSize bytes
+            @return     Record size */
+        template<typename... TArgs>
+        static size_t EncodeEvent(char* pRecord, uint32 siteId, int64 nanoseconds, const TArgs&... args);
+
+        /** @return     Site record size written to pRecord */
+        static size_t EncodeSite(char* pRecord, uint32 siteId, Logger::Type type, int32 line, const char* file, const char* format);
+
+        /** @return     Session record size written to pRecord */
+        static size_t EncodeSession(char* pRecord, int64 nanoseconds);
+
+        /** Turns binary records into the text Logger writes. Events are sorted by time within each session */
+        static String Decode(const char* pData, size_t size);
+        static bool DecodeFile(const File::Path& binaryPath, const File::Path& textPath);
+
+        static int64 GetNanoseconds();
+
+    private:
+        BinaryLogger() = default;
+
+        /** Formats the event right away through Logger when the writer isn't running */
+        void LogFallback(const char* pRecord, size_t size);
+
+        template<typename T>
+        static void EncodeArg(char* pRecord, size_t& size, const T& arg);
+        static void EncodeValue(char* pRecord, size_t& size, ArgType type, const void* pValue, size_t valueSize);
+        static void EncodeString(char* pRecord, size_t& size, ArgType type, const void* pChars, size_t charsCount, size_t charSize);
+    };
+
+    template<typename... TArgs>
+    void BinaryLogger::Log(uint32 siteId, const TArgs&... args)
+    {
+        char record[kMaxRecordSize];
+        const size_t size = EncodeEvent(record, siteId, GetNanoseconds(), args...);
+
+        if (!m_writer.Push(record, size)) [[unlikely]]
+        {
+            LogFallback(record, size);
+        }
+    }
+
+    template<typename... TArgs>
+    size_t BinaryLogger::EncodeEvent(char* pRecord, uint32 siteId, int64 nanoseconds, const TArgs&... args)
+    {
+        pRecord[0] = static_cast<char>(RecordType::Event);
+        std::memcpy(pRecord + 1, &siteId, sizeof(siteId));
+        std::memcpy(pRecord + 5, &nanoseconds, sizeof(nanoseconds));
+
+        size_t size = kEventHeaderSize;
+        (EncodeArg(pRecord, size, args), ...);
+
+        const uint16 argsSize = static_cast<uint16>(size - kEventHeaderSize);
+        std::memcpy(pRecord + 13, &argsSize, sizeof(argsSize));
+
+        return size;
+    }
+
+    template<typename T>
+    void BinaryLogger::EncodeArg(char* pRecord, size_t& size, const T& arg)
+    {
+        using TArg = std::decay_t<T>;
+
+        if constexpr (std::is_enum_v<TArg>)
+        {
+            EncodeArg(pRecord, size, static_cast<std::underlying_type_t<TArg>>(arg));
+        }
+        else if constexpr (std::is_integral_v<TArg> && sizeof(TArg) <= sizeof(int32))
+        {
+            if constexpr (std::is_signed_v<TArg> || AreSameType<TArg, bool>)
+            {
+                const int32 value = static_cast<int32>(arg);
+                EncodeValue(pRecord, size, ArgType::Int32, &value, sizeof(value));
+            }
+            else
+            {
+                const uint32 value = static_cast<uint32>(arg);
+                EncodeValue(pRecord, size, ArgType::UInt32, &value, sizeof(value));
+            }
+        }
+        else if constexpr (std::is_integral_v<TArg>)
+        {
+            if constexpr (std::is_signed_v<TArg>)
+            {
+                const int64 value = static_cast<int64>(arg);
+                EncodeValue(pRecord, size, ArgType::Int64, &value, sizeof(value));
+            }
+            else
+            {
+                const uint64 value = static_cast<uint64>(arg);
+                EncodeValue(pRecord, size, ArgType::UInt64, &value, sizeof(value));
+            }
+        }
+        else if constexpr (std::is_floating_point_v<TArg>)
+        {
+            const float64 value = static_cast<float64>(arg);
+            EncodeValue(pRecord, size, ArgType::Float64, &value, sizeof(value));
+        }
+        else if constexpr (AreSameType<TArg, const char*> || AreSameType<TArg, char*>)
+        {
+            EncodeString(pRecord, size, ArgType::String, arg, arg ? std::strlen(arg) : 0, sizeof(char));
+        }
+        else if constexpr (AreSameType<TArg, const wchar_t*> || AreSameType<TArg, wchar_t*>)
+        {
+            EncodeString(pRecord, size, ArgType::WString, arg, arg ? std::wcslen(arg) : 0, sizeof(wchar_t));
+        }
+        else if constexpr (std::is_pointer_v<TArg>)
+        {
+            const uint64 value = reinterpret_cast<uintptr>(arg);
+            EncodeValue(pRecord, size, ArgType::Pointer, &value, sizeof(value));
+        }
+        else
+        {
+            EncodeValue(pRecord, size, ArgType::Unsupported, nullptr, 0);
+        }
+    }
+}
\ No newline at end of file
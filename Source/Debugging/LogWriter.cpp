@@ -0,0 +1,261 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Memory/Memory.h"
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+module jpt.LogWriter;
+
+import jpt.FileIO;
+import jpt.LockGuard;
+import jpt.Math;
+
+namespace jpt
+{
+    /** Single-producer single-consumer byte ring. The owning thread appends whole lines, the writer consumes any published range */
+    class LogThreadBuffer
+    {
+    public:
+        static constexpr size_t kCapacity = 64 * 1024;    // Power of two
+        static constexpr size_t kCacheLineSize = 64;
+
+    public:
+        std::thread::id threadId = std::this_thread::get_id();
+
+        alignas(kCacheLineSize) std::atomic<size_t> tail = 0;    /**< Owning thread */
+        alignas(kCacheLineSize) std::atomic<size_t> head = 0;    /**< Writer thread */
+        alignas(kCacheLineSize) char data[kCapacity];
+    };
+
+    static std::atomic<uint64> locNextWriterId = 1;
+
+    /** Ring of the calling thread in the last LogWriter it pushed to */
+    static thread_local uint64 locCachedWriterId = 0;
+    static thread_local LogThreadBuffer* locpCachedBuffer = nullptr;
+    static thread_local bool locIsWriterThread = false;
+
+    LogWriter::LogWriter()
+        : Thread("Log Writer")
+        , m_uniqueId(locNextWriterId.fetch_add(1, std::memory_order_relaxed))
+    {
+    }
+
+    LogWriter::~LogWriter()
+    {
+        Close();
+
+        for (LogThreadBuffer* pBuffer : m_buffers)
+        {
+            JPT_DELETE(pBuffer);
+        }
+    }
+
+    bool LogWriter::Open(const File::Path& path, SerializerMode mode /*= SerializerMode::Append*/)
+    {
+        if (IsRunning())
+        {
+            return true;
+        }
+
+        File::EnsureParentDirExists(path);
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        m_file.Open(path.ConstBuffer(), mode);
+#else
+        m_file.Open(path.GetString<wchar_t>().ConstBuffer(), mode);
+#endif
+        if (!m_file.IsOpen())
+        {
+            return false;
+        }
+
+        m_flushRequestsCount.store(0, std::memory_order_relaxed);
+        m_flushedCount.store(0, std::memory_order_relaxed);
+        m_isRunning.store(true, std::memory_order_release);
+
+        Start();
+        return true;
+    }
+
+    void LogWriter::Close()
+    {
+        if (!m_isRunning.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        Stop();
+        Wake();
+        Join();
+
+        // Lines pushed while the writer was stopping
+        Drain();
+        m_file.Close();
+    }
+
+    bool LogWriter::Push(const char* pData, size_t size)
+    {
+        if (!IsRunning()) [[unlikely]]
+        {
+            return false;
+        }
+
+        LogThreadBuffer& buffer = GetThreadBuffer();
+        size = Min(size, LogThreadBuffer::kCapacity);
+
+        const size_t tail = buffer.tail.load(std::memory_order_relaxed);
+        while (LogThreadBuffer::kCapacity - (tail - buffer.head.load(std::memory_order_acquire)) < size) [[unlikely]]
+        {
+            if (locIsWriterThread || !IsRunning())
+            {
+                return false;
+            }
+
+            Wake();
+            std::this_thread::yield();
+        }
+
+        const size_t offset = tail & (LogThreadBuffer::kCapacity - 1);
+        const size_t firstPartSize = Min(size, LogThreadBuffer::kCapacity - offset);
+        std::memcpy(buffer.data + offset, pData, firstPartSize);
+        std::memcpy(buffer.data, pData + firstPartSize, size - firstPartSize);
+
+        buffer.tail.store(tail + size, std::memory_order_release);
+
+        // Half full, don't wait for the next interval
+        if (tail + size - buffer.head.load(std::memory_order_relaxed) > LogThreadBuffer::kCapacity / 2)
+        {
+            Wake();
+        }
+
+        return true;
+    }
+
+    void LogWriter::Flush()
+    {
+        if (!IsRunning() || locIsWriterThread)
+        {
+            return;
+        }
+
+        // Lines pushed before are published to whichever drain pass observes this request
+        const uint32 request = m_flushRequestsCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+        Wake();
+
+        uint32 flushedCount = m_flushedCount.load(std::memory_order_acquire);
+        while (flushedCount < request)
+        {
+            m_flushedCount.wait(flushedCount, std::memory_order_acquire);
+            flushedCount = m_flushedCount.load(std::memory_order_acquire);
+        }
+    }
+
+    void LogWriter::Init()
+    {
+        locIsWriterThread = true;
+    }
+
+    void LogWriter::Update()
+    {
+        {
+            auto lock = m_wakeMutex.CreateUniqueLock();
+            m_wakeCondition.WaitFor(lock, kFlushIntervalMs, [this]()
+                {
+                    return m_hasWakeRequest.load(std::memory_order_relaxed) || !m_isActive;
+                });
+        }
+        m_hasWakeRequest.store(false, std::memory_order_relaxed);
+
+        const uint32 flushRequestsCount = m_flushRequestsCount.load(std::memory_order_acquire);
+        Drain();
+
+        m_flushedCount.store(flushRequestsCount, std::memory_order_release);
+        m_flushedCount.notify_all();
+    }
+
+    void LogWriter::Terminate()
+    {
+        Drain();
+
+        // Flush() callers that slipped in while closing
+        m_flushedCount.store(std::numeric_limits<uint32>::max(), std::memory_order_release);
+        m_flushedCount.notify_all();
+    }
+
+    LogThreadBuffer& LogWriter::GetThreadBuffer()
+    {
+        if (locCachedWriterId == m_uniqueId) [[likely]]
+        {
+            return *locpCachedBuffer;
+        }
+
+        LockGuard lock(m_buffersMutex);
+
+        locCachedWriterId = m_uniqueId;
+        locpCachedBuffer = nullptr;
+        for (LogThreadBuffer* pBuffer : m_buffers)
+        {
+            if (pBuffer->threadId == std::this_thread::get_id())
+            {
+                locpCachedBuffer = pBuffer;
+                break;
+            }
+        }
+
+        if (!locpCachedBuffer)
+        {
+            locpCachedBuffer = m_buffers.EmplaceBack(JPT_NEW(LogThreadBuffer));
+        }
+
+        return *locpCachedBuffer;
+    }
+
+    void LogWriter::Wake()
+    {
+        // The writer checks the flag under the mutex, so taking it before notifying can't lose the wake up
+        if (!m_hasWakeRequest.exchange(true, std::memory_order_acq_rel))
+        {
+            LockGuard lock(m_wakeMutex);
+            m_wakeCondition.NotifyOne();
+        }
+    }
+
+    void LogWriter::Drain()
+    {
+        bool hasWritten = false;
+
+        {
+            LockGuard lock(m_buffersMutex);
+            for (LogThreadBuffer* pBuffer : m_buffers)
+            {
+                const size_t head = pBuffer->head.load(std::memory_order_relaxed);
+                const size_t tail = pBuffer->tail.load(std::memory_order_acquire);
+                if (head == tail)
+                {
+                    continue;
+                }
+
+                const size_t offset = head & (LogThreadBuffer::kCapacity - 1);
+                const size_t size = tail - head;
+                const size_t firstPartSize = Min(size, LogThreadBuffer::kCapacity - offset);
+                m_file.Write(pBuffer->data + offset, firstPartSize);
+                if (size > firstPartSize)
+                {
+                    m_file.Write(pBuffer->data, size - firstPartSize);
+                }
+
+                pBuffer->head.store(tail, std::memory_order_release);
+                hasWritten = true;
+            }
+        }
+
+        if (hasWritten)
+        {
+            m_file.Flush();
+        }
+    }
+}
\ No newline at end of file
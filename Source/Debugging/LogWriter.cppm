@@ -0,0 +1,82 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <atomic>
+
+export module jpt.LogWriter;
+
+import jpt.ConditionVariable;
+import jpt.DynamicArray;
+import jpt.FilePath;
+import jpt.Mutex;
+import jpt.Serializer;
+import jpt.Thread;
+import jpt.TypeDefs;
+
+namespace jpt
+{
+    class LogThreadBuffer;
+}
+
+export namespace jpt
+{
+    /** Background thread appending log lines to a file that stays open.
+        Every logging thread copies its lines into its own lock-free ring buffer, nothing else happens on the caller's side.
+        The writer drains all rings in one batch per wake up and flushes the file, every kFlushIntervalMs or as soon as a ring fills up
+
+        @note   Never log from inside LogWriter, the writer thread would wait on itself */
+    class LogWriter final : public Thread
+    {
+    public:
+        static constexpr int32 kFlushIntervalMs = 100;
+
+    private:
+        DynamicArray<LogThreadBuffer*> m_buffers;
+        Mutex m_buffersMutex;                       /**< Only taken when a thread logs for the first time and by the writer */
+
+        Serializer m_file;
+
+        Mutex m_wakeMutex;
+        ConditionVariable m_wakeCondition;
+        std::atomic<bool> m_hasWakeRequest = false;
+
+        std::atomic<uint32> m_flushRequestsCount = 0;
+        std::atomic<uint32> m_flushedCount = 0;      /**< Flush requests done so far. Maxed out once closed so no Flush() waits forever */
+
+        std::atomic<bool> m_isRunning = false;
+
+        uint64 m_uniqueId = 0;      /**< Keys the threads' cached ring, an address could be reused by another writer */
+
+    public:
+        LogWriter();
+        ~LogWriter();
+
+        /** Opens path for appending and starts the writer thread */
+        bool Open(const File::Path& path, SerializerMode mode = SerializerMode::Append);
+
+        /** Writes what's left, stops the writer thread and closes the file */
+        void Close();
+
+        /** Copies a line into the calling thread's ring. Waits for the writer only if that ring is full
+            @return     false if the writer isn't running, the caller should write synchronously */
+        bool Push(const char* pData, size_t size);
+
+        /** Blocks until every line pushed before this call is handed to the OS. No-op on the writer thread */
+        void Flush();
+
+        bool IsRunning() const { return m_isRunning.load(std::memory_order_acquire); }
+
+    protected:
+        void Init() override;
+        void Update() override;
+        void Terminate() override;
+
+    private:
+        LogThreadBuffer& GetThreadBuffer();
+        void Wake();
+
+        /** Writes every published line of every ring to the file */
+        void Drain();
+    };
+}
\ No newline at end of file
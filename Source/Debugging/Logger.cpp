@@ -23,7 +23,9 @@ import jpt.FileEnums;
 import jpt.FileIO;
 import jpt.FilePath;
 import jpt.FilePathUtils;
+import jpt.LogWriter;
 import jpt.SystemPaths;
+import jpt.TimeTypeDefs;
 
 import jpt.StringHelpers;
 
@@ -31,6 +33,15 @@ namespace jpt
 {
     static constexpr size_t kMaxMessageSize = 2048;
     static File::Path locLogFilePath = File::Combine(File::Source::Saved, "Log.txt");
+    static LogWriter locLogWriter;
+
+#if IS_PLATFORM_WINDOWS
+    static LONG WINAPI locOnUnhandledException(EXCEPTION_POINTERS*)
+    {
+        Logger::GetInstance().Flush();
+        return EXCEPTION_CONTINUE_SEARCH;
+    }
+#endif
 
     static const char* locGetLogStr(Logger::Type type)
     {
@@ -75,9 +86,14 @@ namespace jpt
 
     String Logger::GetTimeStamp()
     {
-        const DateTime now = Clock::GetCurrentDateTime();
-        const String nowStr = ToString(now) + " - ";
-        return nowStr;
+        return GetTimeStamp(static_cast<int64>(Clock::RawNow()));
+    }
+
+    String Logger::GetTimeStamp(int64 secondsSinceEpoch)
+    {
+        const DateTime time(static_cast<RawTimeType>(secondsSinceEpoch));
+        const String timeStr = ToString(time) + " - ";
+        return timeStr;
     }
 
     void Logger::ProcessMessage(Type type, int32 line, const char* file, const char* pMessage)
@@ -91,10 +107,7 @@ namespace jpt
             SendToOutputWindow(contentToLog.ConstBuffer());
         }
 
-        if (System::Paths::GetInstance().IsInitialized())
-        {
-            File::AppendTextFile(locLogFilePath, GetTimeStamp() + contentToLog);
-        }
+        WriteToFile(type, contentToLog);
     }
 
     void Logger::ProcessMessage(Type type, int32 line, const char* file, const wchar_t* pMessage)
@@ -110,9 +123,23 @@ namespace jpt
             SendToOutputWindow(ContentToLogW.ConstBuffer());
         }
 
-        if (System::Paths::GetInstance().IsInitialized())
+        WriteToFile(type, WStrToStr(ContentToLogW));
+    }
+
+    void Logger::WriteToFile(Type type, const String& contentToLog)
+    {
+        const String line = GetTimeStamp() + contentToLog;
+
+        if (locLogWriter.Push(line.ConstBuffer(), line.Count()))
+        {
+            if (type == Type::Error)
+            {
+                locLogWriter.Flush();
+            }
+        }
+        else if (System::Paths::GetInstance().IsInitialized())
         {
-            File::AppendTextFile(locLogFilePath, GetTimeStamp() + WStrToStr(ContentToLogW));
+            File::AppendTextFile(locLogFilePath, line);
         }
     }
 
@@ -135,4 +162,35 @@ namespace jpt
         static Logger s_logger;
         return s_logger;
     }
+
+    void Logger::Init()
+    {
+        JPT_ASSERT(System::Paths::GetInstance().IsInitialized());
+
+        locLogWriter.Open(locLogFilePath);
+
+#if JPT_BINARY_LOGGING
+        BinaryLogger::GetInstance().Init();
+#endif
+
+#if IS_PLATFORM_WINDOWS
+        ::SetUnhandledExceptionFilter(locOnUnhandledException);
+#endif
+    }
+
+    void Logger::Terminate()
+    {
+#if JPT_BINARY_LOGGING
+        BinaryLogger::GetInstance().Terminate();
+#endif
+        locLogWriter.Close();
+    }
+
+    void Logger::Flush()
+    {
+#if JPT_BINARY_LOGGING
+        BinaryLogger::GetInstance().Flush();
+#endif
+        locLogWriter.Flush();
+    }
 }
\ No newline at end of file
@@ -16,9 +16,13 @@ import jpt.Utilities;
 
 namespace jpt
 {
-    /** Singleton thread-safe logger for different platforms */ 
+    /** Singleton thread-safe logger for different platforms
+        Once Init() ran, file output goes through a background LogWriter. Before that, and after Terminate(), lines are appended synchronously
+        Error logs flush the file before returning, so nothing is lost if the next line crashes */ 
     class Logger
     {
+        friend class BinaryLogger;
+
     public:
         enum class Type : uint8
         {
@@ -40,23 +44,34 @@ namespace jpt
 
         static Logger& GetInstance();
 
+        /** Starts writing the log file in background. Requires System::Paths */
+        void Init();
+        void Terminate();
+
+        /** Blocks until every line logged so far is handed to the OS */
+        void Flush();
+
     private:
         Logger() = default;
 
         String GetInfoStamp(Type type, int32 line, const char* file);
         String GetTimeStamp();
+        String GetTimeStamp(int64 secondsSinceEpoch);
 
         /** Combines stamp, message, line break, then pass to output console */
         void ProcessMessage(Type type, int32 line, const char* file, const char* pMessage);
         void ProcessMessage(Type type, int32 line, const char* file, const wchar_t* pMessage);
 
+        /** Time stamps the line and sends it to the log file */
+        void WriteToFile(Type type, const String& contentToLog);
+
         /** Impl of printing message to output console */
         void SendToOutputWindow(const char* string);
         void SendToOutputWindow(const wchar_t* wideString);
     };
 }
 
-#define JPT_INFO_IMPL(message, type, ...)                                                                                                     \
+#define JPT_TEXT_INFO_IMPL(message, type, ...)                                                                                                \
     if constexpr (jpt::IsStringLiteral<jpt::TRemoveReference<decltype(message)>> ||                                                           \
                   jpt::AreSameType<decltype(message), const char*>)                                                                           \
     {                                                                                                                                         \
@@ -67,6 +82,26 @@ namespace jpt
         jpt::Logger::GetInstance().Log(type,  __LINE__, __FILE__, jpt::ToString(message).ConstBuffer(), __VA_ARGS__);                         \
     }
 
+#if JPT_BINARY_LOGGING
+    /** String literal formats go to BinaryLogger, anything else is formatted as usual */
+    #define JPT_INFO_IMPL(message, type, ...)                                                                                                 \
+        if constexpr (jpt::AreSameType<jpt::TRemoveReference<decltype(message)>, const char[sizeof(message)]>)                               \
+        {                                                                                                                                     \
+            static const uint32 s_jptLogSiteId = jpt::BinaryLogger::GetInstance().RegisterSite(type, __LINE__, __FILE__, message);           \
+            jpt::BinaryLogger::GetInstance().Log(s_jptLogSiteId, __VA_ARGS__);                                                                \
+            if (type == jpt::Logger::Type::Error)                                                                                             \
+            {                                                                                                                                 \
+                jpt::BinaryLogger::GetInstance().Flush();                                                                                     \
+            }                                                                                                                                 \
+        }                                                                                                                                     \
+        else                                                                                                                                  \
+        {                                                                                                                                     \
+            JPT_TEXT_INFO_IMPL(message, type, __VA_ARGS__)                                                                                    \
+        }
+#else
+    #define JPT_INFO_IMPL(message, type, ...) JPT_TEXT_INFO_IMPL(message, type, __VA_ARGS__)
+#endif
+
 #if IS_CONFIG_RELEASE
     #define JPT_DEBUG(...) static_cast<void>(0)
 #else
@@ -103,4 +138,8 @@ namespace jpt
 
 #define JPT_INFO_ONCE(message)    JPT_INFO_ONCE_IMPL(jpt::Logger::Type::Info,  message)
 #define JPT_WARNING_ONCE(message) JPT_INFO_ONCE_IMPL(jpt::Logger::Type::Warn,  message)
-#define JPT_ERROR_ONCE(message)   JPT_INFO_ONCE_IMPL(jpt::Logger::Type::Error, message)
\ No newline at end of file
+#define JPT_ERROR_ONCE(message)   JPT_INFO_ONCE_IMPL(jpt::Logger::Type::Error, message)
+
+#if JPT_BINARY_LOGGING
+    #include "Debugging/BinaryLogger.h"
+#endif
\ No newline at end of file
@@ -0,0 +1,237 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <new>
+
+module jpt.Archetype;
+
+namespace jpt
+{
+    static size_t locAlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    Archetype::Archetype(const DynamicArray<const ComponentInfo*>& componentInfos)
+        : m_componentInfos(componentInfos)
+    {
+        size_t rowSize = sizeof(EntityId);
+        m_signature.Reserve(componentInfos.Count());
+        for (const ComponentInfo* pInfo : componentInfos)
+        {
+            JPT_ASSERT(m_signature.IsEmpty() || m_signature.Back() < pInfo->typeId, "Component infos must be sorted and unique");
+            m_signature.EmplaceBack(pInfo->typeId);
+            rowSize += pInfo->size;
+        }
+
+        // Start from the unpadded estimate, shrink until the aligned columns fit
+        m_columnOffsets.Resize(componentInfos.Count());
+        for (m_rowsPerChunk = kChunkSize / rowSize; m_rowsPerChunk > 0; --m_rowsPerChunk)
+        {
+            size_t offset = m_rowsPerChunk * sizeof(EntityId);
+            for (Index i = 0; i < componentInfos.Count(); ++i)
+            {
+                offset = locAlignUp(offset, componentInfos[i]->alignment);
+                m_columnOffsets[i] = offset;
+                offset += m_rowsPerChunk * componentInfos[i]->size;
+            }
+
+            if (offset <= kChunkSize)
+            {
+                break;
+            }
+        }
+
+        JPT_ASSERT(m_rowsPerChunk > 0, "A single entity's components don't fit in an archetype chunk");
+    }
+
+    Archetype::~Archetype()
+    {
+        for (Chunk& chunk : m_chunks)
+        {
+            for (Index row = 0; row < chunk.count; ++row)
+            {
+                for (Index column = 0; column < m_componentInfos.Count(); ++column)
+                {
+                    m_componentInfos[column]->pDestruct(GetComponentAt(chunk, row, column));
+                }
+            }
+
+            ::operator delete(chunk.pData, std::align_val_t{ kChunkAlignment });
+        }
+    }
+
+    Index Archetype::AddRow(EntityId entityId)
+    {
+        if (m_chunks.IsEmpty() || m_chunks.Back().count == m_rowsPerChunk)
+        {
+            Chunk& chunk = m_chunks.EmplaceBack();
+            chunk.pData = static_cast<uint8*>(::operator new(kChunkSize, std::align_val_t{ kChunkAlignment }));
+        }
+
+        Chunk& chunk = m_chunks.Back();
+        *GetEntityIdAt(chunk, chunk.count) = entityId;
+        ++chunk.count;
+
+        return m_count++;
+    }
+
+    EntityId Archetype::RemoveRow(Index row)
+    {
+        JPT_ASSERT(row < m_count);
+
+        const Chunk& chunk = m_chunks[row / m_rowsPerChunk];
+        const Index rowInChunk = row % m_rowsPerChunk;
+        for (Index column = 0; column < m_componentInfos.Count(); ++column)
+        {
+            m_componentInfos[column]->pDestruct(GetComponentAt(chunk, rowInChunk, column));
+        }
+
+        return FillHole(row);
+    }
+
+    EntityId Archetype::MoveRow(Index row, Archetype& destination, Index& outDestinationRow)
+    {
+        JPT_ASSERT(row < m_count);
+        JPT_ASSERT(&destination != this);
+
+        outDestinationRow = destination.AddRow(GetEntityId(row));
+
+        const Chunk& chunk = m_chunks[row / m_rowsPerChunk];
+        const Index rowInChunk = row % m_rowsPerChunk;
+        for (Index column = 0; column < m_componentInfos.Count(); ++column)
+        {
+            void* pSource = GetComponentAt(chunk, rowInChunk, column);
+
+            const Index destinationColumn = destination.FindColumn(m_signature[column]);
+            if (destinationColumn != kInvalidIndex)
+            {
+                m_componentInfos[column]->pMoveConstruct(destination.GetComponent(outDestinationRow, destinationColumn), pSource);
+            }
+            else
+            {
+                m_componentInfos[column]->pDestruct(pSource);
+            }
+        }
+
+        return FillHole(row);
+    }
+
+    Index Archetype::FindColumn(Id typeId) const
+    {
+        Index low = 0;
+        Index high = m_signature.Count();
+        while (low < high)
+        {
+            const Index middle = (low + high) / 2;
+            if (m_signature[middle] < typeId)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        return (low < m_signature.Count() && m_signature[low] == typeId) ? low : kInvalidIndex;
+    }
+
+    bool Archetype::HasAll(const Id* pTypeIds, size_t count) const
+    {
+        // Both sorted, walk them together
+        Index i = 0;
+        for (Index j = 0; j < count; ++j)
+        {
+            while (i < m_signature.Count() && m_signature[i] < pTypeIds[j])
+            {
+                ++i;
+            }
+
+            if (i == m_signature.Count() || m_signature[i] != pTypeIds[j])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void* Archetype::GetComponent(Index row, Index column)
+    {
+        JPT_ASSERT(row < m_count);
+        return GetComponentAt(m_chunks[row / m_rowsPerChunk], row % m_rowsPerChunk, column);
+    }
+
+    EntityId Archetype::GetEntityId(Index row) const
+    {
+        JPT_ASSERT(row < m_count);
+        return *GetEntityIdAt(m_chunks[row / m_rowsPerChunk], row % m_rowsPerChunk);
+    }
+
+    void* Archetype::GetColumn(Index chunkIndex, Index column)
+    {
+        return m_chunks[chunkIndex].pData + m_columnOffsets[column];
+    }
+
+    const EntityId* Archetype::GetEntityIds(Index chunkIndex) const
+    {
+        return reinterpret_cast<const EntityId*>(m_chunks[chunkIndex].pData);
+    }
+
+    Archetype* Archetype::GetAddEdge(Id typeId) const
+    {
+        const auto itr = m_addEdges.Find(typeId);
+        return itr != m_addEdges.end() ? itr->second : nullptr;
+    }
+
+    Archetype* Archetype::GetRemoveEdge(Id typeId) const
+    {
+        const auto itr = m_removeEdges.Find(typeId);
+        return itr != m_removeEdges.end() ? itr->second : nullptr;
+    }
+
+    EntityId Archetype::FillHole(Index row)
+    {
+        const Index lastRow = m_count - 1;
+        Chunk& lastChunk = m_chunks.Back();
+
+        EntityId movedEntityId = kInvalidEntityId;
+        if (row != lastRow)
+        {
+            const Chunk& chunk = m_chunks[row / m_rowsPerChunk];
+            const Index rowInChunk = row % m_rowsPerChunk;
+            const Index lastRowInChunk = lastChunk.count - 1;
+
+            for (Index column = 0; column < m_componentInfos.Count(); ++column)
+            {
+                m_componentInfos[column]->pMoveConstruct(GetComponentAt(chunk, rowInChunk, column), GetComponentAt(lastChunk, lastRowInChunk, column));
+            }
+
+            movedEntityId = *GetEntityIdAt(lastChunk, lastRowInChunk);
+            *GetEntityIdAt(chunk, rowInChunk) = movedEntityId;
+        }
+
+        --m_count;
+        if (--lastChunk.count == 0)
+        {
+            ::operator delete(lastChunk.pData, std::align_val_t{ kChunkAlignment });
+            m_chunks.Pop();
+        }
+
+        return movedEntityId;
+    }
+
+    void* Archetype::GetComponentAt(const Chunk& chunk, Index rowInChunk, Index column) const
+    {
+        return chunk.pData + m_columnOffsets[column] + rowInChunk * m_componentInfos[column]->size;
+    }
+
+    EntityId* Archetype::GetEntityIdAt(const Chunk& chunk, Index rowInChunk) const
+    {
+        return reinterpret_cast<EntityId*>(chunk.pData) + rowInChunk;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <new>
+
+export module jpt.Archetype;
+
+import jpt.Constants;
+import jpt.DynamicArray;
+import jpt.EntityId;
+import jpt.HashMap_Flat;
+import jpt.TypeDefs;
+import jpt.TypeRegistry;
+import jpt.Utilities;
+
+export namespace jpt
+{
+    /** Type-erased lifetime functions of a component type, so archetypes can move rows without knowing the types */
+    struct ComponentInfo
+    {
+        Id typeId        = 0;
+        size_t size      = 0;
+        size_t alignment = 0;
+        void(*pMoveConstruct)(void* pDestination, void* pSource) = nullptr;   /**< Move-constructs into pDestination, then destroys pSource */
+        void(*pDestruct)(void* pData) = nullptr;
+
+        template<typename TComponent>
+        static const ComponentInfo& Get();
+    };
+
+    /** Sorted component type ids. Identifies an archetype */
+    using ComponentSignature = DynamicArray<Id>;
+
+    /** Stores every entity that has exactly the same set of components.
+        Entities live in fixed size chunks, each chunk is a struct of arrays: one column of EntityIds, then one tightly packed column per component type.
+        Rows are kept dense, removing a row moves the last row of the archetype into the hole.
+
+        @note   Owned by EntityComponentManager. Rows are addressed with a global index: chunkIndex * GetRowsPerChunk() + rowInChunk */
+    class Archetype
+    {
+    public:
+        static constexpr size_t kChunkSize      = 16 * 1024;
+        static constexpr size_t kChunkAlignment = 64;
+
+        struct Chunk
+        {
+            uint8* pData = nullptr;
+            size_t count = 0;
+        };
+
+    private:
+        ComponentSignature m_signature;
+        DynamicArray<const ComponentInfo*> m_componentInfos;   /**< Parallel to m_signature */
+        DynamicArray<size_t> m_columnOffsets;                  /**< Parallel to m_signature. Byte offset of the column inside a chunk */
+        DynamicArray<Chunk> m_chunks;
+        size_t m_rowsPerChunk = 0;
+        size_t m_count = 0;
+
+        // Cached transitions to the archetype with one more, or one less, component
+        HashMap_Flat<Id, Archetype*> m_addEdges;
+        HashMap_Flat<Id, Archetype*> m_removeEdges;
+
+    public:
+        /** @param componentInfos   Sorted by typeId */
+        Archetype(const DynamicArray<const ComponentInfo*>& componentInfos);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        /** Appends a row for entityId. Component memory of the new row is left uninitialized, the caller constructs it
+            @return     Global row index */
+        Index AddRow(EntityId entityId);
+
+        /** Destroys the row's components and fills the hole with the last row
+            @return     The entity that was moved into row, or kInvalidEntityId if row was the last one */
+        EntityId RemoveRow(Index row);
+
+        /** Moves the row's shared components into a new row of destination, destroys the rest, and fills the hole with the last row.
+            Components destination has and this doesn't are left uninitialized
+            @param outDestinationRow    Row of the entity in destination
+            @return     The entity that was moved into row in this archetype, or kInvalidEntityId */
+        EntityId MoveRow(Index row, Archetype& destination, Index& outDestinationRow);
+
+        /** @return     Column index of typeId, or kInvalidIndex if this archetype doesn't have it */
+        Index FindColumn(Id typeId) const;
+        bool Has(Id typeId) const { return FindColumn(typeId) != kInvalidIndex; }
+
+        /** @return     true if every id of the sorted typeIds is part of this archetype */
+        bool HasAll(const Id* pTypeIds, size_t count) const;
+
+        void* GetComponent(Index row, Index column);
+        EntityId GetEntityId(Index row) const;
+
+        /** Column base pointers inside a chunk */
+        void* GetColumn(Index chunkIndex, Index column);
+        const EntityId* GetEntityIds(Index chunkIndex) const;
+
+        const ComponentSignature& GetSignature() const { return m_signature; }
+        const DynamicArray<const ComponentInfo*>& GetComponentInfos() const { return m_componentInfos; }
+        const DynamicArray<Chunk>& GetChunks() const { return m_chunks; }
+        size_t GetRowsPerChunk() const { return m_rowsPerChunk; }
+        size_t Count() const { return m_count; }
+
+        Archetype* GetAddEdge(Id typeId) const;
+        Archetype* GetRemoveEdge(Id typeId) const;
+        void SetAddEdge(Id typeId, Archetype* pArchetype) { m_addEdges[typeId] = pArchetype; }
+        void SetRemoveEdge(Id typeId, Archetype* pArchetype) { m_removeEdges[typeId] = pArchetype; }
+
+    private:
+        /** Moves the last row into row without destroying anything at row. Row's components must already be destroyed or moved out */
+        EntityId FillHole(Index row);
+
+        void* GetComponentAt(const Chunk& chunk, Index rowInChunk, Index column) const;
+        EntityId* GetEntityIdAt(const Chunk& chunk, Index rowInChunk) const;
+    };
+
+    template<typename TComponent>
+    const ComponentInfo& ComponentInfo::Get()
+    {
+        static const ComponentInfo s_info
+        {
+            .typeId         = TypeRegistry::GetId<TComponent>(),
+            .size           = sizeof(TComponent),
+            .alignment      = alignof(TComponent),
+            .pMoveConstruct = [](void* pDestination, void* pSource)
+                {
+                    TComponent* pSourceComponent = static_cast<TComponent*>(pSource);
+                    new (pDestination) TComponent(Move(*pSourceComponent));
+                    pSourceComponent->~TComponent();
+                },
+            .pDestruct      = [](void* pData)
+                {
+                    static_cast<TComponent*>(pData)->~TComponent();
+                }
+        };
+
+        return s_info;
+    }
+}
\ No newline at end of file
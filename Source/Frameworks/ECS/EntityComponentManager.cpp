@@ -0,0 +1,192 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Memory/Memory.h"
+#include "Core/Validation/Assert.h"
+
+module jpt.EntityComponentManager;
+
+namespace jpt
+{
+    EntityComponentManager::EntityComponentManager()
+    {
+        m_archetypes.EmplaceBack(JPT_NEW(Archetype, DynamicArray<const ComponentInfo*>()));
+    }
+
+    EntityComponentManager::~EntityComponentManager()
+    {
+        for (Archetype* pArchetype : m_archetypes)
+        {
+            JPT_DELETE(pArchetype);
+        }
+    }
+
+    void EntityComponentManager::Update(TimePrecision)
+    {
+        LockGuard lock(m_pendingDestroysMutex);
+
+        for (const EntityId& entityId : m_pendingDestroys)
+        {
+            if (IsAlive(entityId))
+            {
+                DestroyEntity(entityId);
+            }
+        }
+        m_pendingDestroys.Clear();
+    }
+
+    void EntityComponentManager::DestroyEntity(EntityId entityId)
+    {
+        JPT_ASSERT(IsAlive(entityId));
+
+        EntityRecord& record = m_records[entityId.index];
+        const EntityId movedEntityId = record.pArchetype->RemoveRow(record.row);
+        if (movedEntityId.IsValid())
+        {
+            OnRowMoved(movedEntityId, record.row);
+        }
+
+        record.pArchetype = nullptr;
+        record.row = kInvalidIndex;
+        ++record.generation;
+
+        m_freeIndices.EmplaceBack(entityId.index);
+        --m_entitiesCount;
+    }
+
+    void EntityComponentManager::DestroyEntityDeferred(EntityId entityId)
+    {
+        LockGuard lock(m_pendingDestroysMutex);
+        m_pendingDestroys.EmplaceBack(entityId);
+    }
+
+    bool EntityComponentManager::IsAlive(EntityId entityId) const
+    {
+        return entityId.index < m_records.Count() &&
+               m_records[entityId.index].generation == entityId.generation &&
+               m_records[entityId.index].pArchetype != nullptr;
+    }
+
+    Archetype* EntityComponentManager::FindOrCreateArchetype(const ComponentInfo* const* ppInfos, size_t count)
+    {
+        for (Archetype* pArchetype : m_archetypes)
+        {
+            const ComponentSignature& signature = pArchetype->GetSignature();
+            if (signature.Count() != count)
+            {
+                continue;
+            }
+
+            bool isMatch = true;
+            for (size_t i = 0; i < count && isMatch; ++i)
+            {
+                isMatch = signature[i] == ppInfos[i]->typeId;
+            }
+
+            if (isMatch)
+            {
+                return pArchetype;
+            }
+        }
+
+        DynamicArray<const ComponentInfo*> infos;
+        infos.Reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            infos.EmplaceBack(ppInfos[i]);
+        }
+
+        return m_archetypes.EmplaceBack(JPT_NEW(Archetype, infos));
+    }
+
+    Archetype* EntityComponentManager::GetArchetypeWith(Archetype& source, const ComponentInfo& info)
+    {
+        if (Archetype* pCached = source.GetAddEdge(info.typeId))
+        {
+            return pCached;
+        }
+
+        DynamicArray<const ComponentInfo*> infos;
+        infos.Reserve(source.GetComponentInfos().Count() + 1);
+        for (const ComponentInfo* pInfo : source.GetComponentInfos())
+        {
+            if (pInfo->typeId > info.typeId && (infos.IsEmpty() || infos.Back()->typeId < info.typeId))
+            {
+                infos.EmplaceBack(&info);
+            }
+            infos.EmplaceBack(pInfo);
+        }
+        if (infos.Count() == source.GetComponentInfos().Count())
+        {
+            infos.EmplaceBack(&info);
+        }
+
+        Archetype* pDestination = FindOrCreateArchetype(infos.ConstBuffer(), infos.Count());
+        source.SetAddEdge(info.typeId, pDestination);
+        pDestination->SetRemoveEdge(info.typeId, &source);
+
+        return pDestination;
+    }
+
+    Archetype* EntityComponentManager::GetArchetypeWithout(Archetype& source, Id typeId)
+    {
+        if (Archetype* pCached = source.GetRemoveEdge(typeId))
+        {
+            return pCached;
+        }
+
+        DynamicArray<const ComponentInfo*> infos;
+        infos.Reserve(source.GetComponentInfos().Count());
+        for (const ComponentInfo* pInfo : source.GetComponentInfos())
+        {
+            if (pInfo->typeId != typeId)
+            {
+                infos.EmplaceBack(pInfo);
+            }
+        }
+
+        Archetype* pDestination = FindOrCreateArchetype(infos.ConstBuffer(), infos.Count());
+        source.SetRemoveEdge(typeId, pDestination);
+        pDestination->SetAddEdge(typeId, &source);
+
+        return pDestination;
+    }
+
+    EntityId EntityComponentManager::AllocateEntityId()
+    {
+        ++m_entitiesCount;
+
+        if (!m_freeIndices.IsEmpty())
+        {
+            const uint32 index = m_freeIndices.Back();
+            m_freeIndices.Pop();
+            return EntityId{ index, m_records[index].generation };
+        }
+
+        m_records.EmplaceBack();
+        return EntityId{ static_cast<uint32>(m_records.Count() - 1), 0 };
+    }
+
+    void EntityComponentManager::OnRowMoved(EntityId movedEntityId, Index row)
+    {
+        m_records[movedEntityId.index].row = row;
+    }
+
+    Index EntityComponentManager::MoveEntity(EntityRecord& record, Archetype& destination)
+    {
+        Index destinationRow = kInvalidIndex;
+        const Index sourceRow = record.row;
+        const EntityId movedEntityId = record.pArchetype->MoveRow(sourceRow, destination, destinationRow);
+
+        record.pArchetype = &destination;
+        record.row = destinationRow;
+
+        if (movedEntityId.IsValid())
+        {
+            OnRowMoved(movedEntityId, sourceRow);
+        }
+
+        return destinationRow;
+    }
+}
\ No newline at end of file
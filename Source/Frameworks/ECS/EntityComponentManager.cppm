@@ -1,25 +1,310 @@
 // Copyright Jupiter Technologies, Inc. All Rights Reserved.
 
+module;
+
+#include "Core/Validation/Assert.h"
+
+#include <new>
+#include <utility>
+
 export module jpt.EntityComponentManager;
 
+import jpt.Archetype;
 import jpt.EntityComponent;
+import jpt.EntityId;
 
+import jpt.Constants;
+import jpt.DynamicArray;
+import jpt.JobSystem;
+import jpt.LockGuard;
+import jpt.Mutex;
+import jpt.TimeTypeDefs;
 import jpt.TypeDefs;
+import jpt.TypeRegistry;
+import jpt.TypeTraits;
+import jpt.Utilities;
 
 export namespace jpt
 {
-    /** Manages all entity components in current scene */
+    /** Manages all entity components in current scene.
+        Components are plain structs stored in archetype chunks (see Archetype), keyed by TypeRegistry::GetId<T>().
+        Queries walk every archetype that has the requested components, chunk by chunk, over contiguous columns.
+
+        @note   Adding or removing components moves the entity to another archetype. Don't change an entity's components, create or destroy entities while iterating a query, use DestroyEntityDeferred()
+
+        @example
+            struct Position { Vec3f value; };
+            struct Velocity { Vec3f value; };
+
+            jpt::EntityId entity = manager.CreateEntity(Position{}, Velocity{ Vec3f(1, 0, 0) });
+
+            manager.ForEach<Position, const Velocity>([deltaSeconds](Position& position, const Velocity& velocity)
+                {
+                    position.value += velocity.value * deltaSeconds;
+                }); */
     class EntityComponentManager
     {
     private:
+        struct EntityRecord
+        {
+            Archetype* pArchetype = nullptr;
+            Index row = kInvalidIndex;
+            uint32 generation = 0;
+        };
 
+    private:
+        DynamicArray<Archetype*> m_archetypes;      /**< [0] is the archetype without components */
+        DynamicArray<EntityRecord> m_records;       /**< Indexed by EntityId::index */
+        DynamicArray<uint32> m_freeIndices;
+        DynamicArray<EntityId> m_pendingDestroys;
+        Mutex m_pendingDestroysMutex;
+        size_t m_entitiesCount = 0;
 
     public:
+        EntityComponentManager();
+        ~EntityComponentManager();
+
+        EntityComponentManager(const EntityComponentManager&) = delete;
+        EntityComponentManager& operator=(const EntityComponentManager&) = delete;
+
+        /** Destroys the entities queued with DestroyEntityDeferred() */
         void Update(TimePrecision deltaSeconds);
+
+        // Entities
+        template<typename... TComponents>
+        EntityId CreateEntity(TComponents&&... components);
+        void DestroyEntity(EntityId entityId);
+        void DestroyEntityDeferred(EntityId entityId);   /**< Thread safe */
+        bool IsAlive(EntityId entityId) const;
+
+        // Components
+        template<typename TComponent, typename... TArgs>
+        TComponent& AddComponent(EntityId entityId, TArgs&&... args);
+
+        template<typename TComponent>
+        void RemoveComponent(EntityId entityId);
+
+        /** @return     nullptr if the entity is dead or doesn't have the component. Invalidated by any structural change */
+        template<typename TComponent>
+        TComponent* GetComponent(EntityId entityId);
+
+        template<typename TComponent>
+        bool HasComponent(EntityId entityId) const;
+
+        // Queries
+        /** Calls function(TComponents&...) or function(EntityId, TComponents&...) for every entity having all TComponents.
+            Declare read-only components const, e.g. ForEach<Position, const Velocity> */
+        template<typename... TComponents, typename TFunction>
+        void ForEach(TFunction&& function);
+
+        /** ForEach() with the matching chunks spread over the JobSystem. Returns once every entity was visited
+            @note   function is called concurrently from several threads, on different entities
+            @param chunksPerJob     Chunks a single job iterates. Raise it when the per-entity work is tiny */
+        template<typename... TComponents, typename TFunction>
+        void ParallelForEach(TFunction&& function, size_t chunksPerJob = 1);
+
+        /** Calls function(size_t count, const EntityId* pEntityIds, TComponents*... pColumns) once per matching chunk.
+            Columns are contiguous arrays of count components */
+        template<typename... TComponents, typename TFunction>
+        void ForEachChunk(TFunction&& function);
+
+        size_t GetEntitiesCount() const { return m_entitiesCount; }
+        const DynamicArray<Archetype*>& GetArchetypes() const { return m_archetypes; }
+
+    private:
+        /** @param ppInfos  Sorted by typeId */
+        Archetype* FindOrCreateArchetype(const ComponentInfo* const* ppInfos, size_t count);
+        Archetype* GetArchetypeWith(Archetype& source, const ComponentInfo& info);
+        Archetype* GetArchetypeWithout(Archetype& source, Id typeId);
+
+        EntityId AllocateEntityId();
+
+        /** Points the record of an entity that an archetype moved to a new row */
+        void OnRowMoved(EntityId movedEntityId, Index row);
+
+        /** Moves the entity to destination and updates records
+            @return     The entity's row in destination */
+        Index MoveEntity(EntityRecord& record, Archetype& destination);
+
+        template<typename... TComponents, typename TFunction>
+        static void ForEachRow(TFunction& function, size_t count, const EntityId* pEntityIds, TComponents*... pColumns);
+
+        template<typename... TComponents, typename TFunction, size_t... kIndices>
+        static void InvokeChunk(TFunction& function, Archetype& archetype, Index chunkIndex, const Index* pColumns, std::index_sequence<kIndices...>);
     };
 
-    void EntityComponentManager::Update(TimePrecision)
+    template<typename TComponent>
+    Id GetComponentId()
+    {
+        return TypeRegistry::GetId<TRemoveConst<TComponent>>();
+    }
+
+    template<typename... TComponents>
+    EntityId EntityComponentManager::CreateEntity(TComponents&&... components)
+    {
+        // + 1 keeps the array valid for entities without components
+        const ComponentInfo* infos[sizeof...(TComponents) + 1] = { &ComponentInfo::Get<TDecay<TComponents>>()..., nullptr };
+        for (size_t i = 1; i < sizeof...(TComponents); ++i)
+        {
+            for (size_t j = i; j > 0 && infos[j - 1]->typeId > infos[j]->typeId; --j)
+            {
+                Swap(infos[j - 1], infos[j]);
+            }
+        }
+
+        Archetype* pArchetype = FindOrCreateArchetype(infos, sizeof...(TComponents));
+
+        const EntityId entityId = AllocateEntityId();
+        const Index row = pArchetype->AddRow(entityId);
+        m_records[entityId.index].pArchetype = pArchetype;
+        m_records[entityId.index].row = row;
+
+        ((new (pArchetype->GetComponent(row, pArchetype->FindColumn(GetComponentId<TDecay<TComponents>>()))) TDecay<TComponents>(Forward<TComponents>(components))), ...);
+
+        return entityId;
+    }
+
+    template<typename TComponent, typename... TArgs>
+    TComponent& EntityComponentManager::AddComponent(EntityId entityId, TArgs&&... args)
     {
+        JPT_ASSERT(IsAlive(entityId));
 
+        EntityRecord& record = m_records[entityId.index];
+        const Id typeId = GetComponentId<TComponent>();
+
+        Index column = record.pArchetype->FindColumn(typeId);
+        if (column != kInvalidIndex)
+        {
+            // Already has it, replace
+            TComponent* pComponent = static_cast<TComponent*>(record.pArchetype->GetComponent(record.row, column));
+            *pComponent = TComponent(Forward<TArgs>(args)...);
+            return *pComponent;
+        }
+
+        Archetype* pDestination = GetArchetypeWith(*record.pArchetype, ComponentInfo::Get<TComponent>());
+        const Index row = MoveEntity(record, *pDestination);
+
+        column = pDestination->FindColumn(typeId);
+        return *new (pDestination->GetComponent(row, column)) TComponent(Forward<TArgs>(args)...);
+    }
+
+    template<typename TComponent>
+    void EntityComponentManager::RemoveComponent(EntityId entityId)
+    {
+        JPT_ASSERT(IsAlive(entityId));
+
+        EntityRecord& record = m_records[entityId.index];
+        const Id typeId = GetComponentId<TComponent>();
+        if (!record.pArchetype->Has(typeId))
+        {
+            return;
+        }
+
+        MoveEntity(record, *GetArchetypeWithout(*record.pArchetype, typeId));
+    }
+
+    template<typename TComponent>
+    TComponent* EntityComponentManager::GetComponent(EntityId entityId)
+    {
+        if (!IsAlive(entityId))
+        {
+            return nullptr;
+        }
+
+        const EntityRecord& record = m_records[entityId.index];
+        const Index column = record.pArchetype->FindColumn(GetComponentId<TComponent>());
+        return column != kInvalidIndex ? static_cast<TComponent*>(record.pArchetype->GetComponent(record.row, column)) : nullptr;
+    }
+
+    template<typename TComponent>
+    bool EntityComponentManager::HasComponent(EntityId entityId) const
+    {
+        return IsAlive(entityId) && m_records[entityId.index].pArchetype->Has(GetComponentId<TComponent>());
+    }
+
+    template<typename... TComponents, typename TFunction>
+    void EntityComponentManager::ForEach(TFunction&& function)
+    {
+        ForEachChunk<TComponents...>([&function](size_t count, const EntityId* pEntityIds, TComponents*... pColumns)
+            {
+                ForEachRow<TComponents...>(function, count, pEntityIds, pColumns...);
+            });
+    }
+
+    template<typename... TComponents, typename TFunction>
+    void EntityComponentManager::ParallelForEach(TFunction&& function, size_t chunksPerJob)
+    {
+        struct ChunkColumns
+        {
+            size_t count = 0;
+            const EntityId* pEntityIds = nullptr;
+            const void* pColumns[sizeof...(TComponents)];
+        };
+
+        DynamicArray<ChunkColumns> chunks;
+        ForEachChunk<TComponents...>([&chunks](size_t count, const EntityId* pEntityIds, TComponents*... pColumns)
+            {
+                chunks.EmplaceBack(ChunkColumns{ count, pEntityIds, { pColumns... } });
+            });
+
+        JobSystem::GetInstance().ParallelFor(chunks.Count(), chunksPerJob, [&function, &chunks](size_t i)
+            {
+                const ChunkColumns& chunk = chunks[i];
+                [&]<size_t... kIndices>(std::index_sequence<kIndices...>)
+                {
+                    ForEachRow<TComponents...>(function, chunk.count, chunk.pEntityIds, static_cast<TComponents*>(const_cast<void*>(chunk.pColumns[kIndices]))...);
+                }(std::index_sequence_for<TComponents...>{});
+            });
+    }
+
+    template<typename... TComponents, typename TFunction>
+    void EntityComponentManager::ForEachChunk(TFunction&& function)
+    {
+        static_assert(sizeof...(TComponents) > 0, "Query at least one component");
+
+        Id typeIds[] = { GetComponentId<TComponents>()... };
+        for (size_t i = 1; i < sizeof...(TComponents); ++i)
+        {
+            for (size_t j = i; j > 0 && typeIds[j - 1] > typeIds[j]; --j)
+            {
+                Swap(typeIds[j - 1], typeIds[j]);
+            }
+        }
+
+        for (Archetype* pArchetype : m_archetypes)
+        {
+            if (pArchetype->Count() == 0 || !pArchetype->HasAll(typeIds, sizeof...(TComponents)))
+            {
+                continue;
+            }
+
+            const Index columns[] = { pArchetype->FindColumn(GetComponentId<TComponents>())... };
+            for (Index chunkIndex = 0; chunkIndex < pArchetype->GetChunks().Count(); ++chunkIndex)
+            {
+                InvokeChunk<TComponents...>(function, *pArchetype, chunkIndex, columns, std::index_sequence_for<TComponents...>{});
+            }
+        }
+    }
+
+    template<typename... TComponents, typename TFunction>
+    void EntityComponentManager::ForEachRow(TFunction& function, size_t count, const EntityId* pEntityIds, TComponents*... pColumns)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if constexpr (requires { function(pEntityIds[i], pColumns[i]...); })
+            {
+                function(pEntityIds[i], pColumns[i]...);
+            }
+            else
+            {
+                function(pColumns[i]...);
+            }
+        }
+    }
+
+    template<typename... TComponents, typename TFunction, size_t... kIndices>
+    void EntityComponentManager::InvokeChunk(TFunction& function, Archetype& archetype, Index chunkIndex, const Index* pColumns, std::index_sequence<kIndices...>)
+    {
+        function(archetype.GetChunks()[chunkIndex].count, archetype.GetEntityIds(chunkIndex), static_cast<TComponents*>(archetype.GetColumn(chunkIndex, pColumns[kIndices]))...);
     }
 }
\ No newline at end of file
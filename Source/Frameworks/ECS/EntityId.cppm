@@ -0,0 +1,24 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.EntityId;
+
+import jpt.Constants;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Handle to an entity owned by an EntityComponentManager.
+        The index is recycled when the entity is destroyed, the generation is bumped at the same time, so a stale handle never resolves to the new owner of its slot */
+    struct EntityId
+    {
+        uint32 index      = kInvalidValue<uint32>;
+        uint32 generation = 0;
+
+        constexpr bool IsValid() const { return index != kInvalidValue<uint32>; }
+        constexpr uint64 GetValue() const { return (static_cast<uint64>(generation) << 32) | index; }
+
+        constexpr bool operator==(const EntityId& other) const = default;
+    };
+
+    constexpr EntityId kInvalidEntityId = {};
+}
\ No newline at end of file
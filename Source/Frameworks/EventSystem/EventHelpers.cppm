@@ -1,12 +1,16 @@
 // Copyright Jupiter Technologies, Inc. All Rights Reserved.
 
+module;
+
+#include <atomic>
+
 export module jpt_private.EventHelpers;
 
 import jpt.Constants;
 import jpt.DynamicArray;
 import jpt.Event;
 import jpt.Function;
-import jpt.HashMap;
+import jpt.LockFreeQueue_SPSC;
 import jpt.TypeDefs;
 
 export namespace jpt_private
@@ -17,21 +21,89 @@ export namespace jpt_private
         // The function to call
         jpt::Function<void(const jpt::Event&)> func;  /**< Could be global or member or local lambda */
         const void* pContext = nullptr;               /**< class instance if func is it's member function. Memory address if func is a global function. nullptr if func is lambda */
-        
+
         // Search and identification
-        size_t Id = kInvalidId; /**< Unique ID for this handler */
-        bool isActive = true;   /**< Whether this handler is active (for lazy deletion) */
+        uint32 slotIndex = jpt::kInvalidValue<uint32>; /**< Handle slot pointing back at this function */
+        bool isActive = true;                          /**< false once unregistered during a dispatch, erased when the dispatch ends */
+    };
+
+    /** Where the function of a handle lives. Slots are recycled with a new generation so stale handles don't match */
+    struct HandleSlot
+    {
+        Id eventId        = kInvalidId;
+        uint32 index      = 0;        /**< Index in the functions of eventId, or in the deferred functions */
+        uint32 generation = 0;
+        bool isDeferred   = false;    /**< Registered during a dispatch, not added to the functions of eventId yet */
+    };
+
+    /** Registered during a dispatch. Added once the outermost dispatch is done, so the functions being called never move */
+    struct DeferredFunction
+    {
+        Id eventId = kInvalidId;
+        EventFunction function;
+    };
+
+    /** Event sent on the next Update */
+    struct QueuedEvent
+    {
+        jpt::Event* pEvent = nullptr;
+        void* pMemory = nullptr;  /**< Pooled allocation holding the event. nullptr if it's in a frame arena */
+        Id eventId = kInvalidId;
+        uint64 sequence = 0;      /**< Queue order across all threads */
+
+        bool operator<(const QueuedEvent& other) const { return sequence < other.sequence; }
     };
 
-    /** Queued event to be sent later */
-    struct PendingEvent
+    /** Event queued by a thread other than the EventManager's, waiting in that thread's queue for the next Update */
+    struct PostedEvent
     {
-        jpt::Event* pEvent = nullptr;   /**< Event to be sent */
-        Id eventId = kInvalidId;        /**< Id of the event. Used for getting the right EventFunction */
-        TimePrecision m_timer = 0.0;    /**< Timer to delay the event. 0.0 means next frame */
+        jpt::Event* pEvent = nullptr;
+        void* pMemory = nullptr;
+        Id eventId = kInvalidId;
+        uint64 sequence = 0;
+        TimePrecision timer = 0.0f;
     };
 
-    using EventFunctions = jpt::DynamicArray<EventFunction>;  /**< Array of functions to be called when an event is triggered */
-    using FunctionsMap   = jpt::HashMap<Id, EventFunctions>;  /**< Key: Event Id. Value: The functions array that are registered to this event */
-    using EventQueue     = jpt::DynamicArray<PendingEvent>;   /**< Queued events to be sent later */
+    /** Event waiting for its timer */
+    struct DelayedEvent
+    {
+        jpt::Event* pEvent = nullptr;
+        void* pMemory = nullptr;  /**< Allocation holding the event. Differs from pEvent if Event isn't its first base */
+        Id eventId = kInvalidId;
+        float64 dueTime = 0.0;    /**< EventManager time to send it at */
+        uint64 sequence = 0;      /**< Queue order, breaks ties of the same due time */
+
+        /** Earliest first, then in queue order */
+        bool operator<(const DelayedEvent& other) const
+        {
+            return dueTime < other.dueTime || (dueTime == other.dueTime && sequence < other.sequence);
+        }
+    };
+
+    using EventFunctions = jpt::DynamicArray<EventFunction>;     /**< Array of functions to be called when an event is triggered */
+    using FunctionsTable = jpt::DynamicArray<EventFunctions>;    /**< Indexed by event Id from TypeRegistry */
+    using EventQueue     = jpt::DynamicArray<QueuedEvent>;       /**< Queued events to be sent next Update */
+
+    /** Filled by one thread, drained by the EventManager's. Handed to another thread once its own has exited and it's drained */
+    struct ThreadQueue
+    {
+        jpt::LockFreeQueue_SPSC<PostedEvent> events;
+        std::atomic<bool> isOrphaned = false;    /**< Its thread has exited. Release: every event it pushed is visible */
+
+        explicit ThreadQueue(size_t capacity) : events(capacity) {}
+    };
+
+    /** thread_local link to the calling thread's queue. Orphans the queue when the thread exits */
+    struct ThreadQueueOwner
+    {
+        ThreadQueue* pQueue = nullptr;
+
+        ~ThreadQueueOwner()
+        {
+            if (pQueue)
+            {
+                pQueue->isOrphaned.store(true, std::memory_order_release);
+            }
+        }
+    };
 }
\ No newline at end of file
@@ -4,14 +4,27 @@ module;
 
 #include "Core/Memory/Memory.h"
 #include "Core/Minimal/Utilities.h"
+#include "Core/Validation/Assert.h"
 #include "Debugging/Logger.h"
 
+#include <atomic>
+#include <new>
+#include <thread>
+
 export module jpt.EventManager;
 
+import jpt.Concepts;
 import jpt.Constants;
 import jpt.DynamicArray;
 import jpt.Function;
-import jpt.HashMap;
+import jpt.Heap;
+import jpt.JobSystem;
+import jpt.LinearArena;
+import jpt.LockGuard;
+import jpt.Mutex;
+import jpt.SizeClassAllocator;
+import jpt.Sort;
+import jpt.TypeDefs;
 import jpt.TypeTraits;
 import jpt.TypeRegistry;
 import jpt.Utilities;
@@ -22,17 +35,72 @@ import jpt_private.EventHelpers;
 
 export namespace jpt
 {
+    /** Sends events to the functions registered to their type.
+        Functions are kept in one dense array per event type, indexed by TypeRegistry::GetId<TEvent>(), so Send is an index and a loop.
+        Handles go through a slot map: unregistering is O(1), and the last function takes the place of the removed one,
+        so functions of an event are called in no particular order.
+        Functions registered or unregistered while an event is being sent take effect once the outermost Send is done.
+
+        Queue copies the event by value. Events sent next Update go to a frame arena, double buffered so events queued by handlers wait for the next Update.
+        Delayed events go to a pooled allocation and a timer heap, and are sent in due time order after the frame events
+
+        Queue is thread-safe. Other threads push to their own lock-free queue, drained at the beginning of the next Update.
+        A thread's queue is recycled once the thread has exited and its events are drained, short-lived threads don't pile queues up.
+        Every Queue call takes a ticket from one atomic sequence, the events of an Update are sent in ticket order whatever thread queued them.
+        Register, Unregister, Send and Update belong to the thread that created the EventManager, normally the main thread
+
+        @example
+            EventHandle handle = EventManager::GetInstance().Register<Event_Key>(this, &Camera::OnKey);
+            EventManager::GetInstance().Queue(Event_Window_Close{ pWindow });
+            EventManager::GetInstance().Unregister(handle); */
     class EventManager
     {
         JPT_DECLARE_SINGLETON(EventManager);
-        
+
+    public:
+        static constexpr size_t kFrameArenaCapacity = 64 * 1024;
+        static constexpr size_t kThreadQueueCapacity = 4096;     /**< Per thread. Past this, events go to a locked overflow list until the next Update */
+        static constexpr size_t kDrainBatchSize      = 64;
+        static constexpr size_t kParallelBatchSize   = 16;       /**< Events per job when sending in parallel */
+
     private:
-        jpt_private::FunctionsMap m_functionsMap;  /**< Map from event Ids to handlers */
-        jpt_private::EventQueue   m_eventQueue;    /**< Queue of events to be sent later */
+        using EventFunc = Function<void(const Event&)>;
 
-        Id m_handleId = 0;  /**< Counter for generating unique handle IDs */
+    private:
+        jpt_private::FunctionsTable m_functionsTable;               /**< Index: event Id. Functions registered to it */
+        DynamicArray<jpt_private::HandleSlot> m_handleSlots;
+        DynamicArray<uint32> m_freeHandleSlots;
+
+        // Changes made during a dispatch
+        DynamicArray<jpt_private::DeferredFunction> m_deferredFunctions;
+        DynamicArray<uint32> m_deferredUnregisters;                 /**< Handle slots of functions unregistered during a dispatch */
+        uint32 m_dispatchDepth = 0;                                 /**< Nested Send calls in progress */
+
+        // Queued events
+        LinearArena m_frameArenas[2] = { LinearArena(kFrameArenaCapacity), LinearArena(kFrameArenaCapacity) };
+        jpt_private::EventQueue m_frameQueues[2];
+        uint32 m_queueIndex = 0;                                    /**< Frame queue receiving new events */
+        std::atomic<uint64> m_sequence = 0;                         /**< Tickets of Queue calls, from every thread */
+
+        Heap<jpt_private::DelayedEvent> m_delayedEvents;
+        float64 m_time = 0.0;                                       /**< Accumulated Update time. float64, it never resets */
+
+        // Other threads
+        std::thread::id m_ownerThreadId = std::this_thread::get_id();
+        DynamicArray<jpt_private::ThreadQueue*> m_threadQueues;     /**< Drained each Update. Live threads, and exited ones with events left */
+        DynamicArray<jpt_private::ThreadQueue*> m_freeThreadQueues; /**< Drained queues of exited threads, waiting for a new thread */
+        Mutex m_threadQueuesMutex;                                  /**< Only taken when a thread queues for the first time, and by Update */
+        DynamicArray<jpt_private::PostedEvent> m_overflowEvents;    /**< Queued while the thread's queue was full. Never blocking matters, the owner may be waiting on that thread */
+        Mutex m_overflowMutex;
+        static inline thread_local jpt_private::ThreadQueueOwner s_threadQueueOwner;
+
+        // Parallel dispatch
+        DynamicArray<bool> m_parallelTypes;                         /**< Index: event Id */
+        DynamicArray<const jpt_private::QueuedEvent*> m_parallelEvents;
 
     public:
+        ~EventManager();
+
         /** Register a member function to event */
         template<typename TEvent, typename TListener>
         EventHandle Register(TListener* pListener, void(TListener::* pMemberFunction)(const TEvent&));
@@ -56,25 +124,63 @@ export namespace jpt
         template<typename TEvent>
         void Send(const TEvent& event);
 
-        /** Queue an event to be sent later */
+        /** Queue a copy of the event to be sent later. Thread-safe
+            @param timer    Seconds to wait. 0.0 sends it on the next Update. From other threads, counts from the Update that drains it */
         template<typename TEvent>
         void Queue(const TEvent& event, TimePrecision timer = 0.0);
 
+        /** Sends the queued TEvents on the JobSystem workers, in parallel and in no particular order, after the other events of the Update
+            @note   Functions of TEvent must be thread-safe, and must not register, unregister nor send. Queuing is fine */
+        template<typename TEvent>
+        void SetParallelDispatch(bool isParallel = true);
+
         /** @return true if handle is listening to an event, false if not */
         template<typename TEvent, Functional TListener>
         bool IsListening(const TListener* pListener) const;
 
         bool IsListening(EventHandle eventHandle) const;
 
-        /** Process all events in the queue */
+        /** Sends the frame events queued before this call, then the delayed events that are due */
         void Update(TimePrecision deltaSeconds);
 
         /** Clears all remaining events */
         void Terminate();
 
+        /** @return     Whether the calling thread created the EventManager */
+        bool IsOwnerThread() const;
+
     private:
-        template<typename TEvent>       jpt_private::EventFunctions& GetFunctions();
-        template<typename TEvent> const jpt_private::EventFunctions& GetFunctions() const;
+        EventHandle Add(Id eventId, const void* pContext, EventFunc&& func);
+        void Dispatch(Id eventId, const Event& event);
+
+        /** Erases now, or defers to the end of the current dispatch */
+        void UnregisterSlot(uint32 slotIndex);
+        void Erase(Id eventId, uint32 index);
+        void FlushDeferred();
+
+        uint32 AcquireSlot();
+        void ReleaseSlot(uint32 slotIndex);
+
+        /** @return     Slot of a handle, nullptr if the handle was unregistered or never registered */
+        const jpt_private::HandleSlot* FindSlot(EventHandle eventHandle) const;
+        const jpt_private::EventFunction& GetFunction(const jpt_private::HandleSlot& slot) const;
+
+        /** Grows the table up to eventId */
+        jpt_private::EventFunctions& GetFunctions(Id eventId);
+
+        /** @return     nullptr if nothing was ever registered to eventId */
+        const jpt_private::EventFunctions* FindFunctions(Id eventId) const;
+
+        /** Moves the events other threads queued to frameQueue, and to the timer heap. Recycles the queues of exited threads */
+        void DrainThreadQueues(jpt_private::EventQueue& frameQueue);
+        void ReceivePosted(const jpt_private::PostedEvent& event, jpt_private::EventQueue& frameQueue);
+        jpt_private::ThreadQueue& GetThreadQueue();
+
+        void DispatchParallel();
+        bool IsParallel(Id eventId) const;
+
+        void Release(Event* pEvent, void* pMemory);
+        void ClearQueues();
     };
 
     template<typename TEvent, typename TListener>
@@ -85,68 +191,53 @@ export namespace jpt
                 (pListener->*pMemberFunction)(static_cast<const TEvent&>(event));
             };
 
-        jpt_private::EventFunction& eventFunction = GetFunctions<TEvent>().EmplaceBack();
-        eventFunction.func     = Move(handlerFunc);
-        eventFunction.pContext = pListener;
-        eventFunction.Id       = m_handleId++;
-        
-        const Id eventId = TypeRegistry::GetId<TEvent>();
-        return EventHandle(eventId, eventFunction.Id);
+        return Add(TypeRegistry::GetId<TEvent>(), pListener, Move(handlerFunc));
     }
 
-   template<typename TEvent, typename THandlerFunc>
-   EventHandle EventManager::Register(THandlerFunc&& func)
-   {
-       // Lambda wrapper to call the function
+    template<typename TEvent, typename THandlerFunc>
+    EventHandle EventManager::Register(THandlerFunc&& func)
+    {
+        // Lambda wrapper to call the function
         auto handlerFunc = [func](const Event& event)
-           {
-               func(static_cast<const TEvent&>(event));
-           };
-
-        jpt_private::EventFunction& eventFunction = GetFunctions<TEvent>().EmplaceBack();
-        eventFunction.func     = Move(handlerFunc);
-        eventFunction.Id       = m_handleId++;
+            {
+                func(static_cast<const TEvent&>(event));
+            };
 
+        const void* pContext = nullptr;   // Lambda has no context
         if constexpr (IsFunction<TRemovePointer<TRemoveReference<THandlerFunc>>>)
         {
             // Global function
             using FuncPtr = void(*)(const TEvent&);
             FuncPtr fptr = func;
-            eventFunction.pContext = reinterpret_cast<void*>(fptr);
+            pContext = reinterpret_cast<void*>(fptr);
         }
-        else
-        {
-            // Lambda has no context
-            eventFunction.pContext = nullptr; 
-        }
-        
-        const Id eventId = TypeRegistry::GetId<TEvent>();
-        return EventHandle(eventId, eventFunction.Id);
-   }
-
-   template<typename TEvent, Functional TListener>
-   void EventManager::Unregister(TListener* pListener)
-   {
-       jpt_private::EventFunctions& functions = GetFunctions<TEvent>();
-
-       for (int32 i = static_cast<int32>(functions.Count()) - 1; i >= 0; --i)
-       {
-           if (functions[i].pContext == pListener)
-           {
-               functions.Erase(i);
-           }
-       }
-   }
 
-    void EventManager::Unregister(EventHandle eventHandle)
+        return Add(TypeRegistry::GetId<TEvent>(), pContext, Move(handlerFunc));
+    }
+
+    template<typename TEvent, Functional TListener>
+    void EventManager::Unregister(TListener* pListener)
     {
-        jpt_private::EventFunctions& functions = m_functionsMap[eventHandle.eventId];
+        const Id eventId = TypeRegistry::GetId<TEvent>();
+
+        if (const jpt_private::EventFunctions* pFunctions = FindFunctions(eventId))
+        {
+            // Backwards, erasing moves the last function in place
+            for (size_t i = pFunctions->Count(); i > 0; --i)
+            {
+                const jpt_private::EventFunction& function = (*pFunctions)[i - 1];
+                if (function.isActive && function.pContext == pListener)
+                {
+                    UnregisterSlot(function.slotIndex);
+                }
+            }
+        }
 
-        for (int32 i = static_cast<int32>(functions.Count()) - 1; i >= 0; --i)
+        for (jpt_private::DeferredFunction& deferred : m_deferredFunctions)
         {
-            if (functions[i].Id == eventHandle.functionId)
+            if (deferred.eventId == eventId && deferred.function.pContext == pListener)
             {
-                functions.Erase(i);
+                deferred.function.isActive = false;
             }
         }
     }
@@ -154,32 +245,103 @@ export namespace jpt
     template<typename TEvent>
     void EventManager::UnregisterAll()
     {
-        GetFunctions<TEvent>().Clear();
+        const Id eventId = TypeRegistry::GetId<TEvent>();
+
+        if (const jpt_private::EventFunctions* pFunctions = FindFunctions(eventId))
+        {
+            for (size_t i = pFunctions->Count(); i > 0; --i)
+            {
+                const jpt_private::EventFunction& function = (*pFunctions)[i - 1];
+                if (function.isActive)
+                {
+                    UnregisterSlot(function.slotIndex);
+                }
+            }
+        }
+
+        for (jpt_private::DeferredFunction& deferred : m_deferredFunctions)
+        {
+            if (deferred.eventId == eventId)
+            {
+                deferred.function.isActive = false;
+            }
+        }
     }
 
     template<typename TEvent>
     void EventManager::Send(const TEvent& event)
     {
-        for (const jpt_private::EventFunction& function : GetFunctions<TEvent>())
+        JPT_ASSERT(IsOwnerThread(), "Other threads must Queue events");
+
+        Dispatch(TypeRegistry::GetId<TEvent>(), event);
+    }
+
+    template<typename TEvent>
+    void EventManager::Queue(const TEvent& event, TimePrecision timer /*= 0.0*/)
+    {
+        const Id eventId = TypeRegistry::GetId<TEvent>();
+        const uint64 sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        if (!IsOwnerThread())
+        {
+            void* pMemory = SizeClassAllocator::GetInstance().Allocate(sizeof(TEvent), alignof(TEvent));
+            const jpt_private::PostedEvent posted{ new (pMemory) TEvent(event), pMemory, eventId, sequence, timer };
+
+            // Spinning until the owner drains would deadlock when the owner is waiting on this thread, as in a parallel dispatch
+            if (!GetThreadQueue().events.TryPush(posted)) [[unlikely]]
+            {
+                LockGuard lock(m_overflowMutex);
+                m_overflowEvents.EmplaceBack(posted);
+            }
+            return;
+        }
+
+        if (timer <= 0.0f)
+        {
+            void* pMemory = m_frameArenas[m_queueIndex].Allocate(sizeof(TEvent), alignof(TEvent));
+            m_frameQueues[m_queueIndex].EmplaceBack(new (pMemory) TEvent(event), nullptr, eventId, sequence);
+        }
+        else
         {
-            function.func(event);
+            void* pMemory = SizeClassAllocator::GetInstance().Allocate(sizeof(TEvent), alignof(TEvent));
+            m_delayedEvents.Emplace(new (pMemory) TEvent(event), pMemory, eventId, m_time + timer, sequence);
         }
     }
 
     template<typename TEvent>
-    void EventManager::Queue(const TEvent& event, TimePrecision timer /*= 0.0*/)
+    void EventManager::SetParallelDispatch(bool isParallel /*= true*/)
     {
+        JPT_ASSERT(IsOwnerThread() && m_dispatchDepth == 0);
+
         const Id eventId = TypeRegistry::GetId<TEvent>();
+        if (eventId >= m_parallelTypes.Count())
+        {
+            m_parallelTypes.Resize(eventId + 1, false);
+        }
 
-        m_eventQueue.EmplaceBack(JPT_NEW(TEvent, event), eventId, timer);
+        m_parallelTypes[eventId] = isParallel;
+        GetFunctions(eventId);
     }
 
     template<typename TEvent, Functional TListener>
     bool EventManager::IsListening(const TListener* pListener) const
     {
-        for (const jpt_private::EventFunction& function : GetFunctions<TEvent>())
+        const Id eventId = TypeRegistry::GetId<TEvent>();
+
+        if (const jpt_private::EventFunctions* pFunctions = FindFunctions(eventId))
         {
-            if (function.pContext == pListener)
+            for (const jpt_private::EventFunction& function : *pFunctions)
+            {
+                if (function.isActive && function.pContext == pListener)
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (const jpt_private::DeferredFunction& deferred : m_deferredFunctions)
+        {
+            if (deferred.eventId == eventId && deferred.function.isActive && deferred.function.pContext == pListener)
             {
                 return true;
             }
@@ -188,70 +350,439 @@ export namespace jpt
         return false;
     }
 
+    EventManager::~EventManager()
+    {
+        for (jpt_private::ThreadQueue* pThreadQueue : m_threadQueues)
+        {
+            JPT_DELETE(pThreadQueue);
+        }
+        for (jpt_private::ThreadQueue* pThreadQueue : m_freeThreadQueues)
+        {
+            JPT_DELETE(pThreadQueue);
+        }
+    }
+
+    void EventManager::Unregister(EventHandle eventHandle)
+    {
+        JPT_ASSERT(IsOwnerThread());
+
+        if (FindSlot(eventHandle))
+        {
+            UnregisterSlot(static_cast<uint32>(eventHandle.functionId));
+        }
+    }
+
     bool EventManager::IsListening(EventHandle eventHandle) const
     {
-        for (const jpt_private::EventFunction& function : m_functionsMap[eventHandle.eventId])
+        const jpt_private::HandleSlot* pSlot = FindSlot(eventHandle);
+        return pSlot && GetFunction(*pSlot).isActive;
+    }
+
+    void EventManager::Update(TimePrecision deltaSeconds)
+    {
+        JPT_ASSERT(IsOwnerThread(), "Update belongs to the thread that created the EventManager");
+
+        m_time += deltaSeconds;
+
+        // Events queued by the handlers go to the other buffer, and wait for the next Update
+        jpt_private::EventQueue& frameQueue = m_frameQueues[m_queueIndex];
+        LinearArena& frameArena = m_frameArenas[m_queueIndex];
+        m_queueIndex ^= 1;
+
+        DrainThreadQueues(frameQueue);
+
+        // Due delayed events follow, earliest first
+        while (!m_delayedEvents.IsEmpty() && m_delayedEvents.Top().dueTime <= m_time)
         {
-            if (function.Id == eventHandle.functionId)
+            const jpt_private::DelayedEvent& delayed = m_delayedEvents.Top();
+            frameQueue.EmplaceBack(delayed.pEvent, delayed.pMemory, delayed.eventId, delayed.sequence);
+            m_delayedEvents.Pop();
+        }
+
+        for (const jpt_private::QueuedEvent& queued : frameQueue)
+        {
+            if (IsParallel(queued.eventId))
             {
-                return true;
+                m_parallelEvents.EmplaceBack(&queued);
+            }
+            else
+            {
+                Dispatch(queued.eventId, *queued.pEvent);
             }
         }
 
-        return false;
+        DispatchParallel();
+
+        for (const jpt_private::QueuedEvent& queued : frameQueue)
+        {
+            Release(queued.pEvent, queued.pMemory);
+        }
+        frameQueue.Clear();
+        frameArena.Reset();
     }
 
-    void EventManager::Update(TimePrecision deltaSeconds)
+    void EventManager::Terminate()
+    {
+        ClearQueues();
+    }
+
+    bool EventManager::IsOwnerThread() const
+    {
+        return std::this_thread::get_id() == m_ownerThreadId;
+    }
+
+    EventHandle EventManager::Add(Id eventId, const void* pContext, EventFunc&& func)
+    {
+        JPT_ASSERT(IsOwnerThread(), "Register belongs to the thread that created the EventManager");
+
+        const uint32 slotIndex = AcquireSlot();
+        jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+        slot.eventId = eventId;
+
+        jpt_private::EventFunction function;
+        function.func      = Move(func);
+        function.pContext  = pContext;
+        function.slotIndex = slotIndex;
+
+        if (m_dispatchDepth > 0)
+        {
+            slot.index      = static_cast<uint32>(m_deferredFunctions.Count());
+            slot.isDeferred = true;
+            m_deferredFunctions.EmplaceBack(eventId, Move(function));
+        }
+        else
+        {
+            jpt_private::EventFunctions& functions = GetFunctions(eventId);
+            slot.index      = static_cast<uint32>(functions.Count());
+            slot.isDeferred = false;
+            functions.EmplaceBack(Move(function));
+        }
+
+        return EventHandle{ eventId, (static_cast<Id>(slot.generation) << 32) | slotIndex };
+    }
+
+    void EventManager::Dispatch(Id eventId, const Event& event)
+    {
+        if (eventId >= m_functionsTable.Count())
+        {
+            return;
+        }
+
+        // Nothing is added nor erased until the outermost dispatch is done, the functions don't move while they're called
+        ++m_dispatchDepth;
+
+        const jpt_private::EventFunctions& functions = m_functionsTable[eventId];
+        for (const jpt_private::EventFunction& function : functions)
+        {
+            if (function.isActive)
+            {
+                function.func(event);
+            }
+        }
+
+        if (--m_dispatchDepth == 0)
+        {
+            FlushDeferred();
+        }
+    }
+
+    void EventManager::UnregisterSlot(uint32 slotIndex)
+    {
+        const jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+
+        if (slot.isDeferred)
+        {
+            // Released when the deferred functions are flushed
+            m_deferredFunctions[slot.index].function.isActive = false;
+            return;
+        }
+
+        jpt_private::EventFunction& function = m_functionsTable[slot.eventId][slot.index];
+        if (!function.isActive)
+        {
+            return;
+        }
+
+        if (m_dispatchDepth > 0)
+        {
+            function.isActive = false;
+            m_deferredUnregisters.EmplaceBack(slotIndex);
+            return;
+        }
+
+        Erase(slot.eventId, slot.index);
+    }
+
+    void EventManager::Erase(Id eventId, uint32 index)
+    {
+        jpt_private::EventFunctions& functions = m_functionsTable[eventId];
+        ReleaseSlot(functions[index].slotIndex);
+
+        const uint32 lastIndex = static_cast<uint32>(functions.Count() - 1);
+        if (index != lastIndex)
+        {
+            functions[index] = Move(functions[lastIndex]);
+            m_handleSlots[functions[index].slotIndex].index = index;
+        }
+        functions.Pop();
+    }
+
+    void EventManager::FlushDeferred()
+    {
+        for (uint32 slotIndex : m_deferredUnregisters)
+        {
+            const jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+            Erase(slot.eventId, slot.index);
+        }
+        m_deferredUnregisters.Clear();
+
+        for (jpt_private::DeferredFunction& deferred : m_deferredFunctions)
+        {
+            const uint32 slotIndex = deferred.function.slotIndex;
+            if (!deferred.function.isActive)
+            {
+                ReleaseSlot(slotIndex);
+                continue;
+            }
+
+            jpt_private::EventFunctions& functions = GetFunctions(deferred.eventId);
+            jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+            slot.index      = static_cast<uint32>(functions.Count());
+            slot.isDeferred = false;
+            functions.EmplaceBack(Move(deferred.function));
+        }
+        m_deferredFunctions.Clear();
+    }
+
+    uint32 EventManager::AcquireSlot()
+    {
+        if (m_freeHandleSlots.IsEmpty())
+        {
+            m_handleSlots.EmplaceBack();
+            return static_cast<uint32>(m_handleSlots.Count() - 1);
+        }
+
+        const uint32 slotIndex = m_freeHandleSlots.Back();
+        m_freeHandleSlots.Pop();
+        return slotIndex;
+    }
+
+    void EventManager::ReleaseSlot(uint32 slotIndex)
+    {
+        jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+        slot.eventId    = kInvalidId;
+        slot.isDeferred = false;
+        ++slot.generation;
+
+        m_freeHandleSlots.EmplaceBack(slotIndex);
+    }
+
+    const jpt_private::HandleSlot* EventManager::FindSlot(EventHandle eventHandle) const
+    {
+        const uint32 slotIndex  = static_cast<uint32>(eventHandle.functionId);
+        const uint32 generation = static_cast<uint32>(eventHandle.functionId >> 32);
+
+        if (slotIndex >= m_handleSlots.Count())
+        {
+            return nullptr;
+        }
+
+        const jpt_private::HandleSlot& slot = m_handleSlots[slotIndex];
+        if (slot.generation != generation || slot.eventId != eventHandle.eventId)
+        {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+
+    const jpt_private::EventFunction& EventManager::GetFunction(const jpt_private::HandleSlot& slot) const
+    {
+        if (slot.isDeferred)
+        {
+            return m_deferredFunctions[slot.index].function;
+        }
+
+        return m_functionsTable[slot.eventId][slot.index];
+    }
+
+    jpt_private::EventFunctions& EventManager::GetFunctions(Id eventId)
     {
-        for (auto itr = m_eventQueue.begin(); itr != m_eventQueue.end();)
+        JPT_ASSERT(m_dispatchDepth == 0, "Functions table can't grow during a dispatch");
+
+        if (eventId >= m_functionsTable.Count())
         {
-            jpt_private::PendingEvent& item = *itr;
-            item.m_timer -= deltaSeconds;
+            m_functionsTable.Resize(eventId + 1);
+        }
+
+        return m_functionsTable[eventId];
+    }
+
+    const jpt_private::EventFunctions* EventManager::FindFunctions(Id eventId) const
+    {
+        return eventId < m_functionsTable.Count() ? &m_functionsTable[eventId] : nullptr;
+    }
+
+    void EventManager::DrainThreadQueues(jpt_private::EventQueue& frameQueue)
+    {
+        const size_t ownCount = frameQueue.Count();
 
-            if (item.m_timer <= 0.0)
+        {
+            LockGuard lock(m_threadQueuesMutex);
+
+            jpt_private::PostedEvent posted[kDrainBatchSize];
+            for (size_t i = 0; i < m_threadQueues.Count();)
             {
-                const jpt_private::EventFunctions& functions = m_functionsMap[item.eventId];
-                for (const jpt_private::EventFunction& function : functions)
+                jpt_private::ThreadQueue* pThreadQueue = m_threadQueues[i];
+
+                // Read before the count. An orphan's thread is gone, the count then covers everything it pushed
+                const bool isOrphaned = pThreadQueue->isOrphaned.load(std::memory_order_acquire);
+
+                // Only what was queued before this Update, a busy thread can't keep it draining
+                size_t remaining = pThreadQueue->events.Count();
+                while (remaining > 0)
+                {
+                    const size_t count = pThreadQueue->events.TryPopBatch(posted, remaining < kDrainBatchSize ? remaining : kDrainBatchSize);
+                    remaining -= count;
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        ReceivePosted(posted[i], frameQueue);
+                    }
+                }
+
+                if (isOrphaned)
                 {
-                    function.func(*item.pEvent);
+                    m_freeThreadQueues.EmplaceBack(pThreadQueue);
+                    m_threadQueues[i] = m_threadQueues.Back();
+                    m_threadQueues.Pop();
+                    continue;
                 }
 
-                JPT_DELETE(item.pEvent);
-                item.pEvent = nullptr;
+                ++i;
+            }
+        }
+
+        // After the thread queues. An event that overflowed was queued before anything its thread got back into its queue
+        DynamicArray<jpt_private::PostedEvent> overflowEvents;
+        {
+            LockGuard lock(m_overflowMutex);
+            Swap(overflowEvents, m_overflowEvents);
+        }
+        for (const jpt_private::PostedEvent& event : overflowEvents)
+        {
+            ReceivePosted(event, frameQueue);
+        }
+
+        // Each queue is already in ticket order, interleave them with the owner's events
+        if (frameQueue.Count() > ownCount)
+        {
+            Sort(frameQueue);
+        }
+    }
+
+    void EventManager::ReceivePosted(const jpt_private::PostedEvent& event, jpt_private::EventQueue& frameQueue)
+    {
+        if (event.timer <= 0.0f)
+        {
+            frameQueue.EmplaceBack(event.pEvent, event.pMemory, event.eventId, event.sequence);
+        }
+        else
+        {
+            m_delayedEvents.Emplace(event.pEvent, event.pMemory, event.eventId, m_time + event.timer, event.sequence);
+        }
+    }
+
+    jpt_private::ThreadQueue& EventManager::GetThreadQueue()
+    {
+        if (!s_threadQueueOwner.pQueue)
+        {
+            LockGuard lock(m_threadQueuesMutex);
 
-                itr = m_eventQueue.Erase(itr);
+            jpt_private::ThreadQueue* pThreadQueue = nullptr;
+            if (m_freeThreadQueues.IsEmpty())
+            {
+                pThreadQueue = JPT_NEW(jpt_private::ThreadQueue, kThreadQueueCapacity);
             }
             else
             {
-                ++itr;
+                pThreadQueue = m_freeThreadQueues.Back();
+                m_freeThreadQueues.Pop();
+                pThreadQueue->isOrphaned.store(false, std::memory_order_relaxed);
             }
+
+            m_threadQueues.EmplaceBack(pThreadQueue);
+            s_threadQueueOwner.pQueue = pThreadQueue;
         }
+
+        return *s_threadQueueOwner.pQueue;
     }
 
-    void EventManager::Terminate()
+    void EventManager::DispatchParallel()
     {
-        for (jpt_private::PendingEvent& item : m_eventQueue)
+        if (m_parallelEvents.IsEmpty())
+        {
+            return;
+        }
+
+        // Keeps the functions where they are. Functions sent in parallel aren't allowed to register nor unregister anyway
+        ++m_dispatchDepth;
+
+        JobSystem::GetInstance().ParallelFor(m_parallelEvents.Count(), kParallelBatchSize, [this](size_t index)
+            {
+                const jpt_private::QueuedEvent& queued = *m_parallelEvents[index];
+                for (const jpt_private::EventFunction& function : m_functionsTable[queued.eventId])
+                {
+                    if (function.isActive)
+                    {
+                        function.func(*queued.pEvent);
+                    }
+                }
+            });
+
+        if (--m_dispatchDepth == 0)
         {
-            JPT_DELETE(item.pEvent);
-            item.pEvent = nullptr;
+            FlushDeferred();
         }
 
-        m_eventQueue.Clear();
+        m_parallelEvents.Clear();
     }
 
-    template<typename TEvent>
-    jpt_private::EventFunctions& EventManager::GetFunctions()
+    bool EventManager::IsParallel(Id eventId) const
     {
-        const Id eventId = TypeRegistry::GetId<TEvent>();
+        return eventId < m_parallelTypes.Count() && m_parallelTypes[eventId];
+    }
+
+    void EventManager::Release(Event* pEvent, void* pMemory)
+    {
+        pEvent->~Event();
 
-        return m_functionsMap[eventId];
+        if (pMemory)
+        {
+            SizeClassAllocator::GetInstance().Deallocate(pMemory);
+        }
     }
 
-    template<typename TEvent>
-    const jpt_private::EventFunctions& EventManager::GetFunctions() const
+    void EventManager::ClearQueues()
     {
-        const Id eventId = TypeRegistry::GetId<TEvent>();
+        DrainThreadQueues(m_frameQueues[m_queueIndex]);
 
-        return m_functionsMap[eventId];
+        for (uint32 i = 0; i < 2; ++i)
+        {
+            for (const jpt_private::QueuedEvent& queued : m_frameQueues[i])
+            {
+                Release(queued.pEvent, queued.pMemory);
+            }
+            m_frameQueues[i].Clear();
+            m_frameArenas[i].Reset();
+        }
+
+        while (!m_delayedEvents.IsEmpty())
+        {
+            const jpt_private::DelayedEvent delayed = m_delayedEvents.Top();
+            m_delayedEvents.Pop();
+
+            Release(delayed.pEvent, delayed.pMemory);
+        }
     }
 }
\ No newline at end of file
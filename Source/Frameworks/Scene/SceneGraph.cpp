@@ -11,6 +11,7 @@ namespace jpt
             m_entityPool[id]->Update(deltaSeconds);
         }
 
+        m_scheduler.Update(m_componentManager, deltaSeconds);
         m_componentManager.Update(deltaSeconds);
     }
 }
\ No newline at end of file
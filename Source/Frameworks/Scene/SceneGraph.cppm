@@ -6,6 +6,8 @@ import jpt.ObjectPool;
 
 import jpt.Entity;
 import jpt.EntityComponentManager;
+import jpt.SceneScheduler;
+import jpt.SceneSystem;
 
 import jpt.TimeTypeDefs;
 
@@ -24,6 +26,7 @@ export namespace jpt
         DynamicArray<Index> m_activeEntities;   /**< All entities id in the scene that's active. Maps to the entity pool */
 
         EntityComponentManager m_componentManager;    /**< Manages all entity components in current scene */
+        SceneScheduler m_scheduler;                   /**< Runs the scene systems over m_componentManager, in parallel where their accesses allow */
         
         String m_name;                        /**< The name of the scene */
 
@@ -33,5 +36,10 @@ export namespace jpt
         virtual bool Init() { return true; }
         virtual void Update(TimePrecision deltaSeconds);
         virtual void Terminate() {}
+
+        /** Takes ownership. Systems run every Update() */
+        void RegisterSystem(SceneSystem* pSystem) { m_scheduler.Register(pSystem); }
+
+        EntityComponentManager& GetComponentManager() { return m_componentManager; }
     };
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Memory/Memory.h"
+#include "Core/Validation/Assert.h"
+
+#include <atomic>
+
+module jpt.SceneScheduler;
+
+namespace jpt
+{
+    SceneScheduler::~SceneScheduler()
+    {
+        JobSystem::GetInstance().WaitFor(m_frameCounter);
+
+        for (Node* pNode : m_nodes)
+        {
+            JPT_DELETE(pNode->pSystem);
+            JPT_DELETE(pNode);
+        }
+    }
+
+    void SceneScheduler::Register(SceneSystem* pSystem)
+    {
+        JPT_ASSERT(pSystem);
+
+        Node* pNode = JPT_NEW(Node);
+        pNode->pSystem = pSystem;
+        m_nodes.EmplaceBack(pNode);
+
+        m_isGraphDirty = true;
+    }
+
+    void SceneScheduler::Update(EntityComponentManager& manager, TimePrecision deltaSeconds)
+    {
+        if (m_nodes.IsEmpty())
+        {
+            return;
+        }
+
+        if (m_isGraphDirty)
+        {
+            BuildGraph();
+        }
+
+        m_pManager = &manager;
+        m_deltaSeconds = deltaSeconds;
+
+        for (Node* pNode : m_nodes)
+        {
+            pNode->remainingDependencies.store(pNode->dependenciesCount, std::memory_order_relaxed);
+        }
+
+        // A node schedules its dependents before its own job counts as finished, so the counter can't reach zero early
+        for (Index i = 0; i < m_nodes.Count(); ++i)
+        {
+            if (m_nodes[i]->dependenciesCount == 0)
+            {
+                Schedule(i);
+            }
+        }
+
+        JobSystem::GetInstance().WaitFor(m_frameCounter);
+        m_pManager = nullptr;
+    }
+
+    void SceneScheduler::BuildGraph()
+    {
+        for (Node* pNode : m_nodes)
+        {
+            pNode->dependents.Clear();
+            pNode->dependenciesCount = 0;
+        }
+
+        for (Index i = 0; i < m_nodes.Count(); ++i)
+        {
+            for (Index j = 0; j < i; ++j)
+            {
+                if (m_nodes[i]->pSystem->ConflictsWith(*m_nodes[j]->pSystem))
+                {
+                    m_nodes[j]->dependents.EmplaceBack(i);
+                    ++m_nodes[i]->dependenciesCount;
+                }
+            }
+        }
+
+        m_isGraphDirty = false;
+    }
+
+    void SceneScheduler::Schedule(Index nodeIndex)
+    {
+        JobSystem::GetInstance().Run([this, nodeIndex]()
+            {
+                Node& node = *m_nodes[nodeIndex];
+                node.pSystem->Update(*m_pManager, m_deltaSeconds);
+
+                for (Index dependent : node.dependents)
+                {
+                    if (m_nodes[dependent]->remainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        Schedule(dependent);
+                    }
+                }
+            }, &m_frameCounter);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include <atomic>
+
+export module jpt.SceneScheduler;
+
+import jpt.EntityComponentManager;
+import jpt.SceneSystem;
+
+import jpt.DynamicArray;
+import jpt.JobSystem;
+import jpt.TimeTypeDefs;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** Runs a scene's systems every frame on the JobSystem.
+        The dependency graph is built from the systems' declared accesses: a system depends on every earlier registered system it conflicts with.
+        Systems start as soon as all their dependencies have finished, so the frame is as parallel as the declarations allow while keeping the registration order semantics */
+    class SceneScheduler
+    {
+    private:
+        struct Node
+        {
+            SceneSystem* pSystem = nullptr;
+            DynamicArray<Index> dependents;                 /**< Nodes to release when this one finishes */
+            int32 dependenciesCount = 0;
+            std::atomic<int32> remainingDependencies = 0;   /**< Reset every frame */
+        };
+
+    private:
+        DynamicArray<Node*> m_nodes;
+        JobCounter m_frameCounter;                      /**< Jobs of the current Update(). Outlives the frame, so a late Decrement() never touches a dead counter */
+        EntityComponentManager* m_pManager = nullptr;   /**< Valid during Update() */
+        TimePrecision m_deltaSeconds = 0;
+        bool m_isGraphDirty = false;
+
+    public:
+        SceneScheduler() = default;
+        ~SceneScheduler();
+
+        SceneScheduler(const SceneScheduler&) = delete;
+        SceneScheduler& operator=(const SceneScheduler&) = delete;
+
+        /** Takes ownership */
+        void Register(SceneSystem* pSystem);
+
+        /** Runs every system once, returns when all of them are done. The calling thread helps run them */
+        void Update(EntityComponentManager& manager, TimePrecision deltaSeconds);
+
+        size_t GetSystemsCount() const { return m_nodes.Count(); }
+
+    private:
+        void BuildGraph();
+        void Schedule(Index nodeIndex);
+    };
+}
\ No newline at end of file
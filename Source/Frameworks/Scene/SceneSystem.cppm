@@ -0,0 +1,110 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.SceneSystem;
+
+import jpt.EntityComponentManager;
+
+import jpt.DynamicArray;
+import jpt.String;
+import jpt.TimeTypeDefs;
+import jpt.TypeDefs;
+
+export namespace jpt
+{
+    /** A unit of scene logic run by SceneScheduler once per frame.
+        Declares in its constructor which component types it reads and writes. Systems whose accesses don't conflict run concurrently,
+        conflicting ones run in registration order.
+
+        @note   Update() may run on any worker thread. Structural changes (create/destroy entities, add/remove components) are only safe from an exclusive system
+        @example
+            class MovementSystem final : public jpt::SceneSystem
+            {
+            public:
+                MovementSystem() : SceneSystem("Movement")
+                {
+                    Read<Velocity>();
+                    Write<Position>();
+                }
+
+                void Update(jpt::EntityComponentManager& manager, TimePrecision deltaSeconds) override
+                {
+                    manager.ParallelForEach<Position, const Velocity>([deltaSeconds](Position& position, const Velocity& velocity)
+                        {
+                            position.value += velocity.value * deltaSeconds;
+                        });
+                }
+            }; */
+    class SceneSystem
+    {
+    private:
+        String m_name;
+        DynamicArray<Id> m_reads;
+        DynamicArray<Id> m_writes;
+        bool m_isExclusive = false;
+
+    public:
+        SceneSystem(const char* name) : m_name(name) {}
+        virtual ~SceneSystem() = default;
+
+        virtual void Update(EntityComponentManager& manager, TimePrecision deltaSeconds) = 0;
+
+        /** @return     true if the two systems can't run at the same time */
+        bool ConflictsWith(const SceneSystem& other) const;
+
+        const String& GetName() const { return m_name; }
+        bool IsExclusive() const { return m_isExclusive; }
+
+    protected:
+        template<typename TComponent> void Read()  { AddAccess(m_reads,  GetComponentId<TComponent>()); }
+        template<typename TComponent> void Write() { AddAccess(m_writes, GetComponentId<TComponent>()); }
+
+        /** Runs alone: after every system registered before it, before every system registered after it */
+        void SetExclusive() { m_isExclusive = true; }
+
+    private:
+        static void AddAccess(DynamicArray<Id>& accesses, Id typeId);
+        static bool Intersects(const DynamicArray<Id>& a, const DynamicArray<Id>& b);
+    };
+
+    bool SceneSystem::ConflictsWith(const SceneSystem& other) const
+    {
+        if (m_isExclusive || other.m_isExclusive)
+        {
+            return true;
+        }
+
+        return Intersects(m_writes, other.m_writes) ||
+               Intersects(m_writes, other.m_reads)  ||
+               Intersects(m_reads,  other.m_writes);
+    }
+
+    void SceneSystem::AddAccess(DynamicArray<Id>& accesses, Id typeId)
+    {
+        for (Id id : accesses)
+        {
+            if (id == typeId)
+            {
+                return;
+            }
+        }
+
+        accesses.EmplaceBack(typeId);
+    }
+
+    bool SceneSystem::Intersects(const DynamicArray<Id>& a, const DynamicArray<Id>& b)
+    {
+        // A handful of ids per system, linear is fine
+        for (Id idA : a)
+        {
+            for (Id idB : b)
+            {
+                if (idA == idB)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+}
\ No newline at end of file
@@ -8,12 +8,27 @@ module;
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
 
+#include <istream>
+#include <streambuf>
+
 module jpt.Mesh;
 
 import jpt.HashMap;
+import jpt.MappedFile;
 
 namespace jpt
 {
+    /** Lets tinyobj read a mapped file, it only takes a path or an istream */
+    class MemoryStreamBuffer final : public std::streambuf
+    {
+    public:
+        MemoryStreamBuffer(const char* pData, size_t size)
+        {
+            char* pBegin = const_cast<char*>(pData);
+            setg(pBegin, pBegin, pBegin + size);
+        }
+    };
+
     bool Mesh::Load(const File::Path& meshPath)
     {
         JPT_DEBUG("Loading mesh: %s", ToString(meshPath).ConstBuffer());
@@ -23,7 +38,18 @@ namespace jpt
         std::vector<tinyobj::material_t> materials;
         std::string warn, err;
 
-        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, ToString(meshPath).ConstBuffer()))
+        const File::MappedFile file(meshPath);
+        if (!file.IsOpen())
+        {
+            JPT_ERROR("Failed to open mesh: %s", ToString(meshPath).ConstBuffer());
+            return false;
+        }
+
+        MemoryStreamBuffer streamBuffer(file.ConstBuffer(), file.Size());
+        std::istream stream(&streamBuffer);
+        tinyobj::MaterialFileReader materialReader("");
+
+        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, &stream, &materialReader))
         {
             JPT_ERROR("Failed to load mesh: %s", err.c_str());
             return false;
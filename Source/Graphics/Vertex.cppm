@@ -59,14 +59,10 @@ export namespace jpt
 
     constexpr uint64 Vertex::Hash() const
     {
-        // Use a prime number as initial seed
-        uint64 hash = 14695981039346656037ULL; // FNV-1a offset basis
-
-        // Combine each component with multiplication and XOR
-        hash = (hash * 1099511628211ULL) ^ jpt::Hash(position);  // FNV prime
-        hash = (hash * 1099511628211ULL) ^ jpt::Hash(color);
-        hash = (hash * 1099511628211ULL) ^ jpt::Hash(uv);
-        hash = (hash * 1099511628211ULL) ^ jpt::Hash(normal);
+        uint64 hash = jpt::Hash(position);
+        hash = HashCombine(hash, jpt::Hash(color));
+        hash = HashCombine(hash, jpt::Hash(uv));
+        hash = HashCombine(hash, jpt::Hash(normal));
 
         return hash;
     }
@@ -2,6 +2,7 @@
 
 export module jpt.BenchmarkUnit;
 
+import jpt.NumberConversion;
 import jpt.String;
 import jpt.TypeDefs;
 import jpt.TimeTypeDefs;
@@ -18,6 +19,16 @@ export namespace jpt
 
     String ToString(const BenchmarkUnit& unit)
     {
-        return String::Format<256>("%s,%s,%f", unit.topic.ConstBuffer(), unit.context.ConstBuffer(), unit.resultMS);
+        char result[kMaxFloatChars];
+        const Index resultCount = WriteFloat(result, unit.resultMS);
+
+        String str;
+        str.Reserve(unit.topic.Count() + unit.context.Count() + resultCount + 2);
+        str.Append(unit.topic);
+        str.Append(',');
+        str.Append(unit.context);
+        str.Append(',');
+        str.Append(result, resultCount);
+        return str;
     }
 }
\ No newline at end of file
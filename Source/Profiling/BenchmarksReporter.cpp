@@ -11,6 +11,7 @@ import jpt.Clock;
 import jpt.DateTime;
 import jpt.FilePath;
 import jpt.SystemPaths;
+import jpt.ToString;
 
 namespace jpt
 {
@@ -22,7 +23,7 @@ namespace jpt
         m_results.AddRow(header);
     }
 
-    void BenchmarksReporter::Profile(const char* topic, const char* context, size_t count, const Function<void()>& func)
+    void BenchmarksReporter::Profile(const char* topic, const char* context, size_t count, FunctionRef<void()> func)
     {
         StopWatch::Point now;
         TimePrecision result = 0.0;
@@ -34,8 +35,8 @@ namespace jpt
             }
             result = StopWatch::GetMsFrom(now);
         }
-        BenchmarkUnit unit{ topic, context, result };
-        m_results.AddRow(ToString(unit));
+        // Cells as they are, contexts may hold commas
+        m_results.AddRow(CSVData::Row{ topic, context, ToString(result) });
     }
 
     void BenchmarksReporter::Finalize()
@@ -18,7 +18,7 @@ export namespace jpt
     public:
         BenchmarksReporter();
 
-        void Profile(const char* topic, const char* context, size_t count, const Function<void()>& func);
+        void Profile(const char* topic, const char* context, size_t count, FunctionRef<void()> func);
 
         void Finalize();
         void LogResults();
@@ -0,0 +1,293 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Memory/Memory.h"
+#include "Core/Validation/Assert.h"
+#include "Debugging/Logger.h"
+
+module jpt.AsyncFileIO;
+
+import jpt.FileIO;
+import jpt.LockGuard;
+import jpt.Serializer;
+import jpt.ToString;
+import jpt.Utilities;
+
+namespace jpt::File
+{
+    class AsyncFileWorker final : public Thread
+    {
+    private:
+        AsyncFileIO& m_service;
+
+    public:
+        AsyncFileWorker(AsyncFileIO& service, uint32 index)
+            : Thread("Async File Worker")
+            , m_service(service)
+        {
+            m_name += ToString(index);
+        }
+
+    protected:
+        void Update() override
+        {
+            if (AsyncFileRequest* pRequest = m_service.WaitPop())
+            {
+                m_service.Execute(*pRequest);
+            }
+        }
+    };
+
+    static void locOpen(Serializer& serializer, const Path& path, SerializerMode mode)
+    {
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        serializer.Open(path.ConstBuffer(), mode);
+#else
+        serializer.Open(path.GetString<wchar_t>().ConstBuffer(), mode);
+#endif
+    }
+
+    bool AsyncFileRequest::IsDone() const
+    {
+        const Status status = m_status.load(std::memory_order_acquire);
+        return status == Status::Success || status == Status::Failure;
+    }
+
+    void AsyncFileIO::Init(uint32 threadsCount /*= 2*/, uint32 maxInFlight /*= kDefaultMaxInFlight*/)
+    {
+        JPT_ASSERT(!IsRunning(), "AsyncFileIO is already running");
+        JPT_ASSERT(threadsCount > 0 && maxInFlight > 0);
+
+        m_maxInFlight = maxInFlight;
+        m_isRunning.store(true, std::memory_order_release);
+
+        m_workers.Reserve(threadsCount);
+        for (uint32 i = 0; i < threadsCount; ++i)
+        {
+            Thread* pWorker = JPT_NEW(AsyncFileWorker, *this, i);
+            m_workers.EmplaceBack(pWorker);
+            pWorker->Start();
+        }
+    }
+
+    void AsyncFileIO::Terminate()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        for (Thread* pWorker : m_workers)
+        {
+            pWorker->Stop();
+        }
+
+        {
+            LockGuard lock(m_queueMutex);
+            m_isRunning.store(false, std::memory_order_release);
+            m_queueCondition.NotifyAll();
+        }
+
+        for (Thread* pWorker : m_workers)
+        {
+            pWorker->Join();
+            JPT_DELETE(pWorker);
+        }
+        m_workers.Clear();
+
+        // Nobody else can run them now, and Submit() no longer enqueues. Complete them here so no Wait() hangs
+        while (!m_queue.IsEmpty())
+        {
+            AsyncFileRequest* pRequest = m_queue.Front();
+            m_queue.Dequeue();
+            Execute(*pRequest);
+        }
+    }
+
+    bool AsyncFileIO::Read(AsyncFileRequest& request, const Path& path, AsyncFileRequest::Callback&& onComplete /*= {}*/, size_t offset /*= 0*/, size_t size /*= kWholeFile*/)
+    {
+        JPT_ASSERT(request.m_status.load(std::memory_order_relaxed) != Status::Running, "Request is still in flight");
+
+        if (!TryReserve())
+        {
+            return false;
+        }
+
+        request.m_path = path;
+        request.m_data.Clear();
+        request.m_onComplete = Move(onComplete);
+        request.m_offset = offset;
+        request.m_size = size;
+        request.m_operation = AsyncFileOperation::Read;
+
+        Submit(request);
+        return true;
+    }
+
+    bool AsyncFileIO::Write(AsyncFileRequest& request, const Path& path, DynamicArray<char>&& data, AsyncFileRequest::Callback&& onComplete /*= {}*/, size_t offset /*= kWholeFile*/)
+    {
+        JPT_ASSERT(request.m_status.load(std::memory_order_relaxed) != Status::Running, "Request is still in flight");
+
+        if (!TryReserve())
+        {
+            return false;
+        }
+
+        request.m_path = path;
+        request.m_data = Move(data);
+        request.m_onComplete = Move(onComplete);
+        request.m_offset = offset;
+        request.m_size = request.m_data.Count();
+        request.m_operation = AsyncFileOperation::Write;
+
+        Submit(request);
+        return true;
+    }
+
+    void AsyncFileIO::WaitFor(const AsyncFileRequest& request)
+    {
+        auto lock = m_completedMutex.CreateUniqueLock();
+        m_completedCondition.Wait(lock, [&request]() { return request.IsDone(); });
+    }
+
+    bool AsyncFileIO::TryReserve()
+    {
+        // Early out only. Terminate() may still win the race, Submit() re-checks under the queue lock
+        if (!IsRunning())
+        {
+            return false;
+        }
+
+        uint32 count = m_inFlightCount.load(std::memory_order_relaxed);
+        do
+        {
+            if (count >= m_maxInFlight)
+            {
+                return false;
+            }
+        } while (!m_inFlightCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+
+        return true;
+    }
+
+    void AsyncFileIO::Submit(AsyncFileRequest& request)
+    {
+        // Running from here on, IsDone() only flips once the worker is finished with it
+        request.m_status.store(Status::Running, std::memory_order_relaxed);
+
+        {
+            LockGuard lock(m_queueMutex);
+            if (m_isRunning.load(std::memory_order_relaxed))
+            {
+                m_queue.Enqueue(&request);
+                m_queueCondition.NotifyOne();
+                return;
+            }
+        }
+
+        // Stopped after TryReserve(). No worker will pop it and Terminate() may have drained already
+        Execute(request);
+    }
+
+    AsyncFileRequest* AsyncFileIO::WaitPop()
+    {
+        auto lock = m_queueMutex.CreateUniqueLock();
+        m_queueCondition.Wait(lock, [this]() { return !m_queue.IsEmpty() || !m_isRunning.load(std::memory_order_relaxed); });
+
+        // Terminate() completes what's left
+        if (!m_isRunning.load(std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        AsyncFileRequest* pRequest = m_queue.Front();
+        m_queue.Dequeue();
+        return pRequest;
+    }
+
+    void AsyncFileIO::Execute(AsyncFileRequest& request)
+    {
+        const bool success = request.m_operation == AsyncFileOperation::Read ? ExecuteRead(request) : ExecuteWrite(request);
+
+        if (request.m_onComplete.IsConnected())
+        {
+            const AsyncFileRequest::Callback onComplete = Move(request.m_onComplete);
+            onComplete(request);
+        }
+
+        // Release the slot first, so a waiter woken below sees the count already dropped
+        m_inFlightCount.fetch_sub(1, std::memory_order_relaxed);
+
+        // The owner may destroy the request as soon as it's done. Nothing touches it past this store
+        {
+            LockGuard lock(m_completedMutex);
+            request.m_status.store(success ? Status::Success : Status::Failure, std::memory_order_release);
+        }
+        m_completedCondition.NotifyAll();
+    }
+
+    bool AsyncFileIO::ExecuteRead(AsyncFileRequest& request)
+    {
+        Serializer serializer;
+        locOpen(serializer, request.m_path, SerializerMode::ReadBinary);
+        if (!serializer.IsOpen()) [[unlikely]]
+        {
+            JPT_ERROR("Async read failed to open file: %s", ToString(request.m_path).ConstBuffer());
+            return false;
+        }
+
+        const size_t fileSize = serializer.GetSize();
+        if (request.m_offset > fileSize) [[unlikely]]
+        {
+            JPT_ERROR("Async read offset %u is past the end of file: %s", static_cast<uint32>(request.m_offset), ToString(request.m_path).ConstBuffer());
+            return false;
+        }
+
+        const size_t available = fileSize - request.m_offset;
+        const size_t size = request.m_size < available ? request.m_size : available;
+
+        request.m_data.Resize(size);
+        serializer.Seek(request.m_offset, SerializerMode::Begin);
+        serializer.Read(request.m_data.Buffer(), size);
+        return !serializer.HasFailed();
+    }
+
+    bool AsyncFileIO::ExecuteWrite(AsyncFileRequest& request)
+    {
+        EnsureParentDirExists(request.m_path);
+
+        const bool isWholeFile = request.m_offset == AsyncFileIO::kWholeFile;
+        if (!isWholeFile && !Exists(request.m_path))
+        {
+            // In-place writes need an existing file to open for update
+            WriteTextFile(request.m_path, "", 0);
+        }
+
+        Serializer serializer;
+        locOpen(serializer, request.m_path, isWholeFile ? SerializerMode::WriteAll : SerializerMode::ReadWriteBinary);
+        if (!serializer.IsOpen()) [[unlikely]]
+        {
+            JPT_ERROR("Async write failed to open file: %s", ToString(request.m_path).ConstBuffer());
+            return false;
+        }
+
+        if (!isWholeFile)
+        {
+            serializer.Seek(request.m_offset, SerializerMode::Begin);
+        }
+
+        serializer.Write(request.m_data.ConstBuffer(), request.m_data.Count());
+
+        // Most of the data sits in the serializer's block until here. A full disk or lost handle only shows up now
+        serializer.Flush();
+        const bool success = !serializer.HasFailed();
+        serializer.Close();
+
+        if (!success) [[unlikely]]
+        {
+            JPT_ERROR("Async write failed: %s", ToString(request.m_path).ConstBuffer());
+        }
+        return success;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Core/Minimal/Utilities.h"
+
+#include <atomic>
+
+export module jpt.AsyncFileIO;
+
+import jpt.ConditionVariable;
+import jpt.Constants;
+import jpt.DynamicArray;
+import jpt.FilePath;
+import jpt.Function;
+import jpt.Mutex;
+import jpt.Queue;
+import jpt.Status;
+import jpt.Thread;
+import jpt.TypeDefs;
+
+export namespace jpt::File
+{
+    enum class AsyncFileOperation : uint8
+    {
+        Read,
+        Write,
+    };
+
+    /** One read or write submitted to AsyncFileIO. Owned by the caller
+        @note   Must outlive its completion, and not be resubmitted before IsDone(), nor from its own callback */
+    class AsyncFileRequest
+    {
+        friend class AsyncFileIO;
+
+    public:
+        using Callback = Function<void(AsyncFileRequest&)>;
+
+    private:
+        Path m_path;
+        DynamicArray<char> m_data;      /**< Bytes read, or bytes to write */
+        Callback m_onComplete;
+        size_t m_offset = 0;
+        size_t m_size = 0;
+        AsyncFileOperation m_operation = AsyncFileOperation::Read;
+        std::atomic<Status> m_status = Status::Pending;
+
+    public:
+        AsyncFileRequest() = default;
+        AsyncFileRequest(const AsyncFileRequest&) = delete;
+        AsyncFileRequest& operator=(const AsyncFileRequest&) = delete;
+
+        /** Acquire: GetData() is complete once this returns true */
+        bool IsDone() const;
+        bool Succeeded() const { return m_status.load(std::memory_order_acquire) == Status::Success; }
+
+        DynamicArray<char>& GetData() { return m_data; }
+        const DynamicArray<char>& GetData() const { return m_data; }
+        const Path& GetPath() const { return m_path; }
+        AsyncFileOperation GetOperation() const { return m_operation; }
+    };
+
+    /** Runs file reads and writes on dedicated I/O threads, so loading assets never blocks the caller.
+        Blocking calls happen on these threads, not on JobSystem workers, so a slow disk never starves jobs.
+        At most maxInFlight requests are queued or running at once. Past that, submissions fail and the caller retries later
+
+        @example
+            jpt::File::AsyncFileRequest request;
+            jpt::File::AsyncFileIO::GetInstance().Read(request, path, [](jpt::File::AsyncFileRequest& done)
+                {
+                    // On an I/O thread
+                    Parse(done.GetData());
+                });
+
+            // Or poll from the main loop
+            if (request.IsDone() && request.Succeeded()) { ... } */
+    class AsyncFileIO
+    {
+        JPT_DECLARE_SINGLETON(AsyncFileIO);
+
+        friend class AsyncFileWorker;
+
+    public:
+        static constexpr size_t kWholeFile = kInvalidValue<size_t>;
+        static constexpr uint32 kDefaultMaxInFlight = 64;
+
+    private:
+        DynamicArray<Thread*> m_workers;
+        Queue<AsyncFileRequest*> m_queue;
+        Mutex m_queueMutex;
+        ConditionVariable m_queueCondition;
+
+        Mutex m_completedMutex;
+        ConditionVariable m_completedCondition;
+
+        std::atomic<uint32> m_inFlightCount = 0;
+        uint32 m_maxInFlight = kDefaultMaxInFlight;
+        std::atomic<bool> m_isRunning = false;
+
+    public:
+        void Init(uint32 threadsCount = 2, uint32 maxInFlight = kDefaultMaxInFlight);
+
+        /** Joins the I/O threads. Requests still queued are run on the calling thread first */
+        void Terminate();
+
+        /** Queues a read of size bytes from offset. kWholeFile reads up to the end. Reading past the end is clamped
+            @param onComplete   Optional. Called on an I/O thread before the request is marked done
+            @return             false if too many requests are in flight or the service isn't running. request is left untouched */
+        bool Read(AsyncFileRequest& request, const Path& path, AsyncFileRequest::Callback&& onComplete = {}, size_t offset = 0, size_t size = kWholeFile);
+
+        /** Queues a write of data. kWholeFile replaces the file, any other offset overwrites in place and creates the file if missing
+            @return             false if too many requests are in flight or the service isn't running. data is left untouched */
+        bool Write(AsyncFileRequest& request, const Path& path, DynamicArray<char>&& data, AsyncFileRequest::Callback&& onComplete = {}, size_t offset = kWholeFile);
+
+        /** Blocks until request is done. Its callback, if any, has returned by then */
+        void WaitFor(const AsyncFileRequest& request);
+
+        uint32 GetInFlightCount() const { return m_inFlightCount.load(std::memory_order_relaxed); }
+        bool IsRunning() const { return m_isRunning.load(std::memory_order_acquire); }
+
+    private:
+        bool TryReserve();
+
+        /** Queues a reserved request. If Terminate() got there first, runs it on the calling thread instead */
+        void Submit(AsyncFileRequest& request);
+
+        /** Blocks an I/O thread until a request is queued
+            @return     nullptr once terminating */
+        AsyncFileRequest* WaitPop();
+
+        void Execute(AsyncFileRequest& request);
+        bool ExecuteRead(AsyncFileRequest& request);
+        bool ExecuteWrite(AsyncFileRequest& request);
+    };
+}
\ No newline at end of file
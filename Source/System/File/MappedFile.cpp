@@ -0,0 +1,189 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+module;
+
+#include "Debugging/Logger.h"
+
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+module jpt.MappedFile;
+
+namespace jpt::File
+{
+    MappedFile::MappedFile(const Path& path)
+    {
+        Open(path);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    bool MappedFile::Open(const Path& path)
+    {
+        Close();
+
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        const HANDLE fileHandle = ::CreateFileW(path.ConstBuffer(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) [[unlikely]]
+        {
+            JPT_ERROR("Failed to open file for mapping (%ls): %u", path.ConstBuffer(), static_cast<uint32>(::GetLastError()));
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(fileHandle, &fileSize)) [[unlikely]]
+        {
+            JPT_ERROR("Failed to get size of file (%ls): %u", path.ConstBuffer(), static_cast<uint32>(::GetLastError()));
+            ::CloseHandle(fileHandle);
+            return false;
+        }
+
+        m_fileHandle = fileHandle;
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        m_isOpen = true;
+
+        // Mapping an empty file fails, there's nothing to view anyway
+        if (m_size == 0)
+        {
+            return true;
+        }
+
+        m_mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mappingHandle) [[unlikely]]
+        {
+            JPT_ERROR("Failed to map file (%ls): %u", path.ConstBuffer(), static_cast<uint32>(::GetLastError()));
+            Close();
+            return false;
+        }
+
+        m_pData = static_cast<const char*>(::MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!m_pData) [[unlikely]]
+        {
+            JPT_ERROR("Failed to map view of file (%ls): %u", path.ConstBuffer(), static_cast<uint32>(::GetLastError()));
+            Close();
+            return false;
+        }
+#else
+        const int32 fileDescriptor = ::open(path.ConstBuffer(), O_RDONLY);
+        if (fileDescriptor < 0) [[unlikely]]
+        {
+            JPT_ERROR("Failed to open file for mapping (%s)", path.ConstBuffer());
+            return false;
+        }
+
+        struct stat fileStat;
+        if (::fstat(fileDescriptor, &fileStat) != 0) [[unlikely]]
+        {
+            JPT_ERROR("Failed to get size of file (%s)", path.ConstBuffer());
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        m_fileDescriptor = fileDescriptor;
+        m_size = static_cast<size_t>(fileStat.st_size);
+        m_isOpen = true;
+
+        if (m_size == 0)
+        {
+            return true;
+        }
+
+        void* pData = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (pData == MAP_FAILED) [[unlikely]]
+        {
+            JPT_ERROR("Failed to map file (%s)", path.ConstBuffer());
+            Close();
+            return false;
+        }
+
+        // Loaders parse front to back
+        ::madvise(pData, m_size, MADV_SEQUENTIAL);
+        m_pData = static_cast<const char*>(pData);
+#endif
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        if (m_pData)
+        {
+            ::UnmapViewOfFile(m_pData);
+        }
+        if (m_mappingHandle)
+        {
+            ::CloseHandle(m_mappingHandle);
+        }
+        if (m_fileHandle)
+        {
+            ::CloseHandle(m_fileHandle);
+        }
+
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+#else
+        if (m_pData)
+        {
+            ::munmap(const_cast<char*>(m_pData), m_size);
+        }
+        if (m_fileDescriptor >= 0)
+        {
+            ::close(m_fileDescriptor);
+        }
+
+        m_fileDescriptor = -1;
+#endif
+
+        m_pData = nullptr;
+        m_size = 0;
+        m_isOpen = false;
+    }
+
+    void MappedFile::MoveFrom(MappedFile& other)
+    {
+        m_pData = other.m_pData;
+        m_size = other.m_size;
+        m_isOpen = other.m_isOpen;
+
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        m_fileHandle = other.m_fileHandle;
+        m_mappingHandle = other.m_mappingHandle;
+        other.m_fileHandle = nullptr;
+        other.m_mappingHandle = nullptr;
+#else
+        m_fileDescriptor = other.m_fileDescriptor;
+        other.m_fileDescriptor = -1;
+#endif
+
+        other.m_pData = nullptr;
+        other.m_size = 0;
+        other.m_isOpen = false;
+    }
+}
\ No newline at end of file
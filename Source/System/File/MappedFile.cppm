@@ -0,0 +1,60 @@
+// Copyright Jupiter Technologies, Inc. All Rights Reserved.
+
+export module jpt.MappedFile;
+
+import jpt.ArrayView;
+import jpt.FilePath;
+import jpt.StringView;
+import jpt.TypeDefs;
+
+export namespace jpt::File
+{
+    /** Read-only view of a whole file mapped into memory. Pages come straight from the OS file cache, nothing is copied.
+        Views returned stay valid until Close() or destruction. The content isn't null-terminated
+
+        @example
+            jpt::File::MappedFile file(path);
+            if (file.IsOpen())
+            {
+                Parse(file.GetStringView());
+            } */
+    class MappedFile
+    {
+    private:
+        const char* m_pData = nullptr;
+        size_t m_size = 0;
+
+#if IS_PLATFORM_WINDOWS || IS_PLATFORM_XBOX
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#else
+        int32 m_fileDescriptor = -1;
+#endif
+
+        bool m_isOpen = false;
+
+    public:
+        MappedFile() = default;
+        MappedFile(const Path& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /** Maps the file for reading. An empty file opens with a null buffer */
+        bool Open(const Path& path);
+        void Close();
+
+        bool IsOpen() const { return m_isOpen; }
+        const char* ConstBuffer() const { return m_pData; }
+        size_t Size() const { return m_size; }
+
+        ArrayView<char> GetArrayView() const { return ArrayView<char>(m_pData, m_size); }
+        StringView GetStringView() const { return StringView(m_pData, m_size); }
+
+    private:
+        void MoveFrom(MappedFile& other);
+    };
+}
\ No newline at end of file